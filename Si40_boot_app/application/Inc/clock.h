@@ -0,0 +1,39 @@
+/**
+  ******************************************************************************
+  * @file    clock.h 
+  * @author  AKabanov
+  * @brief   Header for clock.c module
+  ******************************************************************************
+  ******************************************************************************
+  */
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __CLOCK_H
+#define __CLOCK_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f2xx_hal.h"
+
+/* Exported types ------------------------------------------------------------*/
+typedef enum
+{
+  CLOCK_HSI = 0,         // HSI 16 MHz, HSE and PLL off: wake, schedule, sensor
+  CLOCK_PLL,             // HSE 8 MHz + PLL 120 MHz: TIM1 tone burst
+} clockProfile_t;
+
+/* Exported constants --------------------------------------------------------*/
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions ------------------------------------------------------- */
+/**
+  * @brief  switch system clock to the profile
+  * @param  profile - clockProfile_t
+  * @retval None
+  */
+void clockSetProfile(clockProfile_t profile);
+/**
+  * @brief  current clock profile
+  * @param  None
+  * @retval clockProfile_t
+  */
+clockProfile_t clockGetProfile(void);
+
+#endif /* __CLOCK_H */
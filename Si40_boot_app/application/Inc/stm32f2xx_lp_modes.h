@@ -45,6 +45,11 @@
 
 /* Exported constants --------------------------------------------------------*/
 
+/* Sleep between pings, one of:
+   STANDBY_RTC_BKPSRAM_MODE - every wake is a reset through the bootloader,
+                              schedule is kept in RTC backup registers
+   STOP_MODE                - RAM, GPIO and TIM1 are kept, main() continues
+                              after RTC wakeup interrupt */
  #define STANDBY_RTC_BKPSRAM_MODE
 /* #define STOP_MODE */
 /* #define STANDBY_MODE */
@@ -59,6 +64,19 @@
 //void StandbyMode_Measure(void);
 //void StandbyRTCMode_Measure(void);
 void StandbyRTCBKPSRAMMode_Measure(int wakeUpTime);
+/**
+  * @brief  enter Stop mode with RTC wakeup interrupt after wakeUpTime,
+  *         returns after wake up, system clock is HSI
+  * @param  wakeUpTime - RTC wakeup counter, RTCCLK/16 units
+  * @retval None
+  */
+void StopRTCMode_Measure(int wakeUpTime);
+/**
+  * @brief  measure supply voltage by the PVD thresholds
+  * @param  None
+  * @retval number of thresholds below VDD, from 0 to 8
+  */
+unsigned int BatteryLevel_Measure(void);
 /**
   * @brief  Writes a data in RTC_BKP_DR0.
   * 
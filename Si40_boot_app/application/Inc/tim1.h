@@ -12,9 +12,21 @@
 
 /* Includes ------------------------------------------------------------------*/
 #include "stm32f2xx_hal.h"
+#include "sched.h"
 
 /* Exported types ------------------------------------------------------------*/
+/* one step of waveform: RCR + 1 periods of ARR + 1 timer clocks with pulse CCR1,
+   order of the fields is order of TIM1 registers for DMA burst */
+typedef struct
+{
+  uint16_t ARR;
+  uint16_t RCR;          // from 0 to 255
+  uint16_t CCR1;
+} tim1Step_t;
 /* Exported constants --------------------------------------------------------*/
+#define TIM1_TELEM_STEPS   48    // waveform table of tim1Telem, burst up to 50 ms
+/* #define TIM1_DITHER */           //uncomment to dither ARR in tim1Burst for
+                                    //fractional period of common/freqplan.h
 
 #define Tx1_Pin GPIO_PIN_7
 #define Tx1_GPIO_Port GPIOA
@@ -50,6 +62,29 @@ void tim1Start(void);
   * @retval true sucsess
   */
 uint8_t tim1SetPeriod(void);
+/**
+  * @brief  generate burst of PWM by hardware, CPU sleeps till the end
+  *         with TIM1_DITHER ARR alternates between N and N + 1
+  * @param  ms - burst length in ms
+  * @retval None
+  */
+void tim1Burst(uint32_t ms);
+/**
+  * @brief  generate waveform from the table by hardware, DMA loads the next
+  *         step on every update event, CPU sleeps till the end
+  * @param  table - steps made by tools/wavegen, must stay valid till return
+  *         steps - number of steps in the table
+  * @retval None
+  */
+void tim1Wave(const tim1Step_t* table, uint32_t steps);
+/**
+  * @brief  make waveform table of the burst with telemetry frame
+  * @param  table - TIM1_TELEM_STEPS steps
+  *         ms - burst length in ms
+  *         data - 24 bit word made by telemPack
+  * @retval number of steps for tim1Wave
+  */
+uint32_t tim1Telem(tim1Step_t* table, uint32_t ms, uint32_t data);
 /**
   * @brief  temer deinitialization
   * @param  None
@@ -67,5 +102,21 @@ void tim1DeInit(void);
   *          if channels 31-35 returns 4 - Marport_NORMAL
   */
 int eepromGetMode(void);
+/**
+  * @brief  get device ID from eeprom
+  *
+  * @param  None
+  * @retval -1 no ID found
+  *          ID from 1 to 9999 
+  */
+int eepromGetID(void);
+/**
+  * @brief  get ping schedule from eeprom
+  *
+  * @param  None
+  * @retval schedule loaded by bootloader 's' command, 
+  *         or built in schedDefault if there is no valid one
+  */
+const sched_t* eepromGetSched(void);
 
 #endif /* __TIM1_H */
@@ -0,0 +1,141 @@
+/**
+  ******************************************************************************
+  * @file    clock.c
+  * @author  AKabanov
+  * @brief   system clock profiles of the wake cycle
+  ******************************************************************************
+  * Most of the wake cycle (RTC backup registers, schedule, sensor) needs no
+  * speed, it runs from HSI with HSE and PLL stopped. HSE and PLL are started
+  * only before the burst because PWMPeriods are counted at TIM1CLK = 120 MHz.
+  * HAL_RCC_ClockConfig() updates SystemCoreClock and SysTick on every switch.
+  ******************************************************************************
+  */
+/* Includes ------------------------------------------------------------------*/
+#include "clock.h"
+#include "main.h"
+
+/** @addtogroup CLOCK
+  * @{
+  */
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+static clockProfile_t clockProfile = CLOCK_HSI;
+/* Private function prototypes -----------------------------------------------*/
+static void clockHSI(void);
+static void clockPLL(void);
+/* Public functions ----------------------------------------------------------*/
+
+/**
+  * @brief  switch system clock to the profile
+  * @param  profile - clockProfile_t
+  * @retval None
+  */
+void clockSetProfile(clockProfile_t profile)
+{
+  if(profile == CLOCK_PLL)clockPLL();
+  else clockHSI();
+  clockProfile = profile;
+}
+
+/**
+  * @brief  current clock profile
+  * @param  None
+  * @retval clockProfile_t
+  */
+clockProfile_t clockGetProfile(void)
+{
+  return clockProfile;
+}
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  SYSCLK = HCLK = PCLK1 = PCLK2 = HSI 16 MHz, flash 0 wait states,
+  *         then PLL and HSE are stopped
+  *         after cold boot the bootloader leaves HSE (or PLL) running
+  * @param  None
+  * @retval None
+  */
+static void clockHSI(void)
+{
+  RCC_OscInitTypeDef RCC_OscInitStruct;
+  RCC_ClkInitTypeDef RCC_ClkInitStruct;
+
+  RCC_OscInitStruct.OscillatorType = RCC_OSCILLATORTYPE_HSI;
+  RCC_OscInitStruct.HSIState = RCC_HSI_ON;
+  RCC_OscInitStruct.HSICalibrationValue = RCC_HSICALIBRATION_DEFAULT;
+  RCC_OscInitStruct.PLL.PLLState = RCC_PLL_NONE;
+  if (HAL_RCC_OscConfig(&RCC_OscInitStruct) != HAL_OK)
+  {
+    Error_Handler();
+  }
+
+  RCC_ClkInitStruct.ClockType = RCC_CLOCKTYPE_HCLK|RCC_CLOCKTYPE_SYSCLK
+                              |RCC_CLOCKTYPE_PCLK1|RCC_CLOCKTYPE_PCLK2;
+  RCC_ClkInitStruct.SYSCLKSource = RCC_SYSCLKSOURCE_HSI;
+  RCC_ClkInitStruct.AHBCLKDivider = RCC_SYSCLK_DIV1;
+  RCC_ClkInitStruct.APB1CLKDivider = RCC_HCLK_DIV1;
+  RCC_ClkInitStruct.APB2CLKDivider = RCC_HCLK_DIV1;
+  if (HAL_RCC_ClockConfig(&RCC_ClkInitStruct, FLASH_LATENCY_0) != HAL_OK)
+  {
+    Error_Handler();
+  }
+
+  /* PLL first, HSE is its source */
+  RCC_OscInitStruct.OscillatorType = RCC_OSCILLATORTYPE_NONE;
+  RCC_OscInitStruct.PLL.PLLState = RCC_PLL_OFF;
+  if (HAL_RCC_OscConfig(&RCC_OscInitStruct) != HAL_OK)
+  {
+    Error_Handler();
+  }
+  RCC_OscInitStruct.OscillatorType = RCC_OSCILLATORTYPE_HSE;
+  RCC_OscInitStruct.HSEState = RCC_HSE_OFF;
+  RCC_OscInitStruct.PLL.PLLState = RCC_PLL_NONE;
+  if (HAL_RCC_OscConfig(&RCC_OscInitStruct) != HAL_OK)
+  {
+    Error_Handler();
+  }
+}
+
+/**
+  * @brief  SYSCLK = HCLK = 120 MHz from HSE 8 MHz and PLL,
+  *         PCLK1 = 30 MHz, PCLK2 = 60 MHz (TIM1CLK = 120 MHz)
+  * @param  None
+  * @retval None
+  */
+static void clockPLL(void)
+{
+  RCC_OscInitTypeDef RCC_OscInitStruct;
+  RCC_ClkInitTypeDef RCC_ClkInitStruct;
+
+  RCC_OscInitStruct.OscillatorType = RCC_OSCILLATORTYPE_HSE;
+  RCC_OscInitStruct.HSEState = RCC_HSE_ON;
+  RCC_OscInitStruct.PLL.PLLState = RCC_PLL_ON;
+  RCC_OscInitStruct.PLL.PLLSource = RCC_PLLSOURCE_HSE;
+  RCC_OscInitStruct.PLL.PLLM = 8;
+  RCC_OscInitStruct.PLL.PLLN = 240;
+  RCC_OscInitStruct.PLL.PLLP = RCC_PLLP_DIV2;
+  RCC_OscInitStruct.PLL.PLLQ = 5;
+  if (HAL_RCC_OscConfig(&RCC_OscInitStruct) != HAL_OK)
+  {
+    Error_Handler();
+  }
+
+  RCC_ClkInitStruct.ClockType = RCC_CLOCKTYPE_HCLK|RCC_CLOCKTYPE_SYSCLK
+                              |RCC_CLOCKTYPE_PCLK1|RCC_CLOCKTYPE_PCLK2;
+  RCC_ClkInitStruct.SYSCLKSource = RCC_SYSCLKSOURCE_PLLCLK;
+  RCC_ClkInitStruct.AHBCLKDivider = RCC_SYSCLK_DIV1;
+  RCC_ClkInitStruct.APB1CLKDivider = RCC_HCLK_DIV4;
+  RCC_ClkInitStruct.APB2CLKDivider = RCC_HCLK_DIV2;
+  if (HAL_RCC_ClockConfig(&RCC_ClkInitStruct, FLASH_LATENCY_3) != HAL_OK)
+  {
+    Error_Handler();
+  }
+}
+
+/**
+  * @}
+  */
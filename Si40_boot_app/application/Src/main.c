@@ -18,6 +18,11 @@
 #include <intrinsics.h>
 #include "tim1.h"
 #include "gpio.h"
+#include "clock.h"
+#include "trace.h"
+#include "telem.h"
+#include "evlog.h"
+#include "wdg.h"
 
 
 /** @addtogroup STM32F2xx_HAL_Examples
@@ -34,17 +39,6 @@
 #define APP_SUB_VER    8
 #define APP_BUILD      82
 #define APP_CHECK      (APP_VER + APP_SUB_VER + APP_BUILD)
-#define SEC3    ((0x800*3)-70)
-#define SEC4    ((0x800*4)-70)
-#define SEC5    ((0x800*5)-70)
-#define SEC5_5  ((0x800*5)+330)
-#define SEC6    ((0x800*6)-70)
-#define SEC20   ((0x800*20)-70)
-#define SEC30   ((0x800UL*30)-70)
-#define SEC32   ((0x800UL*32)-70)
-#define SEC34   (0x800UL*30)
-#define SEC123  (0x800UL*30)
-#define SEC126  (0x800UL*30)
 
 /* Private macro -------------------------------------------------------------*/
 extern uint32_t __checksum;                                 // import checksum
@@ -54,16 +48,12 @@ extern uint32_t __checksum;                                 // import checksum
 //uint32_t* ptr = begin;
 volatile uint32_t *pCrc;
 unsigned char version;
-uint32_t wakeUpTime[2][4] = {{SEC5_5,SEC34,SEC126,SEC30},
-                             {SEC5  ,SEC32,SEC123,SEC20}};
-
-uint32_t repetition[2][4] = {{1,2,5,1},
-                             {1,1,5,1}};
-
-uint32_t reminder[2][4] = {{0,SEC4,SEC6,0},
-                           {0,0,SEC3,0}};
-
-uint32_t testRTC, testWakeUpTime, testRepetition, testReminder;
+/* ping schedule position, kept in BKUP0 - BKUP1 through standby */
+schedState_t schedState;
+static uint8_t periphReady = 0;   // gpio and TIM1 are configured, kept in Stop mode
+#ifdef TELEM_ENABLE
+static tim1Step_t telemTable[TIM1_TELEM_STEPS];   // burst with telemetry frame
+#endif
 
 //__no_init static int wakeUpCounter;
 //__no_init static int wakeUpCounter2;
@@ -72,8 +62,7 @@ uint32_t testRTC, testWakeUpTime, testRepetition, testReminder;
 const unsigned char appVer [] = {APP_VER,APP_SUB_VER,APP_BUILD,APP_CHECK};
 #pragma default_variable_attributes =
 /* Private function prototypes -----------------------------------------------*/
-
-void SystemClock_Config(void);
+static void appSleep(uint32_t wakeUpTime);
 /* Private functions ---------------------------------------------------------*/
 
 /**
@@ -89,6 +78,9 @@ int main(void)
 {
     
    __enable_interrupt();
+   traceInit();
+   traceMark(TRACE_APP_MAIN);
+   wdgStart();
     
     /* STM32F2xx HAL library initialization:
        - Configure the Flash prefetch, instruction and Data caches
@@ -97,27 +89,15 @@ int main(void)
        - Global MSP (MCU Support Package) initialization
      */
   HAL_Init();
+  traceMark(TRACE_APP_HAL_INIT);
   
-  /* Configure the system clock to 120 MHz */
-  SystemClock_Config();
+  /* Wake cycle runs from HSI 16 MHz, PLL is started just before the burst */
+  clockSetProfile(CLOCK_HSI);
+  traceMark(TRACE_APP_CLOCK);
   
   RTCInit();
-  
-  testRTC = BKUP0Read();
-  testWakeUpTime = BKUP0Read();
-  testRepetition = BKUP1Read();
-  testReminder = BKUP2Read();;
-  
-  if(testRepetition > 0)
-  {  
-    testRepetition--;
-    BKUP1Write(testRepetition);
-    if(testRepetition > 0)StandbyRTCBKPSRAMMode_Measure(testWakeUpTime);
-    else StandbyRTCBKPSRAMMode_Measure(testReminder);
-  }
-  
-  gpioInit();  
-  tim1Init();
+  traceMark(TRACE_APP_RTC);
+  evlogInit();
   
   pCrc = &__checksum;      //to avoid optimization by compilator
   version = appVer[0];  // to avoid optimization by compilator
@@ -129,20 +109,36 @@ int main(void)
   /* -3- Toggle PA.0 IOs in an infinite loop */  
   while (1)
   {
+    /* in Standby mode the loop runs once per wake, in Stop mode it goes on */
+#ifdef STOP_MODE
+    wdgKick();
+#endif
+    schedState.remaining = BKUP0Read();
+    schedState.position = BKUP1Read();
+    uint32_t sleep = schedWake(&schedState);
+    if(sleep > 0)           // long interval, RTC wakeup counter is 16 bit
+    {  
+      BKUP0Write(schedState.remaining);
+      evlogWake((uint8_t)SCHED_POS_PHASE(schedState.position));
+      appSleep(sleep);
+      continue;
+    }
+    
+    if(periphReady == 0)
+    {
+      gpioInit();  
+      tim1Init();
+      periphReady = 1;
+      traceMark(TRACE_APP_TIM);
+    }
     
-    /* STANDBY Mode with RTC on LSE/LSI Entry 
-    - RTC Clocked by LSE/LSI
-    - Backup SRAM ON
-    - IWDG OFF
-    - Automatic Wakeup using RTC clocked by LSE/LSI (after ~20s)
-    */
     gpioPWROn();    
     gpioPA2Off();
-    tim1SetPeriod();    
     HAL_Delay(5);   
     int sensState = 0;              //empty
     if(gpioGetPA0())sensState = 1;  //full
     gpioPA2On();
+    traceMark(TRACE_APP_PERIOD);
     
     int mode = eepromGetMode();
     if((mode > 0)&&(mode < 5)) mode = mode - 1;
@@ -150,9 +146,21 @@ int main(void)
     int delay = 29;
     if(mode == 3)delay = 47; // if marport then duration = 48mS
     
-    tim1Start();
-    HAL_Delay(delay);
-    tim1Stop();
+#ifdef TELEM_ENABLE
+    int id = eepromGetID();
+    uint32_t telem = telemPack((id > 0) ? id : 0, BatteryLevel_Measure(), sensState);
+#endif
+    
+    clockSetProfile(CLOCK_PLL);     // PWMPeriods are counted at 120 MHz
+    traceMark(TRACE_APP_PLL);
+    tim1SetPeriod();    
+    traceMark(TRACE_APP_BURST);
+#ifdef TELEM_ENABLE
+    tim1Wave(telemTable, tim1Telem(telemTable, delay, telem));
+#else
+    tim1Burst(delay);
+#endif
+    traceMark(TRACE_APP_BURST_END);
     
     //gpioPA2On();                //LED off
     gpioPWROff();
@@ -160,69 +168,39 @@ int main(void)
  //   HAL_Delay(20000);
     
     
-    BKUP0Write(wakeUpTime[sensState][mode]);
-    BKUP1Write(repetition[sensState][mode]-1);
-    BKUP2Write(reminder[sensState][mode]);
-    
-    testWakeUpTime = BKUP0Read();
-    //testRepetition = BKUP1Read();
-    //testReminder = BKUP2Read();;
+    sleep = schedPing(eepromGetSched(), &schedState, mode, sensState);
+    BKUP0Write(schedState.remaining);
+    BKUP1Write(schedState.position);
+    evlogAdd((uint8_t)(sensState | (mode << EVLOG_STATE_MODE_Pos)), (uint16_t)delay,
+             (uint8_t)SCHED_POS_PHASE(schedState.position));
+    wdgGood();
     
+#ifndef STOP_MODE
     tim1DeInit();
     gpioDeInit();
-    StandbyRTCBKPSRAMMode_Measure(testWakeUpTime);
+    periphReady = 0;
+#endif
+    appSleep(sleep);
   }
 }
 
 /**
-  * @brief System Clock Configuration
+  * @brief  sleep till the next wake up
+  *         Standby: does not return, the next wake starts from reset
+  *         Stop: returns after wake up, clock profile is HSI
+  * @param  wakeUpTime - RTC wakeup counter, RTCCLK/16 units
   * @retval None
   */
-void SystemClock_Config(void)
+static void appSleep(uint32_t wakeUpTime)
 {
-
-  RCC_OscInitTypeDef RCC_OscInitStruct;
-  RCC_ClkInitTypeDef RCC_ClkInitStruct;
-
-    /**Initializes the CPU, AHB and APB busses clocks 
-    */
-  RCC_OscInitStruct.OscillatorType = RCC_OSCILLATORTYPE_HSE;
-  RCC_OscInitStruct.HSEState = RCC_HSE_ON;
-  RCC_OscInitStruct.PLL.PLLState = RCC_PLL_ON;
-  RCC_OscInitStruct.PLL.PLLSource = RCC_PLLSOURCE_HSE;
-  RCC_OscInitStruct.PLL.PLLM = 8;
-  RCC_OscInitStruct.PLL.PLLN = 240;
-  RCC_OscInitStruct.PLL.PLLP = RCC_PLLP_DIV2;
-  RCC_OscInitStruct.PLL.PLLQ = 5;
-  if (HAL_RCC_OscConfig(&RCC_OscInitStruct) != HAL_OK)
-  {
-     Error_Handler();
-  }
-
-    /**Initializes the CPU, AHB and APB busses clocks 
-    */
-  RCC_ClkInitStruct.ClockType = RCC_CLOCKTYPE_HCLK|RCC_CLOCKTYPE_SYSCLK
-                              |RCC_CLOCKTYPE_PCLK1|RCC_CLOCKTYPE_PCLK2;
-  RCC_ClkInitStruct.SYSCLKSource = RCC_SYSCLKSOURCE_PLLCLK;
-  RCC_ClkInitStruct.AHBCLKDivider = RCC_SYSCLK_DIV1;
-  RCC_ClkInitStruct.APB1CLKDivider = RCC_HCLK_DIV4;
-  RCC_ClkInitStruct.APB2CLKDivider = RCC_HCLK_DIV2;
-
-  if (HAL_RCC_ClockConfig(&RCC_ClkInitStruct, FLASH_LATENCY_3) != HAL_OK)
-  {
-    Error_Handler();
-  }
-
-  /*
-  //Configure the Systick interrupt time 
-  HAL_SYSTICK_Config(HAL_RCC_GetHCLKFreq()/1000);
-
-  //Configure the Systick    
-  HAL_SYSTICK_CLKSourceConfig(SYSTICK_CLKSOURCE_HCLK);
-
-  //SysTick_IRQn interrupt configuration
-  HAL_NVIC_SetPriority(SysTick_IRQn, 0, 0);
-  */
+  traceMark(TRACE_APP_SLEEP);
+#ifdef STOP_MODE
+  StopRTCMode_Measure(wakeUpTime);
+  traceMark(TRACE_APP_WAKE);
+  clockSetProfile(CLOCK_HSI);     // after Stop SYSCLK is HSI, refresh HAL clock state
+#else
+  StandbyRTCBKPSRAMMode_Measure(wakeUpTime);
+#endif
 }
 
 /**
@@ -234,9 +212,7 @@ void Error_Handler(void)
 {
   /* User may add here some code to deal with this error */
   gpioPA2Off();
-  while(1)
-  {
-  }
+  wdgFault(0);      // bootloader counts fault resets
 }
 
 #ifdef  USE_FULL_ASSERT
@@ -40,6 +40,7 @@
 #include "main.h"
 
 //extern void _Error_Handler(char *, int);
+extern DMA_HandleTypeDef hdmaTim1Up;
 /* USER CODE BEGIN 0 */
 
 /**
@@ -182,6 +183,27 @@ void HAL_TIM_PWM_MspInit(TIM_HandleTypeDef* htim_pwm)
   GPIO_InitStruct.Pin = GPIO_PIN_8 | GPIO_PIN_7;
   HAL_GPIO_Init(GPIOA, &GPIO_InitStruct);
   
+  /*##-2- DMA2 Stream5 Channel6 (TIM1_UP) loads waveform steps ##############*/
+  __HAL_RCC_DMA2_CLK_ENABLE();
+  
+  hdmaTim1Up.Instance = DMA2_Stream5;
+  hdmaTim1Up.Init.Channel = DMA_CHANNEL_6;
+  hdmaTim1Up.Init.Direction = DMA_MEMORY_TO_PERIPH;
+  hdmaTim1Up.Init.PeriphInc = DMA_PINC_DISABLE;
+  hdmaTim1Up.Init.MemInc = DMA_MINC_ENABLE;
+  hdmaTim1Up.Init.PeriphDataAlignment = DMA_PDATAALIGN_HALFWORD;
+  hdmaTim1Up.Init.MemDataAlignment = DMA_MDATAALIGN_HALFWORD;
+  hdmaTim1Up.Init.Mode = DMA_NORMAL;
+  hdmaTim1Up.Init.Priority = DMA_PRIORITY_HIGH;
+  hdmaTim1Up.Init.FIFOMode = DMA_FIFOMODE_DISABLE;
+  if(HAL_DMA_Init(&hdmaTim1Up) != HAL_OK)
+  {
+    Error_Handler();
+  }
+  __HAL_LINKDMA(htim_pwm, hdma[TIM_DMA_ID_UPDATE], hdmaTim1Up);
+  
+  HAL_NVIC_SetPriority(DMA2_Stream5_IRQn, 1, 0);
+  HAL_NVIC_EnableIRQ(DMA2_Stream5_IRQn);
 }
 
 //void HAL_TIM_MspPostInit(TIM_HandleTypeDef* htim)
@@ -226,6 +248,10 @@ void HAL_TIM_PWM_MspDeInit(TIM_HandleTypeDef* htim_pwm)
     /* TIM1 interrupt DeInit */
     HAL_NVIC_DisableIRQ(TIM1_UP_TIM10_IRQn);
     HAL_NVIC_DisableIRQ(TIM1_CC_IRQn);
+    
+    /* TIM1 DMA DeInit */
+    HAL_DMA_DeInit(htim_pwm->hdma[TIM_DMA_ID_UPDATE]);
+    HAL_NVIC_DisableIRQ(DMA2_Stream5_IRQn);
   /* USER CODE BEGIN TIM1_MspDeInit 1 */
 
   /* USER CODE END TIM1_MspDeInit 1 */
@@ -52,6 +52,7 @@
 /* Private macro -------------------------------------------------------------*/
 /* Private variables ---------------------------------------------------------*/
 extern RTC_HandleTypeDef RTCHandle;
+extern TIM_HandleTypeDef TimHandle;
 /* Private function prototypes -----------------------------------------------*/
 /* Private functions ---------------------------------------------------------*/
 
@@ -183,6 +184,26 @@ void RTC_WKUP_IRQHandler(void)
   HAL_RTCEx_WakeUpTimerIRQHandler(&RTCHandle);
 }
 
+/**
+  * @brief  This function handles TIM1 update interrupt, end of burst part.
+  * @param  None
+  * @retval None
+  */
+void TIM1_UP_TIM10_IRQHandler(void)
+{
+  HAL_TIM_IRQHandler(&TimHandle);
+}
+
+/**
+  * @brief  This function handles DMA2 Stream5 interrupt, TIM1 waveform steps.
+  * @param  None
+  * @retval None
+  */
+void DMA2_Stream5_IRQHandler(void)
+{
+  HAL_DMA_IRQHandler(TimHandle.hdma[TIM_DMA_ID_UPDATE]);
+}
+
 
 /**
   * @}
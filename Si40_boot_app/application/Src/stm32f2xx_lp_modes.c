@@ -52,6 +52,7 @@
 
 /* Private typedef -----------------------------------------------------------*/
 /* Private define ------------------------------------------------------------*/
+#define PVD_SETTLE_LOOPS  40    /* ~20 us at HSI 16 MHz, PVD output after level change */
 /* Private macro -------------------------------------------------------------*/
 /* Private variables ---------------------------------------------------------*/
 
@@ -101,7 +102,7 @@ void RTCInit(void)
   *         ====================================================
   *           - RTC Clocked by LSE or LSI
   *           - Backup SRAM ON
-  *           - IWDG OFF
+  *           - IWDG keeps running, wakeUpTime is below its timeout
   *           - Automatic Wakeup using RTC clocked by LSE/LSI (after ~20s)
   * @param  None
   * @retval None
@@ -145,6 +146,59 @@ void StandbyRTCBKPSRAMMode_Measure(int wakeUpTime)
   HAL_PWR_EnterSTANDBYMode();
 }
 
+/**
+  * @brief  This function configures the system to enter Stop mode with RTC
+  *         wakeup interrupt, RAM and peripheral registers are kept.
+  *         STOP Mode with RTC clocked by LSE/LSI
+  *         ======================================
+  *           - Regulator in low power mode
+  *           - RTC Clocked by LSE or LSI
+  *           - Wakeup by RTC wakeup interrupt after wakeUpTime
+  *           - System clock after wake up is HSI, HSE and PLL are off
+  * @param  wakeUpTime - RTC wakeup counter, RTCCLK/16 units
+  * @retval None
+  */
+void StopRTCMode_Measure(int wakeUpTime)
+{
+  /* Disable Wake-up timer */
+  HAL_RTCEx_DeactivateWakeUpTimer(&RTCHandle);
+  
+  /* Clear RTC Wake Up timer Flag */
+  __HAL_RTC_WAKEUPTIMER_CLEAR_FLAG(&RTCHandle, RTC_FLAG_WUTF);
+  
+  /*## Setting the Wake up time ##############################################*/
+  HAL_RTCEx_SetWakeUpTimer_IT(&RTCHandle,(uint32_t)wakeUpTime, RTC_WAKEUPCLOCK_RTCCLK_DIV16);
+
+  /* SysTick interrupt must not wake up the core */
+  HAL_SuspendTick();
+
+  /*## Enter the Stop mode ###################################################*/
+  HAL_PWR_EnterSTOPMode(PWR_LOWPOWERREGULATOR_ON, PWR_STOPENTRY_WFI);
+
+  HAL_ResumeTick();
+}
+
+/**
+  * @brief  measure supply voltage by the PVD thresholds
+  *         2.0, 2.1, 2.3, 2.5, 2.6, 2.7, 2.8, 2.9 V, PVD is off after return
+  * @param  None
+  * @retval number of thresholds below VDD, from 0 to 8
+  */
+unsigned int BatteryLevel_Measure(void)
+{
+  unsigned int level;
+
+  __HAL_RCC_PWR_CLK_ENABLE();
+  for(level = 0; level < 8; level++)
+  {
+    MODIFY_REG(PWR->CR, PWR_CR_PLS, (level << PWR_CR_PLS_Pos) | PWR_CR_PVDE);
+    for(volatile int i = 0; i < PVD_SETTLE_LOOPS; i++);   // PVD output settles
+    if(PWR->CSR & PWR_CSR_PVDO)break;                   // VDD below threshold
+  }
+  CLEAR_BIT(PWR->CR, PWR_CR_PVDE);
+  return level;
+}
+
 /**
   * @brief  Writes a data in RTC_BKP_DR0.
   * 
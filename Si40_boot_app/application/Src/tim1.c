@@ -9,6 +9,8 @@
 
 /* Includes ------------------------------------------------------------------*/
 #include "tim1.h"
+#include "telem.h"
+#include "freqplan.h"
 #include "intrinsics.h"
 
 extern void Error_Handler(void);
@@ -26,27 +28,45 @@ typedef struct
   uint32_t IDCheck;
   uint32_t ChannelCheck;
   uint32_t ModeCheck;
+  sched_t Sched;
 } param_t;
 typedef union
 {
   param_t param;
   uint32_t eeprom[sizeof(param_t)/sizeof(uint32_t)];
 } eeprom_t;
+/* register image loaded in TIM1 for the channel */
+typedef struct
+{
+  uint32_t ARR;
+  uint32_t CCR1;
+  uint32_t BDTR;
+  uint32_t CCER;
+} tim1Image_t;
 /* Private define ------------------------------------------------------------*/
+#define TIM1_DITHER_LEN    (1 << FREQ_FRAC_BITS)  /* periods in dither pattern */
 /* Private macro -------------------------------------------------------------*/
 /* Private variables ---------------------------------------------------------*/
-/*channels 0 - 29 PI-C, 30 - 34, MARPORT*/
-uint32_t PWMPeriods[] = {2751,
-                         2739,2726,2714,2702,2690,2678,
-                         2666,2654,2642,2631,2619,2608,
-                         2596,2585,2574,2563,2552,2541,
-                         2531,2520,2509,2499,2489,2478,
-                         2468,2458,2448,2438,2428,
-                         2777,2783,2790,2770,2764};
+/* ARR of the channels 1 - 35, from common/freqplan.h */
+#define PWM_PERIOD_ITEM(ch, hz)  [(ch) - 1] = FREQ_ARR(hz),
+const uint16_t PWMPeriods[FREQ_CHANNELS] = {FREQ_PLAN(PWM_PERIOD_ITEM)};
+#ifdef TIM1_DITHER
+/* period of the channels in 1/TIM1_DITHER_LEN counts */
+#define PWM_FRAC_ITEM(ch, hz)  [(ch) - 1] = FREQ_PERIOD_FRAC(hz),
+static const uint32_t PWMPeriodsFrac[FREQ_CHANNELS] = {FREQ_PLAN(PWM_FRAC_ITEM)};
+/* ARR of consecutive periods, DMA loads it in circle */
+static uint16_t ditherPattern[TIM1_DITHER_LEN];
+static uint8_t ditherOn;
+/* patterns left till the end of burst */
+static volatile uint32_t ditherCycles;
+#endif
 eeprom_t eeprom;
 /* Timer handler declaration */
 TIM_HandleTypeDef               TimHandle;
 
+/* DMA of TIM1 update request, loads waveform steps */
+DMA_HandleTypeDef               hdmaTim1Up;
+
 /* Timer Output Compare Configuration Structure declaration */
 TIM_OC_InitTypeDef              sPWMConfig;
 /* Timer Break Configuration Structure declaration */
@@ -54,6 +74,11 @@ TIM_BreakDeadTimeConfigTypeDef sBreakConfig;
 
 /* Counter Prescaler value */
 uint32_t uwPrescalerValue = 0;
+/* Register image of the current channel, prepared by tim1Init */
+static tim1Image_t tim1Image;
+/* repetition counter cycles left till the end of burst */
+static volatile uint32_t burstChunks;
+static volatile uint8_t burstEnd;
 /* USER CODE BEGIN PV */
 /* Private variables ---------------------------------------------------------*/
 
@@ -61,6 +86,13 @@ uint32_t uwPrescalerValue = 0;
 #define  PULSE1_VALUE       1395  /* Capture Compare 1 Value  */ //
 #define  DEAD_TIME          0xc5
 #define  MAX_PERIOD_VALUE   2790
+#define  MAX_REPETITION     256   /* TIM1 RCR is 8 bit */
+
+/* BDTR as configured by HAL_TIMEx_ConfigBreakDeadTime in tim1Init, without MOE */
+#define  TIM1_BDTR          (DEAD_TIME | TIM_OSSR_ENABLE | TIM_OSSI_ENABLE | \
+                             TIM_BREAKPOLARITY_HIGH | TIM_AUTOMATICOUTPUT_ENABLE)
+/* channel 1 and 1N enabled, active high */
+#define  TIM1_CCER          (TIM_CCER_CC1E | TIM_CCER_CC1NE)
 
 #define FLASH_EEPROM_START_ADDR ((uint32_t)0x08008000)  /* Start @ of eeprom area */
 #define CHECK(x) (x + 100)
@@ -70,6 +102,14 @@ uint32_t uwPrescalerValue = 0;
 /* Private function prototypes -----------------------------------------------*/
 uint8_t flashReadEEPROM(uint32_t* buffer, uint32_t length);
 int eepromGetChannel(void);
+static void tim1PrepImage(void);
+static void tim1WaveDMACplt(DMA_HandleTypeDef *hdma);
+static uint32_t tim1AddSteps(tim1Step_t* table, uint32_t steps, uint32_t periods, uint32_t ccr1);
+#ifdef TIM1_DITHER
+static void tim1PrepDither(int channel);
+static void tim1BurstDither(uint32_t ms);
+static void tim1DitherDMACplt(DMA_HandleTypeDef *hdma);
+#endif
 /* Private functions ---------------------------------------------------------*/
 /**
   * @brief  read EEPROM area
@@ -105,12 +145,27 @@ int eepromGetChannel(void)
 {
   if(flashReadEEPROM(eeprom.eeprom , sizeof(eeprom)/sizeof(uint32_t)) != 0)return -1;
   if(CHECK(eeprom.param.Channel) != eeprom.param.ChannelCheck) return -1;
-  if((eeprom.param.Channel > 35)||(eeprom.param.Channel == 0))return -1;
+  if((eeprom.param.Channel > FREQ_CHANNELS)||(eeprom.param.Channel == 0))return -1;
   return (int)eeprom.param.Channel;
 }
 
 /* Public functions ---------------------------------------------------------*/
 
+/**
+  * @brief  get device ID from eeprom
+  *
+  * @param  None
+  * @retval -1 no ID found
+  *          ID from 1 to 9999 
+  */
+int eepromGetID(void)
+{
+  if(flashReadEEPROM(eeprom.eeprom , sizeof(eeprom)/sizeof(uint32_t)) != 0)return -1;
+  if(CHECK(eeprom.param.ID) != eeprom.param.IDCheck) return -1;
+  if((eeprom.param.ID > 9999)||(eeprom.param.ID == 0))return -1;
+  return (int)eeprom.param.ID;
+}
+
 /**
   * @brief  get Mode from eeprom
   *
@@ -132,6 +187,21 @@ int eepromGetMode(void)
   return (int)eeprom.param.Mode;
 }
 
+/**
+  * @brief  get ping schedule from eeprom
+  *
+  * @param  None
+  * @retval schedule loaded by bootloader 's' command, 
+  *         or built in schedDefault if there is no valid one
+  */
+const sched_t* eepromGetSched(void)
+{
+  const param_t* param = (const param_t*)FLASH_EEPROM_START_ADDR;
+
+  if(schedCheck(&param->Sched) != 0)return &schedDefault;
+  return &param->Sched;
+}
+
 /**
   * @brief   
   ##-1- Configure the TIM peripheral #######################################
@@ -144,8 +214,8 @@ int eepromGetMode(void)
     PCLK2 = HCLK / 2 
     => TIM1CLK = 2 * (HCLK / 2) = HCLK = SystemCoreClock
   
-    TIM1CLK is fixed to SystemCoreClock, the TIM1 Prescaler is set to have
-    TIM1 counter clock = 120MHz..
+    TIM1CLK is fixed to SystemCoreClock, the TIM1 Prescaler is FREQ_PSC of
+    common/freqplan.h: TIM1 counter clock = 120MHz/(FREQ_PSC + 1).
 
 
     The Three Duty cycles are computed as the following description: 
@@ -178,7 +248,7 @@ void tim1Init(void)
   /* Select the Timer instance */
   TimHandle.Instance = TIM1;
   
-  TimHandle.Init.Prescaler         = 0;
+  TimHandle.Init.Prescaler         = FREQ_PSC;          // counter at FREQ_CNT_CLK
   TimHandle.Init.Period            = PERIOD_VALUE;
   TimHandle.Init.ClockDivision     = TIM_CLOCKDIVISION_DIV1;
   TimHandle.Init.CounterMode       = TIM_COUNTERMODE_UP;
@@ -226,6 +296,13 @@ void tim1Init(void)
   /*##-3- Start PWM signals generation #######################################*/ 
   /* Start channel 1 */
   //tim1Start();
+  
+  /*##-4- Prepare register image of the channel for tim1SetPeriod ############*/ 
+  tim1PrepImage();
+  
+  /*##-5- Update interrupt is used to count the burst length ################*/ 
+  HAL_NVIC_SetPriority(TIM1_UP_TIM10_IRQn, 1, 0);
+  HAL_NVIC_EnableIRQ(TIM1_UP_TIM10_IRQn);
 }
 /**
   * @brief  stop timer
@@ -235,17 +312,10 @@ void tim1Init(void)
 
 void tim1Stop(void)
 {   
-  if(HAL_TIM_PWM_Stop(&TimHandle, TIM_CHANNEL_1) != HAL_OK)
-  {
-    /* Starting Error */
-    Error_Handler(); 
-  }
-  /* Start channel 1N */
-  if(HAL_TIMEx_PWMN_Stop(&TimHandle, TIM_CHANNEL_1) != HAL_OK)
-  {
-    /* Starting Error */
-    Error_Handler(); 
-  }    
+  /* same as HAL_TIM_PWM_Stop + HAL_TIMEx_PWMN_Stop for channel 1 */
+  TIM1->CCER &= ~TIM1_CCER;
+  TIM1->BDTR &= ~TIM_BDTR_MOE;
+  TIM1->CR1 &= ~TIM_CR1_CEN;
 }
 
 /**
@@ -256,47 +326,351 @@ void tim1Stop(void)
 
 void tim1Start(void)
 {   
-  if(HAL_TIM_PWM_Start(&TimHandle, TIM_CHANNEL_1) != HAL_OK)
+  /* same as HAL_TIM_PWM_Start + HAL_TIMEx_PWMN_Start for channel 1 */
+  TIM1->CCER = tim1Image.CCER;
+  TIM1->BDTR = tim1Image.BDTR | TIM_BDTR_MOE;
+  TIM1->CR1 |= TIM_CR1_CEN;
+}
+
+/**
+  * @brief  generate burst of whole PWM periods by hardware
+  *         The burst is split in repetition counter cycles of up to 256 periods,
+  *         the first one is shorter. Update interrupt counts the cycles and
+  *         sets one pulse mode for the last one, so the counter stops exactly
+  *         after the last period. CPU sleeps while the burst is running.
+  * @param  ms - burst length in ms, rounded to whole PWM periods
+  * @retval None
+  */
+void tim1Burst(uint32_t ms)
+{
+  uint32_t periods = (ms * (SystemCoreClock/1000UL)) / ((FREQ_PSC + 1) * (tim1Image.ARR + 1));
+  uint32_t first;
+  
+#ifdef TIM1_DITHER
+  if(ditherOn)
   {
-    /* Starting Error */
-    Error_Handler(); 
+    tim1BurstDither(ms);
+    return;
   }
-  /* Start channel 1N */
-  if(HAL_TIMEx_PWMN_Start(&TimHandle, TIM_CHANNEL_1) != HAL_OK)
+#endif
+  if(periods == 0)return;
+  burstChunks = (periods + MAX_REPETITION - 1) / MAX_REPETITION;
+  first = periods - (burstChunks - 1) * MAX_REPETITION;
+  burstEnd = 0;
+  
+  TIM1->CR1 |= TIM_CR1_URS;            // only counter overflow makes interrupt
+  TIM1->RCR = first - 1;
+  TIM1->EGR = TIM_EGR_UG;              // load first cycle length
+  TIM1->RCR = MAX_REPETITION - 1;      // preload for the next cycles
+  if(burstChunks == 1)TIM1->CR1 |= TIM_CR1_OPM;
+  TIM1->SR = ~TIM_SR_UIF;
+  TIM1->DIER |= TIM_DIER_UIE;
+  
+  HAL_SuspendTick();
+  tim1Start();
+  while(!burstEnd)
   {
-    /* Starting Error */
-    Error_Handler(); 
-  }    
+    __WFI();
+  }
+  HAL_ResumeTick();
+  
+  TIM1->DIER &= ~TIM_DIER_UIE;
+  TIM1->CR1 &= ~(TIM_CR1_OPM | TIM_CR1_URS);
+  TIM1->RCR = 0;
+  tim1Stop();
+}
+
+#ifdef TIM1_DITHER
+/**
+  * @brief  generate burst with dithered period by hardware
+  *         The pattern is loaded like steps of tim1Wave, but every period is
+  *         one step and DMA is circular, transfer complete callback counts
+  *         the patterns. The burst is c*TIM1_DITHER_LEN + 2 periods: the
+  *         last two periods of the pattern loaded at start (UG and preload),
+  *         then c whole patterns from DMA, c chosen for the nearest length
+  *         to ms. The two extra periods are each less than one count off
+  *         the average of the pattern, so the average period is within
+  *         2/(c*TIM1_DITHER_LEN + 2) counts of the frequency plan (under
+  *         0.1 Hz at 45 kHz for 10 ms).
+  * @param  ms - burst length in ms
+  * @retval None
+  */
+static void tim1BurstDither(uint32_t ms)
+{
+  uint32_t periods = (ms * (SystemCoreClock/1000UL)) / ((FREQ_PSC + 1) * (tim1Image.ARR + 1));
+  
+  /* the 2 periods loaded at start are part of the burst */
+  ditherCycles = (periods > 2) ? (periods - 2 + TIM1_DITHER_LEN/2) / TIM1_DITHER_LEN : 0;
+  if(ditherCycles == 0)ditherCycles = 1;
+  burstChunks = 0;
+  burstEnd = 0;
+  
+  TIM1->CR1 |= TIM_CR1_URS | TIM_CR1_ARPE;
+  TIM1->RCR = 0;
+  TIM1->ARR = ditherPattern[TIM1_DITHER_LEN - 2];
+  TIM1->EGR = TIM_EGR_UG;              // the last two periods of the pattern
+  TIM1->ARR = ditherPattern[TIM1_DITHER_LEN - 1];   // go first
+  TIM1->SR = ~TIM_SR_UIF;
+  hdmaTim1Up.XferCpltCallback = tim1DitherDMACplt;
+  hdmaTim1Up.Instance->CR |= DMA_SxCR_CIRC;
+  if(HAL_DMA_Start_IT(&hdmaTim1Up, (uint32_t)ditherPattern, (uint32_t)&TIM1->ARR,
+                      TIM1_DITHER_LEN) != HAL_OK)
+  {
+    Error_Handler();
+  }
+  TIM1->DIER |= TIM_DIER_UDE;
+  
+  HAL_SuspendTick();
+  tim1Start();
+  while(!burstEnd)
+  {
+    __WFI();
+  }
+  HAL_ResumeTick();
+  
+  HAL_DMA_Abort(&hdmaTim1Up);
+  hdmaTim1Up.Instance->CR &= ~DMA_SxCR_CIRC;
+  TIM1->DIER &= ~(TIM_DIER_UIE | TIM_DIER_UDE);
+  TIM1->CR1 &= ~(TIM_CR1_OPM | TIM_CR1_URS | TIM_CR1_ARPE);
+  tim1Stop();
+  TIM1->ARR = tim1Image.ARR;
+}
+
+/**
+  * @brief  dither DMA transfer complete, one more pattern is loaded,
+  *         after the last one count the update events like tim1Wave
+  * @param  hdma : DMA handle
+  * @retval None
+  */
+static void tim1DitherDMACplt(DMA_HandleTypeDef *hdma)
+{
+  if(--ditherCycles > 0)return;
+  tim1WaveDMACplt(hdma);
+}
+
+/**
+  * @brief  prepare dither pattern of the channel, first order sigma-delta
+  *         of the fractional period, N + 1 periods are spread evenly
+  * @param  channel - from 1 to 35, or -1 if not set
+  * @retval None
+  */
+static void tim1PrepDither(int channel)
+{
+  uint32_t frac, base, extra, acc = 0;
+  
+  ditherOn = 0;
+  if(channel <= 0)return;
+  frac = PWMPeriodsFrac[channel - 1];
+  base = frac / TIM1_DITHER_LEN;        // N + 1 counts
+  extra = frac % TIM1_DITHER_LEN;       // periods of N + 2 counts
+  if(extra == 0)return;                 // integer period, plain burst
+  for(uint32_t i = 0; i < TIM1_DITHER_LEN; i++)
+  {
+    acc += extra;
+    if(acc >= TIM1_DITHER_LEN)
+    {
+      acc -= TIM1_DITHER_LEN;
+      ditherPattern[i] = base;
+    }
+    else ditherPattern[i] = base - 1;
+  }
+  ditherOn = 1;
+}
+#endif
+
+/**
+  * @brief  generate waveform from the table by hardware
+  *         Step 0 is loaded at start, step 1 is written to preload registers,
+  *         so DMA burst to ARR, RCR, CCR1 on every update event writes step
+  *         n + 2 while step n + 1 is starting. DMA transfer complete callback
+  *         leaves two update events to count: start and end of the last step.
+  * @param  table - steps made by tools/wavegen, must stay valid till return
+  *         steps - number of steps in the table
+  * @retval None
+  */
+void tim1Wave(const tim1Step_t* table, uint32_t steps)
+{
+  if(steps == 0)return;
+  burstChunks = (steps > 2) ? 0 : steps;
+  burstEnd = 0;
+  
+  TIM1->CR1 |= TIM_CR1_URS | TIM_CR1_ARPE;
+  TIM1->ARR = table[0].ARR;
+  TIM1->RCR = table[0].RCR;
+  TIM1->CCR1 = table[0].CCR1;
+  TIM1->EGR = TIM_EGR_UG;              // step 0 at once, no DMA request
+  if(steps > 1)
+  {
+    TIM1->ARR = table[1].ARR;
+    TIM1->RCR = table[1].RCR;
+    TIM1->CCR1 = table[1].CCR1;
+  }
+  if(burstChunks == 1)TIM1->CR1 |= TIM_CR1_OPM;
+  TIM1->SR = ~TIM_SR_UIF;
+  if(steps > 2)
+  {
+    hdmaTim1Up.XferCpltCallback = tim1WaveDMACplt;
+    TIM1->DCR = TIM_DMABASE_ARR | TIM_DMABURSTLENGTH_3TRANSFERS;
+    if(HAL_DMA_Start_IT(&hdmaTim1Up, (uint32_t)&table[2], (uint32_t)&TIM1->DMAR,
+                        (steps - 2)*3) != HAL_OK)
+    {
+      Error_Handler();
+    }
+    TIM1->DIER |= TIM_DIER_UDE;
+  }
+  else TIM1->DIER |= TIM_DIER_UIE;
+  
+  HAL_SuspendTick();
+  tim1Start();
+  while(!burstEnd)
+  {
+    __WFI();
+  }
+  HAL_ResumeTick();
+  
+  TIM1->DIER &= ~(TIM_DIER_UIE | TIM_DIER_UDE);
+  TIM1->DCR = 0;
+  TIM1->CR1 &= ~(TIM_CR1_OPM | TIM_CR1_URS | TIM_CR1_ARPE);
+  TIM1->RCR = 0;
+  tim1Stop();
+}
+
+/**
+  * @brief  make waveform table of the burst with telemetry frame (common/telem.h)
+  *         Tone of the channel, in the gap slot of every symbol CCR1 is above
+  *         ARR, so the outputs stay in the same state as between bursts.
+  *         The tail of tone keeps the burst length, the frame is sent whole
+  *         even if the burst is shorter.
+  * @param  table - TIM1_TELEM_STEPS steps
+  *         ms - burst length in ms, rounded to whole PWM periods
+  *         data - 24 bit word made by telemPack
+  * @retval number of steps for tim1Wave
+  */
+uint32_t tim1Telem(tim1Step_t* table, uint32_t ms, uint32_t data)
+{
+  uint32_t periods = (ms * (SystemCoreClock/1000UL)) / ((FREQ_PSC + 1) * (tim1Image.ARR + 1));
+  uint32_t steps;
+  
+  steps = tim1AddSteps(table, 0, TELEM_PREAMBLE_PERIODS, tim1Image.CCR1);
+  for(uint32_t symbol = 0; symbol < TELEM_SYMBOLS; symbol++)
+  {
+    uint32_t gap = TELEM_GAP(data, symbol);
+    steps = tim1AddSteps(table, steps, gap*TELEM_SLOT_PERIODS, tim1Image.CCR1);
+    steps = tim1AddSteps(table, steps, TELEM_SLOT_PERIODS, tim1Image.ARR + 1);
+    steps = tim1AddSteps(table, steps, (TELEM_SLOTS - 1 - gap)*TELEM_SLOT_PERIODS,
+                         tim1Image.CCR1);
+  }
+  if(periods > TELEM_FRAME_PERIODS)
+  {
+    steps = tim1AddSteps(table, steps, periods - TELEM_FRAME_PERIODS, tim1Image.CCR1);
+  }
+  return steps;
+}
+
+/**
+  * @brief  add periods with pulse ccr1 to the waveform table,
+  *         the last step is extended if it has the same pulse
+  * @param  table - waveform table
+  *         steps - number of steps in the table
+  *         periods - number of PWM periods to add
+  *         ccr1 - pulse
+  * @retval number of steps in the table
+  */
+static uint32_t tim1AddSteps(tim1Step_t* table, uint32_t steps, uint32_t periods, uint32_t ccr1)
+{
+  while(periods > 0)
+  {
+    tim1Step_t* step = (steps > 0) ? &table[steps - 1] : NULL;
+    uint32_t n;
+    
+    if((step != NULL)&&(step->CCR1 == ccr1)&&(step->RCR < MAX_REPETITION - 1))
+    {
+      n = MAX_REPETITION - 1 - step->RCR;
+      if(n > periods)n = periods;
+      step->RCR += n;
+    }
+    else
+    {
+      if(steps >= TIM1_TELEM_STEPS)Error_Handler();
+      step = &table[steps++];
+      n = (periods > MAX_REPETITION) ? MAX_REPETITION : periods;
+      step->ARR = tim1Image.ARR;
+      step->RCR = n - 1;
+      step->CCR1 = ccr1;
+    }
+    periods -= n;
+  }
+  return steps;
+}
+
+/**
+  * @brief  waveform DMA transfer complete, the last step is in preload
+  *         registers, count the update events of its start and end
+  * @param  hdma : DMA handle
+  * @retval None
+  */
+static void tim1WaveDMACplt(DMA_HandleTypeDef *hdma)
+{
+  TIM1->DIER &= ~TIM_DIER_UDE;
+  burstChunks = 2;
+  TIM1->SR = ~TIM_SR_UIF;
+  TIM1->DIER |= TIM_DIER_UIE;
+}
+
+/**
+  * @brief  Period elapsed callback, end of a repetition counter cycle
+  * @param  htim : TIM handle
+  * @retval None
+  */
+void HAL_TIM_PeriodElapsedCallback(TIM_HandleTypeDef *htim)
+{
+  if(htim->Instance != TIM1)return;
+  if(burstChunks > 0)burstChunks--;
+  if(burstChunks == 1)TIM1->CR1 |= TIM_CR1_OPM;  // last cycle, stop at its end
+  if(burstChunks == 0)
+  {
+    TIM1->BDTR &= ~TIM_BDTR_MOE;               // outputs to idle state at once
+    burstEnd = 1;
+  }
 }
 
 /**
   * @brief  set period 
+  *         loads register image prepared by tim1Init, no HAL re-init
   * @param  None
   * @retval 1 sucsess
   */
 int period;
 uint8_t tim1SetPeriod(void)
 {
-  period = eepromGetChannel();
-  if(period > 0)period = PWMPeriods[period - 1];
-  else period = MAX_PERIOD_VALUE;
-  
   if(TimHandle.Instance != TIM1)return 0;
-  TimHandle.Init.Period            = period;
-  if(HAL_TIM_PWM_Init(&TimHandle) != HAL_OK)
-  {
-    /* Initialization Error */
-    Error_Handler(); 
-  }
-  /* Set the pulse value for channel 1 */
-  sPWMConfig.Pulse = period/2;  
-  if(HAL_TIM_PWM_ConfigChannel(&TimHandle, &sPWMConfig, TIM_CHANNEL_1) != HAL_OK)
-  {
-    /* Configuration Error */
-    Error_Handler(); 
-  }
+  TIM1->ARR = tim1Image.ARR;
+  TIM1->CCR1 = tim1Image.CCR1;
+  TIM1->BDTR = tim1Image.BDTR;
+  TIM1->EGR = TIM_EGR_UG;          // load preloaded CCR1 at once
   return 1;
 }
+/**
+  * @brief  prepare register image of the channel from EEPROM
+  * @param  None
+  * @retval None
+  */
+static void tim1PrepImage(void)
+{
+  int channel = eepromGetChannel();
+  
+  if(channel > 0)period = PWMPeriods[channel - 1];
+  else period = MAX_PERIOD_VALUE;
+  
+  tim1Image.ARR = period;
+  tim1Image.CCR1 = period/2;
+  tim1Image.BDTR = TIM1_BDTR;
+  tim1Image.CCER = TIM1_CCER;
+#ifdef TIM1_DITHER
+  tim1PrepDither(channel);
+#endif
+}
+
 /**
   * @brief  temer deinitialization
   * @param  None
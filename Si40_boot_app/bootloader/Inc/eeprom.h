@@ -49,7 +49,14 @@ int eepromGetChannel(void);
   * @retval String with frequency, or with error
   *          
   */
-char* eepromFreqString(int channel);
+const char* eepromFreqString(int channel);
+/**
+  * @brief  returns frequency of the timer for the channel
+  *
+  * @param  Channel number Channel from 1 to 35 
+  * @retval frequency in mHz, 0 if no channel
+  */
+uint32_t eepromFreqTimer(int channel);
 
  /**
   * @brief  prepare buffer for entering ID mode
@@ -127,4 +134,29 @@ char* eepromIDString(int id);
   */
 char* eepromChannelString(int channel);
 
+/**
+  * @brief  prepare buffer for entering schedule mode
+  *
+  * @param  None
+  * @retval None
+  */
+void eepromSchedModePrep(void);
+/**
+  * @brief  mode for entring ping schedule, hex words made by tools/schedc
+  *             8 digits per word without separators, then return
+  *             check the schedule and write into EEPROM
+  * @param  data from terminal, hex digits, other characters are skipped
+  * @retval -1 exit from mode with error
+  *          0 stay in mode 
+  *          1 exit from mode with new schedule
+  */
+int eepromEnterSched(unsigned char data);
+/**
+  * @brief  check ping schedule in eeprom
+  *
+  * @param  None
+  * @retval -1 no schedule, application uses built in one
+  *          0 schedule is loaded
+  */
+int eepromIsSched(void);
 #endif /* __EEPROM_H */
@@ -60,4 +60,17 @@ void gpioPWROff(void);
 void gpioRedLEDOff(void);
 void gpioRedLEDOn(void);
 void gpioRedLEDToggle(void);
+/**
+  * @brief  blink red LED (PA8, TIM1_CH1) by TIM1 output compare toggle,
+  *         no CPU is needed, it goes on in Sleep mode
+  * @param  halfPeriod - time between toggles in ms, from 1 to 32767
+  * @retval None
+  */
+void gpioRedLEDBlink(uint32_t halfPeriod);
+/**
+  * @brief  stop blinking, PA8 is GPIO output again, LED off
+  * @param  None
+  * @retval None
+  */
+void gpioRedLEDBlinkStop(void);
 #endif /* __GPIO_H */
@@ -8,6 +8,8 @@
 /* Includes ------------------------------------------------------------------*/
 #include "eeprom.h"
 #include "flash.h"
+#include "sched.h"
+#include "freqplan.h"
 
 /** @addtogroup ENTERID
   * @{
@@ -22,6 +24,7 @@ typedef struct
   uint32_t IDCheck;
   uint32_t ChannelCheck;
   uint32_t ModeCheck;
+  sched_t Sched;
 } param_t;
 typedef union
 {
@@ -38,6 +41,8 @@ eeprom_t eeprom;
 static uint8_t IDBuffer[ID_SIZE];
 static uint8_t chBuffer[CH_SIZE];
 static uint8_t mode;
+static sched_t schedBuffer;
+static uint32_t schedDigits;
 /* Private function prototypes -----------------------------------------------*/
 /**
   * @brief  write device ID to eeprom
@@ -63,6 +68,14 @@ int writeChannel(uint32_t channel);
   *         0 - success
   */
 int writeMode(uint32_t mode);
+/**
+  * @brief  write ping schedule to eeprom
+  *
+  * @param  sched - checked schedule
+  * @retval -1 error during writing
+  *         0 - success
+  */
+int writeSched(const sched_t* sched);
 
 /* Public functions ----------------------------------------------------------*/
 
@@ -191,49 +204,31 @@ int eepromGetChannel(void)
   * @retval String with frequency, or with error
   *          
   */
-char freq [][8] ={{"no freq"},   // 0
-                  {"43600Hz"},  // 1
-                  {"43800Hz"},   // 2
-                  {"44000Hz"},  // 3
-                  {"44200Hz"},  // 4
-                  {"44400Hz"},  // 5
-                  {"44600Hz"},  // 6
-                  {"44800Hz"},  // 77
-                  {"45000Hz"},  // 8
-                  {"45200Hz"},  // 9
-                  {"45400Hz"},  // 10
-                  {"45600Hz"},  // 11
-                  {"45800Hz"},  // 12
-                  {"46000Hz"},  // 13 
-                  {"46200Hz"},  // 14
-                  {"46400Hz"},  // 15
-                  {"46600Hz"},  // 16 
-                  {"46800Hz"},  // 17
-                  {"47000Hz"},  // 18
-                  {"47200Hz"},  // 19
-                  {"47400Hz"},  // 20
-                  {"47600Hz"},  // 21
-                  {"47800Hz"},  // 22
-                  {"48000Hz"},  // 23
-                  {"48200Hz"},  // 24
-                  {"48400Hz"},  // 25
-                  {"48600Hz"},  // 26
-                  {"48800Hz"},  // 27
-                  {"49000Hz"},  // 28
-                  {"49200Hz"},  // 29
-                  {"49400Hz"},  // 30
-                  {"43200Hz"},  // 31
-                  {"43100Hz"},  // 32
-                  {"43000Hz"},  // 33
-                  {"43300Hz"},  // 34
-                  {"43400Hz"}}; // 35
+#define FREQ_STRING_ITEM(ch, hz)  [ch] = FREQ_STRING(hz),
+static const char freq [][8] = {[0] = "no freq", FREQ_PLAN(FREQ_STRING_ITEM)};
 
-char errorChannel [] = {"No frequency"};
-char* eepromFreqString(int channel)
+static const char errorChannel [] = {"No frequency"};
+const char* eepromFreqString(int channel)
 {
-  if((channel > 0)&&(channel < 36)) return freq[channel];
+  if((channel > 0)&&(channel <= FREQ_CHANNELS)) return freq[channel];
   else return errorChannel;
 }
+
+/**
+  * @brief  returns frequency of the timer for the channel,
+  *         differs from the string by rounding of the period
+  *
+  * @param  Channel number Channel from 1 to 35 
+  * @retval frequency in mHz, 0 if no channel
+  */
+#define FREQ_TIMER_ITEM(ch, hz)  [ch] = FREQ_ACTUAL_MHZ(FREQ_PERIOD(hz)),
+static const uint32_t freqTimer [] = {[0] = 0, FREQ_PLAN(FREQ_TIMER_ITEM)};
+
+uint32_t eepromFreqTimer(int channel)
+{
+  if((channel > 0)&&(channel <= FREQ_CHANNELS)) return freqTimer[channel];
+  else return 0;
+}
 /**
   * @brief  returns string with device ID
   *
@@ -342,6 +337,59 @@ int eepromEnterMode(unsigned char data)
   return 0;
 }
 
+/**
+  * @brief  prepare buffer for entering schedule mode
+  *
+  * @param  None
+  * @retval None
+  */
+void eepromSchedModePrep(void)
+{
+  schedDigits = 0;
+}
+/**
+  * @brief  mode for entring ping schedule, hex words made by tools/schedc
+  *             8 digits per word without separators, then return
+  *             check the schedule and write into EEPROM
+  * @param  data from terminal, hex digits, other characters are skipped
+  * @retval -1 exit from mode with error
+  *          0 stay in mode 
+  *          1 exit from mode with new schedule
+  */
+int eepromEnterSched(unsigned char data)
+{
+  uint32_t* word = (uint32_t*)&schedBuffer;
+  uint32_t nibble;
+
+  if((data == '\r')||(data == '\n')) //enter new schedule
+  {
+    if(schedDigits != SCHED_WORDS*8)return -1;
+    if(schedCheck(&schedBuffer) != 0)return -1;
+    if(writeSched(&schedBuffer) < 0)return -1;
+    return 1;
+  }
+  if((data >= '0')&&(data <= '9'))nibble = data - '0';
+  else if((data >= 'a')&&(data <= 'f'))nibble = data - 'a' + 10;
+  else if((data >= 'A')&&(data <= 'F'))nibble = data - 'A' + 10;
+  else return 0;
+  if(schedDigits >= SCHED_WORDS*8)return -1;
+  word[schedDigits/8] = (word[schedDigits/8] << 4) | nibble;
+  schedDigits++;
+  return 0;
+}
+/**
+  * @brief  check ping schedule in eeprom
+  *
+  * @param  None
+  * @retval -1 no schedule, application uses built in one
+  *          0 schedule is loaded
+  */
+int eepromIsSched(void)
+{
+  if(flashReadEEPROM(eeprom.eeprom , sizeof(eeprom)/sizeof(uint32_t)) != 0)return -1;
+  return schedCheck(&eeprom.param.Sched);
+}
+
 /* Private functions ---------------------------------------------------------*/
 /**
   * @brief  write device ID to eeprom
@@ -389,6 +437,20 @@ int writeMode(uint32_t inpMode)
   if(flashWriteEEPROM(eeprom.eeprom , sizeof(eeprom)/sizeof(uint32_t)) != 0)return -1;
   return 0;
 }
+/**
+  * @brief  write ping schedule to eeprom
+  *
+  * @param  sched - checked schedule
+  * @retval -1 error during writing
+  *         0 - success
+  */
+int writeSched(const sched_t* sched)
+{
+  if(flashReadEEPROM(eeprom.eeprom , sizeof(eeprom)/sizeof(uint32_t)) != 0)return -1;
+  eeprom.param.Sched = *sched;
+  if(flashWriteEEPROM(eeprom.eeprom , sizeof(eeprom)/sizeof(uint32_t)) != 0)return -1;
+  return 0;
+}
 /**
   * @brief  
   * @param  None
@@ -8,15 +8,19 @@
 /* Includes ------------------------------------------------------------------*/
 #include "gpio.h"
 
+extern void _Error_Handler(char *, int);
+
 /** @addtogroup GPIO
   * @{
   */ 
 
 /* Private typedef -----------------------------------------------------------*/
 /* Private define ------------------------------------------------------------*/
+#define BLINK_CNT_CLK   2000U       // TIM1 counter clock for LED blink, Hz
 /* Private macro -------------------------------------------------------------*/
 /* Private variables ---------------------------------------------------------*/
 static GPIO_InitTypeDef  GPIO_InitStruct;
+static TIM_HandleTypeDef blinkHandle;
 
 /* Private function prototypes -----------------------------------------------*/
 
@@ -123,6 +127,72 @@ void gpioRedLEDToggle(void)
   HAL_GPIO_TogglePin(GPIOA, GPIO_PIN_8);
 }
 
+/**
+  * @brief  blink red LED (PA8, TIM1_CH1) by TIM1 output compare toggle,
+  *         no CPU is needed, it goes on in Sleep mode
+  * @param  halfPeriod - time between toggles in ms, from 1 to 32767
+  * @retval None
+  */
+void gpioRedLEDBlink(uint32_t halfPeriod)
+{
+  TIM_OC_InitTypeDef sConfig;
+  uint32_t timClk = HAL_RCC_GetPCLK2Freq();
+
+  /* TIM1 clock is 2*PCLK2 if APB2 is divided */
+  if((RCC->CFGR & RCC_CFGR_PPRE2) != RCC_HCLK_DIV1)timClk *= 2;
+  __HAL_RCC_TIM1_CLK_ENABLE();
+  GPIO_InitStruct.Pin = GPIO_PIN_8;
+  GPIO_InitStruct.Mode = GPIO_MODE_AF_PP;
+  GPIO_InitStruct.Pull = GPIO_NOPULL;
+  GPIO_InitStruct.Speed = GPIO_SPEED_LOW;
+  GPIO_InitStruct.Alternate = GPIO_AF1_TIM1;
+  HAL_GPIO_Init(GPIOA, &GPIO_InitStruct);
+
+  blinkHandle.Instance = TIM1;
+  blinkHandle.Init.Prescaler = timClk/BLINK_CNT_CLK - 1;
+  blinkHandle.Init.Period = halfPeriod*(BLINK_CNT_CLK/1000) - 1;
+  blinkHandle.Init.ClockDivision = TIM_CLOCKDIVISION_DIV1;
+  blinkHandle.Init.CounterMode = TIM_COUNTERMODE_UP;
+  blinkHandle.Init.RepetitionCounter = 0;
+  if(HAL_TIM_OC_Init(&blinkHandle) != HAL_OK)
+  {
+    _Error_Handler(__FILE__, __LINE__);
+  }
+  sConfig.OCMode = TIM_OCMODE_TOGGLE;
+  sConfig.Pulse = 0;
+  sConfig.OCPolarity = TIM_OCPOLARITY_HIGH;
+  sConfig.OCNPolarity = TIM_OCNPOLARITY_HIGH;
+  sConfig.OCFastMode = TIM_OCFAST_DISABLE;
+  sConfig.OCIdleState = TIM_OCIDLESTATE_RESET;
+  sConfig.OCNIdleState = TIM_OCNIDLESTATE_RESET;
+  if(HAL_TIM_OC_ConfigChannel(&blinkHandle, &sConfig, TIM_CHANNEL_1) != HAL_OK)
+  {
+    _Error_Handler(__FILE__, __LINE__);
+  }
+  if(HAL_TIM_OC_Start(&blinkHandle, TIM_CHANNEL_1) != HAL_OK)  // sets MOE
+  {
+    _Error_Handler(__FILE__, __LINE__);
+  }
+}
+
+/**
+  * @brief  stop blinking, PA8 is GPIO output again, LED off
+  * @param  None
+  * @retval None
+  */
+void gpioRedLEDBlinkStop(void)
+{
+  HAL_TIM_OC_Stop(&blinkHandle, TIM_CHANNEL_1);
+  HAL_TIM_OC_DeInit(&blinkHandle);
+  __HAL_RCC_TIM1_CLK_DISABLE();
+  GPIO_InitStruct.Pin = GPIO_PIN_8;
+  GPIO_InitStruct.Mode = GPIO_MODE_OUTPUT_PP;
+  GPIO_InitStruct.Pull = GPIO_PULLUP;
+  GPIO_InitStruct.Speed = GPIO_SPEED_FAST;
+  HAL_GPIO_Init(GPIOA, &GPIO_InitStruct);
+  gpioRedLEDOff();
+}
+
 
 /* Private functions ---------------------------------------------------------*/
 
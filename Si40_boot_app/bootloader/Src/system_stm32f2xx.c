@@ -61,6 +61,7 @@
   */
 
 #include "stm32f2xx.h"
+#include "trace.h"
 
 #if !defined  (HSE_VALUE) 
   #define HSE_VALUE    ((uint32_t)25000000) /*!< Default value of the External oscillator in Hz */
@@ -95,6 +96,11 @@
 /* #define VECT_TAB_SRAM */
 #define VECT_TAB_OFFSET  0x00 /*!< Vector Table base offset field. 
                                    This value must be a multiple of 0x200. */
+
+/*!< Comment the following line to handle standby wake in main() after
+     HAL_Init(), as it was before. With the line the application is started
+     from SystemInit() before C runtime init and any clock setup. */
+#define STANDBY_FAST_WAKE
 /******************************************************************************/
 
 /**
@@ -135,6 +141,9 @@
 #ifdef DATA_IN_ExtSRAM
   static void SystemInit_ExtMemCtl(void); 
 #endif /* DATA_IN_ExtSRAM */
+#ifdef STANDBY_FAST_WAKE
+  static void SystemInit_StandbyWake(void);
+#endif /* STANDBY_FAST_WAKE */
 
 /**
   * @}
@@ -153,6 +162,10 @@
   */
 void SystemInit(void)
 {
+#ifdef STANDBY_FAST_WAKE
+  SystemInit_StandbyWake();
+#endif /* STANDBY_FAST_WAKE */
+
   /* Reset the RCC clock configuration to the default reset state ------------*/
   /* Set HSION bit */
   RCC->CR |= (uint32_t)0x00000001;
@@ -347,6 +360,41 @@ void SystemInit_ExtMemCtl(void)
 }
 #endif /* DATA_IN_ExtSRAM */
 
+#ifdef STANDBY_FAST_WAKE
+/**
+  * @brief  Start the application right after wake up from standby.
+  *         Called in startup_stm32f2xx.s before __iar_program_start, so
+  *         global variables are not initialized yet and are not used here.
+  *         RCC is in reset state (HSI 16 MHz), HAL and clock init is left
+  *         to the application. After reset or power on, after an IWDG
+  *         reset and when there is no valid application stack pointer,
+  *         returns to SystemInit().
+  * @param  None
+  * @retval None
+  */
+static void SystemInit_StandbyWake(void)
+{
+  extern const uint32_t app_vector;   /* Application vector address symbol from linker */
+  const uint32_t *vector = &app_vector;
+  uint32_t stack, entry;
+
+  RCC->APB1ENR |= RCC_APB1ENR_PWREN;
+  (void)RCC->APB1ENR;                 /* delay after PWR clock enable */
+  if((PWR->CSR & PWR_CSR_SBF) == 0)return;
+  /* IWDG reset in standby keeps SBF, it is a fault for wdgBoot() */
+  if((RCC->CSR & RCC_CSR_IWDGRSTF) != 0)return;
+  stack = vector[0];
+  entry = vector[1];
+  if((stack & 0x2FFE0000UL) != SRAM_BASE)return;
+  PWR->CR |= PWR_CR_CSBF;
+
+  traceInit();
+  traceStart();                       /* cycles are counted from here to application main() */
+  SCB->VTOR = (uint32_t)vector;
+  __set_MSP(stack);
+  ((void (*)(void))entry)();
+}
+#endif /* STANDBY_FAST_WAKE */
 
 /**
   * @}
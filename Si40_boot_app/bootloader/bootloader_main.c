@@ -27,6 +27,10 @@
 #include "intrinsics.h"
 #include "crc.h"
 #include "alarm.h"
+#include "trace.h"
+#include "evlog.h"
+#include "bkpsram.h"
+#include "wdg.h"
 
 #define MAX_DOWNLOADED_KBYTES 16
 #define MAX_DOWNLOAD_BYTES   (1024 * MAX_DOWNLOADED_KBYTES)
@@ -40,6 +44,12 @@
 #define APP_SUMM      (APP_VER + APP_SUB_VER + APP_BUILD)
 #define SWITCH_APP1      1000                                 //delay after switching on
 #define SWITCH_APP2      (180UL*1000)                           //delay after pressing key
+#define FAST_BOOT                                             //comment to return to fixed boot delays
+#define SWITCH_APP1_FAST 150                                  //key window in fast boot mode
+#define PWR_READY_TIMEOUT 500                                 //max wait for supply in fast boot mode
+#define PWR_READY_LEVEL  PWR_PVDLEVEL_6                       //supply threshold, ~2.8V
+#define SERVICE_LOW_POWER                                     //comment to run the window at 120 MHz, polling
+#define LED_BLINK        500                                  //red LED toggle period, ms
 
 
 /* Private typedef -----------------------------------------------------------*/
@@ -64,6 +74,7 @@ typedef enum
   enterIDMode,
   enterChMode,
   enterModeMode,
+  enterSchedMode,
 } inputMode_t;
 
 typedef union
@@ -97,8 +108,13 @@ uint8_t debugDataptr = 0;
 void SystemClock_Config(void);
 static void MX_NVIC_Init(void);
 static void printDevInfo(void);
+static void printTrace(void);
+static void sendEvlog(void);
 static void goToApp(void);
 static void goToAppQuick(void);
+static void pwrReadyInit(void);
+static uint8_t pwrIsReady(void);
+static void pwrWaitReady(uint32_t timeout);
 int inbyte(unsigned short);
 void outbyte(int);
 
@@ -114,28 +130,43 @@ int main(void)
 {
     
    /* MCU Configuration----------------------------------------------------------*/
+  traceInit();
+  traceStart();
 
   /* Reset of all peripherals, Initializes the Flash interface and the Systick. */
   HAL_Init();
+  traceMark(TRACE_HAL_INIT);
 
   //for(uint32_t i = 0; i < MAX_DOWNLOAD_BYTES/4; i++)buffer.forFlash[i] = 0x33;
 
-  /* Configure the system clock */
-  SystemClock_Config();
-  
   /* Enable Power Clock */
   __HAL_RCC_PWR_CLK_ENABLE();
   
-  /* Check and handle if the system was resumed from StandBy mode */ 
+  /* Check and handle if the system was resumed from StandBy mode,
+     application is started from HSI, it starts PLL only for the burst.
+     With STANDBY_FAST_WAKE (system_stm32f2xx.c) it is done in SystemInit() */ 
   if(__HAL_PWR_GET_FLAG(PWR_FLAG_SB) != RESET)
   {
     __HAL_PWR_CLEAR_FLAG(PWR_FLAG_SB);
-    goToAppQuick();
+    /* IWDG reset in standby keeps SB flag, it is a fault, not a wake */
+    if(__HAL_RCC_GET_FLAG(RCC_FLAG_IWDGRST) == RESET)goToAppQuick();
     
   }
+  uint32_t faults = wdgBoot();
+  wdgStart();
+
+  /* Configure the system clock */
+  SystemClock_Config();
+  traceMark(TRACE_CLOCK);
+#ifdef FAST_BOOT
+  pwrReadyInit();
+  pwrWaitReady(PWR_READY_TIMEOUT); //wait power to stabilaze, but no longer than needed
+#else
   HAL_Delay(500); //wait power to stabilaze
+#endif
   
   gpioInit();
+  traceMark(TRACE_GPIO);
   gpioPWROn();
   uartInit(4800);
   xmodenInit(inbyte,outbyte);
@@ -148,12 +179,22 @@ int main(void)
   gpioLEDOn();
   gpioRedLEDOn();
   HAL_Delay(10);   
+#ifdef FAST_BOOT
+  alarmSet(SWITCH_APP1_FAST);
+  //banner takes ~0.4s at 4800 baud, it is printed on 'p' instead
+#else
   alarmSet(SWITCH_APP1);
-  alarmToggleSet(500);
 
   /* Output a message on Hyperterminal using printf function */
   printf("\n\r Start bootloader software");
   printDevInfo();
+#endif
+  if(faults >= WDG_MAX_FAULTS)alarmSet(SWITCH_APP2);  // application fails, wait for service
+#ifdef SERVICE_LOW_POWER
+  gpioRedLEDBlink(LED_BLINK);
+#else
+  alarmToggleSet(LED_BLINK);
+#endif
   //printf(" Press h for help\n\r"); 
   gpioRxEn();
   HAL_Delay(10);
@@ -163,7 +204,7 @@ int main(void)
 
   while (1)
   {
-
+    wdgKick();
     if(uartIsData())
     {      
       data = uartGetData();
@@ -247,6 +288,7 @@ int main(void)
           case 'j':         //jump from bootloader to application
             xmodemResult = crcCompare((uint32_t*)&app_vector, MAX_DOWNLOAD_BYTES/4 - 1, *(uint32_t*)(&app_vector + MAX_DOWNLOAD_BYTES/4 - 1));
             appVer.uiVer = *(uint32_t*)(&app_vector + MAX_DOWNLOAD_BYTES/4 - 2);
+            traceMark(TRACE_CRC);
             if((xmodemResult == 0)&&(APP_CHECK == APP_SUMM))
             {
               goToApp();
@@ -267,8 +309,17 @@ int main(void)
             //printf("\n\r Enter mode - 1(FAST), 2(NORMAL), 3(SLOW), then press return.\n\r");
             mode = enterModeMode;
             break;
+          case 's':
+            //printf("\n\r Paste schedule from schedc, then press return.\n\r");
+            eepromSchedModePrep();
+            mode = enterSchedMode;
+            break;
           case 'p':
             printDevInfo();
+            printTrace();
+            break;  
+          case 'e':
+            sendEvlog();
             break;  
           case 'h':
             printf("\n\r d - Download image");
@@ -276,7 +327,9 @@ int main(void)
             printf("\n\r i - Enter Device ID");
             printf("\n\r m - Enter mode");
             printf("\n\r c - Enter channel");
-            printf("\n\r p - Print device information");
+            printf("\n\r s - Enter ping schedule");
+            printf("\n\r p - Print device information and trace");
+            printf("\n\r e - Send event log, binary");
             printf("\n\r return - check connection\n\r");
             break;
           case '\n':
@@ -331,12 +384,32 @@ int main(void)
         }        
         
       }
+      else if (mode == enterSchedMode)
+      {
+        int val = eepromEnterSched(data);
+        if( val == -1) //
+        {
+          mode = initialMode;
+          printf("\n\r Error. \n\r");
+        }
+        if(val == 1)
+        {
+          mode = initialMode;
+          printf("\n\r New ping schedule is loaded.\n\r");
+        }        
+      }
       gpioRxEn();
       HAL_Delay(10);
       uartStartRX(); 
     }
     if(alarmIsAlarm())goToApp();
+#ifdef SERVICE_LOW_POWER
+    /* wait for USART1 RXNE or SysTick, a byte got between the check and
+       WFI waits for the next tick, 1 ms */
+    if(!uartIsData())HAL_PWR_EnterSLEEPMode(PWR_MAINREGULATOR_ON, PWR_SLEEPENTRY_WFI);
+#else
     if(alarmIsToggle())gpioRedLEDToggle();
+#endif
   }
 }
 
@@ -357,11 +430,41 @@ int main(void)
   *            PLL_Q                          = 5
   *            VDD(V)                         = 3.3
   *            Flash Latency(WS)              = 3
+  *         With SERVICE_LOW_POWER:
+  *            System Clock source            = HSE, PLL off
+  *            SYSCLK = HCLK = PCLK1 = PCLK2  = 8000000
+  *            Flash Latency(WS)              = 0
+  *         Crystal clock keeps UART baud rate in tolerance, flash write
+  *         doesn't depend on the clock (voltage range 3).
   * @param  None
   * @retval None
   */
 void SystemClock_Config(void)
 {
+#ifdef SERVICE_LOW_POWER
+  RCC_OscInitTypeDef RCC_OscInitStruct;
+  RCC_ClkInitTypeDef RCC_ClkInitStruct;
+
+  RCC_OscInitStruct.OscillatorType = RCC_OSCILLATORTYPE_HSE;
+  RCC_OscInitStruct.HSEState = RCC_HSE_ON;
+  RCC_OscInitStruct.PLL.PLLState = RCC_PLL_OFF;
+  if (HAL_RCC_OscConfig(&RCC_OscInitStruct) != HAL_OK)
+  {
+    _Error_Handler(__FILE__, __LINE__);
+  }
+
+  RCC_ClkInitStruct.ClockType = RCC_CLOCKTYPE_HCLK|RCC_CLOCKTYPE_SYSCLK
+                              |RCC_CLOCKTYPE_PCLK1|RCC_CLOCKTYPE_PCLK2;
+  RCC_ClkInitStruct.SYSCLKSource = RCC_SYSCLKSOURCE_HSE;
+  RCC_ClkInitStruct.AHBCLKDivider = RCC_SYSCLK_DIV1;
+  RCC_ClkInitStruct.APB1CLKDivider = RCC_HCLK_DIV1;
+  RCC_ClkInitStruct.APB2CLKDivider = RCC_HCLK_DIV1;
+
+  if (HAL_RCC_ClockConfig(&RCC_ClkInitStruct, FLASH_LATENCY_0) != HAL_OK)
+  {
+    _Error_Handler(__FILE__, __LINE__);
+  }
+#else
 
   RCC_OscInitTypeDef RCC_OscInitStruct;
   RCC_ClkInitTypeDef RCC_ClkInitStruct;
@@ -393,6 +496,7 @@ void SystemClock_Config(void)
   {
     _Error_Handler(__FILE__, __LINE__);
   }
+#endif
 }
 
 
@@ -405,12 +509,14 @@ void SystemClock_Config(void)
   */
 int inbyte(unsigned short timeout)
 {
+  wdgKick();        // xmodem download is longer than IWDG timeout
   return (uartStartRXBlock(timeout));
 }
 
 void outbyte(int c)
 {
   uint8_t outData = c;
+  wdgKick();
   uartStartTXBlock(outData);
 }
 
@@ -427,6 +533,8 @@ void printDevInfo(void)
   {
     printf(" Channel %s.\n\r",eepromChannelString(Channel));
     printf(" Frequency %s.\n\r",eepromFreqString(Channel));
+    uint32_t timer = eepromFreqTimer(Channel);
+    printf(" Timer frequency %d.%03dHz.\n\r", (int)(timer/1000), (int)(timer%1000));
   }
   if((Channel > 0)&&(Channel < 31))
   {
@@ -438,6 +546,8 @@ void printDevInfo(void)
   {
     printf(" %s mode .\n\r", eepromModeString(4));
   }
+  if(eepromIsSched() == 0) printf(" Ping schedule is loaded.\n\r");
+  else printf(" Ping schedule is built in.\n\r");
   appVer.uiVer = *(uint32_t*)(&app_vector + MAX_DOWNLOAD_BYTES/4 - 1);  //reading 
   printf("\n\r Bootloader version %d.%d build %d.\n\r", BOOT_VER, BOOT_SUB_VER, BOOT_BUILD);
   appVer.uiVer = *(uint32_t*)(&app_vector + MAX_DOWNLOAD_BYTES/4 - 2);
@@ -447,6 +557,57 @@ void printDevInfo(void)
     printf(" Application version %d.%d build %d.\n\r", APP_VER, APP_SUB_VER, APP_BUILD);
   }
   else printf(" Application doesn't exist.\n\r");
+  uint32_t faults, line;
+  uint8_t lastFault;
+  wdgGetRecord(&faults, &lastFault, &line);
+  if(lastFault != 0)
+  {
+    printf(" Fault resets %d, last 0x%02X line %d.\n\r", (int)faults, lastFault, (int)line);
+  }
+}
+
+/**
+  * @brief  print trace ring, one line per checkpoint:
+  *         " T id MHz cycles", decoded on host by tools/tracedecode
+  *
+  * @retval None
+  */
+static void printTrace(void)
+{
+  traceEntry_t entry;
+  uint32_t count = traceCount();
+  
+  printf("\n\r Trace %d entries.\n\r", (int)count);
+  for(uint32_t i = 0; i < count; i++)
+  {
+    if(traceGet(i, &entry) != 0)break;
+    printf(" T %d %d %u\n\r", entry.id, entry.mhz, (unsigned int)entry.cycles);
+  }
+}
+
+/**
+  * @brief  send event log ring in binary, decoded on host by tools/evlogdec:
+  *         sync, count, entries, all LSB first. 8 bytes per wake instead of
+  *         ~30 characters of text
+  *
+  * @retval None
+  */
+static void sendEvlog(void)
+{
+  evlogEntry_t entry;
+  uint32_t count;
+  
+  bkpsramEnable();
+  count = evlogCount();
+  outbyte(EVLOG_SYNC & 0xFF);
+  outbyte(EVLOG_SYNC >> 8);
+  outbyte(count & 0xFF);
+  outbyte(count >> 8);
+  for(uint32_t i = 0; i < count; i++)
+  {
+    if(evlogGet(i, &entry) != 0)break;
+    for(uint32_t k = 0; k < sizeof(entry); k++)outbyte(((uint8_t*)&entry)[k]);
+  }
 }
 
 /**
@@ -458,13 +619,24 @@ static void goToApp(void)
 {
   printf("\n\r Exit from bootloader.\n\r");
   printf(" Go to application.\n\r");
+#ifndef FAST_BOOT
+  printf(" Boot time %d ms.\n\r", (int)HAL_GetTick());
+#endif                              // fast boot: TRACE_GO_APP of the trace on 'p'
   gpioLEDOff();
   gpioPWROff();
+#ifdef SERVICE_LOW_POWER
+  gpioRedLEDBlinkStop();            // TIM1 is used by the application
+#endif
+#ifdef FAST_BOOT
+  if(!pwrIsReady())HAL_Delay(1000); // delay for reguletion only if supply is low
+#else
   HAL_Delay(1000); // delay for reguletion 
+#endif
   uartDeInit();
   gpioDeInit();
   alarmDeInit();
   HAL_DeInit();
+  traceMark(TRACE_GO_APP);
   __disable_interrupt();              // 1. Disable interrupts
   __set_SP(vector_p->stack_addr);     // 2. Configure stack pointer
   SCB->VTOR = (uint32_t) &app_vector; // 3. Configure VTOR
@@ -478,12 +650,56 @@ static void goToApp(void)
 
 static void goToAppQuick(void)
 {
+  traceMark(TRACE_GO_APP);
   __disable_interrupt();              // 1. Disable interrupts
   __set_SP(vector_p->stack_addr);     // 2. Configure stack pointer
   SCB->VTOR = (uint32_t) &app_vector; // 3. Configure VTOR
   vector_p->func_p();                 // 4. Jump to application
 }
 
+/**
+  * @brief  start PVD to watch supply voltage
+  *
+  * @retval None
+  */
+static void pwrReadyInit(void)
+{
+  PWR_PVDTypeDef sConfigPVD;
+  
+  sConfigPVD.PVDLevel = PWR_READY_LEVEL;
+  sConfigPVD.Mode = PWR_PVD_MODE_NORMAL;
+  HAL_PWR_ConfigPVD(&sConfigPVD);
+  HAL_PWR_EnablePVD();
+}
+
+/**
+  * @brief  check supply voltage
+  *
+  * @retval 1 - supply is above PWR_READY_LEVEL
+  *         0 - supply is low
+  */
+static uint8_t pwrIsReady(void)
+{
+  if(__HAL_PWR_GET_FLAG(PWR_FLAG_PVDO) != RESET)return 0;
+  return 1;
+}
+
+/**
+  * @brief  wait until supply is above PWR_READY_LEVEL
+  * @param  timeout - max waiting time in ms
+  * @retval None
+  */
+static void pwrWaitReady(uint32_t timeout)
+{
+  uint32_t tickstart = HAL_GetTick();
+  
+  HAL_Delay(1);  //PVD output settling
+  while(!pwrIsReady())
+  {
+    if((HAL_GetTick() - tickstart) > timeout)return;
+  }
+}
+
 /**
   * @brief NVIC Configuration.
   * @retval None
@@ -518,10 +734,7 @@ void _Error_Handler(char *file, int line)
   /* User can add his own implementation to report the HAL error return state */
   errorFile = file;
   errorLine = line;
-  while(1)
-  {
-    __no_operation();
-  }
+  wdgFault(line);   // reset, bootloader counts fault resets
   /* USER CODE END Error_Handler_Debug */
 }
 
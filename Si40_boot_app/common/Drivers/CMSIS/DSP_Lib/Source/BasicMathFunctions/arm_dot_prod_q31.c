@@ -67,7 +67,7 @@
  * The return result is in 16.48 format.    
  */
 
-void arm_dot_prod_q31(
+void ARM_MATH_PORTABLE(arm_dot_prod_q31)(
   q31_t * pSrcA,
   q31_t * pSrcB,
   uint32_t blockSize,
@@ -77,7 +77,8 @@
 /*    
 * @brief  Table for bit reversal process    
 */
-const uint16_t armBitRevTable[1024] = {
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_BITREV_1024)
+const uint16_t armBitRevTable[1024] ARM_TABLE_SECTION(armBitRevTable) = {
    0x400, 0x200, 0x600, 0x100, 0x500, 0x300, 0x700, 0x80, 0x480, 0x280, 
    0x680, 0x180, 0x580, 0x380, 0x780, 0x40, 0x440, 0x240, 0x640, 0x140, 
    0x540, 0x340, 0x740, 0xc0, 0x4c0, 0x2c0, 0x6c0, 0x1c0, 0x5c0, 0x3c0, 
@@ -182,6 +183,7 @@ const uint16_t armBitRevTable[1024] = {
    0x67e, 0x17e, 0x57e, 0x37e, 0x77e, 0xfe, 0x4fe, 0x2fe, 0x6fe, 0x1fe, 
    0x5fe, 0x3fe, 0x7fe, 0x1 
 };
+#endif
 
 
 /*    
@@ -203,7 +205,8 @@ const uint16_t armBitRevTable[1024] = {
 * Cos and Sin values are in interleaved fashion    
 *     
 */
-const float32_t twiddleCoef_16[32] = {
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_TWIDDLECOEF_F32_16)
+const float32_t twiddleCoef_16[32] ARM_TABLE_SECTION(twiddleCoef_16) = {
     1.000000000f,  0.000000000f,
     0.923879533f,  0.382683432f,
     0.707106781f,  0.707106781f,
@@ -221,6 +224,7 @@ const float32_t twiddleCoef_16[32] = {
     0.707106781f, -0.707106781f,
     0.923879533f, -0.382683432f
 };
+#endif
 
 /**    
 * \par    
@@ -237,7 +241,8 @@ const float32_t twiddleCoef_16[32] = {
 * Cos and Sin values are in interleaved fashion    
 *     
 */
-const float32_t twiddleCoef_32[64] = {
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_TWIDDLECOEF_F32_32)
+const float32_t twiddleCoef_32[64] ARM_TABLE_SECTION(twiddleCoef_32) = {
     1.000000000f,  0.000000000f,
     0.980785280f,  0.195090322f,
     0.923879533f,  0.382683432f,
@@ -271,6 +276,7 @@ const float32_t twiddleCoef_32[64] = {
     0.923879533f, -0.382683432f,
     0.980785280f, -0.195090322f
 };
+#endif
 
 /**    
 * \par    
@@ -287,7 +293,8 @@ const float32_t twiddleCoef_32[64] = {
 * Cos and Sin values are in interleaved fashion    
 *     
 */
-const float32_t twiddleCoef_64[128] = {
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_TWIDDLECOEF_F32_64)
+const float32_t twiddleCoef_64[128] ARM_TABLE_SECTION(twiddleCoef_64) = {
     1.000000000f,  0.000000000f,
     0.995184727f,  0.098017140f,
     0.980785280f,  0.195090322f,
@@ -353,6 +360,7 @@ const float32_t twiddleCoef_64[128] = {
     0.980785280f, -0.195090322f,
     0.995184727f, -0.098017140f
 };
+#endif
 
 /**    
 * \par    
@@ -370,7 +378,8 @@ const float32_t twiddleCoef_64[128] = {
 *     
 */
 
-const float32_t twiddleCoef_128[256] = {
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_TWIDDLECOEF_F32_128)
+const float32_t twiddleCoef_128[256] ARM_TABLE_SECTION(twiddleCoef_128) = {
     1.000000000f	,	0.000000000f	,
     0.998795456f	,	0.049067674f	,
     0.995184727f	,	0.098017140f	,
@@ -500,6 +509,7 @@ const float32_t twiddleCoef_128[256] = {
     0.995184727f	,	-0.098017140f	,
     0.998795456f	,	-0.049067674f
 };
+#endif
 
 /**    
 * \par    
@@ -516,7 +526,8 @@ const float32_t twiddleCoef_128[256] = {
 * Cos and Sin values are in interleaved fashion    
 *     
 */
-const float32_t twiddleCoef_256[512] = {
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_TWIDDLECOEF_F32_256)
+const float32_t twiddleCoef_256[512] ARM_TABLE_SECTION(twiddleCoef_256) = {
     1.000000000f,  0.000000000f,
     0.999698819f,  0.024541229f,
     0.998795456f,  0.049067674f,
@@ -774,6 +785,7 @@ const float32_t twiddleCoef_256[512] = {
     0.998795456f, -0.049067674f,
     0.999698819f, -0.024541229f
 };
+#endif
 
 /**    
 * \par    
@@ -790,7 +802,8 @@ const float32_t twiddleCoef_256[512] = {
 * Cos and Sin values are in interleaved fashion    
 *     
 */
-const float32_t twiddleCoef_512[1024] = {
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_TWIDDLECOEF_F32_512)
+const float32_t twiddleCoef_512[1024] ARM_TABLE_SECTION(twiddleCoef_512) = {
     1.000000000f,  0.000000000f,
     0.999924702f,  0.012271538f,
     0.999698819f,  0.024541229f,
@@ -1304,6 +1317,7 @@ const float32_t twiddleCoef_512[1024] = {
     0.999698819f, -0.024541229f,
     0.999924702f, -0.012271538f
 };
+#endif
 /**    
 * \par    
 * Example code for Floating-point Twiddle factors Generation:    
@@ -1319,7 +1333,8 @@ const float32_t twiddleCoef_512[1024] = {
 * Cos and Sin values are in interleaved fashion    
 *     
 */
-const float32_t twiddleCoef_1024[2048] = {
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_TWIDDLECOEF_F32_1024)
+const float32_t twiddleCoef_1024[2048] ARM_TABLE_SECTION(twiddleCoef_1024) = {
 1.000000000f	,	0.000000000f	,
 0.999981175f	,	0.006135885f	,
 0.999924702f	,	0.012271538f	,
@@ -2345,6 +2360,7 @@ const float32_t twiddleCoef_1024[2048] = {
 0.999924702f	,	-0.012271538f	,
 0.999981175f	,	-0.006135885f
 };
+#endif
 
 /**    
 * \par    
@@ -2361,7 +2377,8 @@ const float32_t twiddleCoef_1024[2048] = {
 * Cos and Sin values are in interleaved fashion    
 *     
 */
-const float32_t twiddleCoef_2048[4096] = {
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_TWIDDLECOEF_F32_2048)
+const float32_t twiddleCoef_2048[4096] ARM_TABLE_SECTION(twiddleCoef_2048) = {
     1.000000000f,  0.000000000f,
     0.999995294f,  0.003067957f,
     0.999981175f,  0.006135885f,
@@ -4411,6 +4428,7 @@ const float32_t twiddleCoef_2048[4096] = {
     0.999981175f, -0.006135885f,
     0.999995294f, -0.003067957f
 };
+#endif
 
 /**    
 * \par    
@@ -4427,7 +4445,8 @@ const float32_t twiddleCoef_2048[4096] = {
 * Cos and Sin values are in interleaved fashion    
 *     
 */
-const float32_t twiddleCoef_4096[8192] = {
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_TWIDDLECOEF_F32_4096)
+const float32_t twiddleCoef_4096[8192] ARM_TABLE_SECTION(twiddleCoef_4096) = {
     1.000000000f,  0.000000000f,
     0.999998823f,  0.001533980f,
     0.999995294f,  0.003067957f,
@@ -8525,6 +8544,7 @@ const float32_t twiddleCoef_4096[8192] = {
     0.999995294f, -0.003067957f,
     0.999998823f, -0.001533980f
 };
+#endif
 
 /*    
 * @brief  Q31 Twiddle factors Table    
@@ -8549,7 +8569,8 @@ const float32_t twiddleCoef_4096[8192] = {
 *	round(twiddleCoefQ31(i) * pow(2, 31))    
 *    
 */
-const q31_t twiddleCoef_16_q31[24] = {
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_TWIDDLECOEF_Q31_16)
+const q31_t twiddleCoef_16_q31[24] ARM_TABLE_SECTION(twiddleCoef_16_q31) = {
     0x7FFFFFFF, 0x00000000,
     0x7641AF3C, 0x30FBC54D,
     0x5A82799A, 0x5A82799A,
@@ -8563,6 +8584,7 @@ const q31_t twiddleCoef_16_q31[24] = {
     0xA57D8666, 0xA57D8666,
     0xCF043AB2, 0x89BE50C3
 };
+#endif
 
 /**    
 * \par   
@@ -8582,7 +8604,8 @@ const q31_t twiddleCoef_16_q31[24] = {
 *	round(twiddleCoefQ31(i) * pow(2, 31))    
 *    
 */
-const q31_t twiddleCoef_32_q31[48] = {
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_TWIDDLECOEF_Q31_32)
+const q31_t twiddleCoef_32_q31[48] ARM_TABLE_SECTION(twiddleCoef_32_q31) = {
     0x7FFFFFFF, 0x00000000,
     0x7D8A5F3F, 0x18F8B83C,
     0x7641AF3C, 0x30FBC54D,
@@ -8608,6 +8631,7 @@ const q31_t twiddleCoef_32_q31[48] = {
     0xCF043AB2, 0x89BE50C3,
     0xE70747C3, 0x8275A0C0
 };
+#endif
 
 /**    
 * \par   
@@ -8627,7 +8651,8 @@ const q31_t twiddleCoef_32_q31[48] = {
 *	round(twiddleCoefQ31(i) * pow(2, 31))    
 *    
 */
-const q31_t twiddleCoef_64_q31[96] = {
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_TWIDDLECOEF_Q31_64)
+const q31_t twiddleCoef_64_q31[96] ARM_TABLE_SECTION(twiddleCoef_64_q31) = {
     0x7FFFFFFF, 0x00000000,
     0x7F62368F, 0x0C8BD35E,
     0x7D8A5F3F, 0x18F8B83C,
@@ -8677,6 +8702,7 @@ const q31_t twiddleCoef_64_q31[96] = {
     0xE70747C3, 0x8275A0C0,
     0xF3742CA1, 0x809DC970
 };
+#endif
 
 /**    
 * \par   
@@ -8696,7 +8722,8 @@ const q31_t twiddleCoef_64_q31[96] = {
 *	round(twiddleCoefQ31(i) * pow(2, 31))    
 *    
 */
-const q31_t twiddleCoef_128_q31[192] = {
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_TWIDDLECOEF_Q31_128)
+const q31_t twiddleCoef_128_q31[192] ARM_TABLE_SECTION(twiddleCoef_128_q31) = {
     0x7FFFFFFF, 0x00000000,
     0x7FD8878D, 0x0647D97C,
     0x7F62368F, 0x0C8BD35E,
@@ -8794,6 +8821,7 @@ const q31_t twiddleCoef_128_q31[192] = {
     0xF3742CA1, 0x809DC970,
     0xF9B82683, 0x80277872
 };
+#endif
 
 /**    
 * \par   
@@ -8813,7 +8841,8 @@ const q31_t twiddleCoef_128_q31[192] = {
 *	round(twiddleCoefQ31(i) * pow(2, 31))    
 *    
 */
-const q31_t twiddleCoef_256_q31[384] = {
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_TWIDDLECOEF_Q31_256)
+const q31_t twiddleCoef_256_q31[384] ARM_TABLE_SECTION(twiddleCoef_256_q31) = {
     0x7FFFFFFF, 0x00000000,
     0x7FF62182, 0x03242ABF,
     0x7FD8878D, 0x0647D97C,
@@ -9007,6 +9036,7 @@ const q31_t twiddleCoef_256_q31[384] = {
     0xF9B82683, 0x80277872,
     0xFCDBD541, 0x8009DE7D
 };
+#endif
 
 /**    
 * \par   
@@ -9026,7 +9056,8 @@ const q31_t twiddleCoef_256_q31[384] = {
 *	round(twiddleCoefQ31(i) * pow(2, 31))    
 *    
 */
-const q31_t twiddleCoef_512_q31[768] = {
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_TWIDDLECOEF_Q31_512)
+const q31_t twiddleCoef_512_q31[768] ARM_TABLE_SECTION(twiddleCoef_512_q31) = {
     0x7FFFFFFF, 0x00000000,
     0x7FFD885A, 0x01921D1F,
     0x7FF62182, 0x03242ABF,
@@ -9412,6 +9443,7 @@ const q31_t twiddleCoef_512_q31[768] = {
     0xFCDBD541, 0x8009DE7D,
     0xFE6DE2E0, 0x800277A5
 };
+#endif
 
 /**    
 * \par   
@@ -9431,7 +9463,8 @@ const q31_t twiddleCoef_512_q31[768] = {
 *	round(twiddleCoefQ31(i) * pow(2, 31))    
 *    
 */
-const q31_t twiddleCoef_1024_q31[1536] = {
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_TWIDDLECOEF_Q31_1024)
+const q31_t twiddleCoef_1024_q31[1536] ARM_TABLE_SECTION(twiddleCoef_1024_q31) = {
     0x7FFFFFFF, 0x00000000,
     0x7FFF6216, 0x00C90F88,
     0x7FFD885A, 0x01921D1F,
@@ -10201,6 +10234,7 @@ const q31_t twiddleCoef_1024_q31[1536] = {
     0xFE6DE2E0, 0x800277A5,
     0xFF36F078, 0x80009DE9
 };
+#endif
 
 /**    
 * \par   
@@ -10220,7 +10254,8 @@ const q31_t twiddleCoef_1024_q31[1536] = {
 *	round(twiddleCoefQ31(i) * pow(2, 31))    
 *    
 */
-const q31_t twiddleCoef_2048_q31[3072] = {
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_TWIDDLECOEF_Q31_2048)
+const q31_t twiddleCoef_2048_q31[3072] ARM_TABLE_SECTION(twiddleCoef_2048_q31) = {
     0x7FFFFFFF, 0x00000000,
     0x7FFFD885, 0x006487E3,
     0x7FFF6216, 0x00C90F88,
@@ -11758,6 +11793,7 @@ const q31_t twiddleCoef_2048_q31[3072] = {
     0xFF36F078, 0x80009DE9,
     0xFF9B781D, 0x8000277A
 };
+#endif
 
 /**    
 * \par   
@@ -11777,7 +11813,8 @@ const q31_t twiddleCoef_2048_q31[3072] = {
 *	round(twiddleCoefQ31(i) * pow(2, 31))    
 *    
 */
-const q31_t twiddleCoef_4096_q31[6144] = 
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_TWIDDLECOEF_Q31_4096)
+const q31_t twiddleCoef_4096_q31[6144] ARM_TABLE_SECTION(twiddleCoef_4096_q31) = 
 {
     0x7FFFFFFF, 0x00000000,
     0x7FFFF621, 0x003243F5,
@@ -14852,6 +14889,7 @@ const q31_t twiddleCoef_4096_q31[6144] =
     0xFF9B781D, 0x8000277A,
     0xFFCDBC0A, 0x800009DE
 };
+#endif
 
 
 
@@ -14878,7 +14916,8 @@ const q31_t twiddleCoef_4096_q31[6144] =
 *	round(twiddleCoefq15(i) * pow(2, 15))    
 *    
 */
-const q15_t twiddleCoef_16_q15[24] = {
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_TWIDDLECOEF_Q15_16)
+const q15_t twiddleCoef_16_q15[24] ARM_TABLE_SECTION(twiddleCoef_16_q15) = {
     0x7FFF, 0x0000,
     0x7641, 0x30FB,
     0x5A82, 0x5A82,
@@ -14892,6 +14931,7 @@ const q15_t twiddleCoef_16_q15[24] = {
     0xA57D, 0xA57D,
     0xCF04, 0x89BE
 };
+#endif
 
 /**    
 * \par   
@@ -14911,7 +14951,8 @@ const q15_t twiddleCoef_16_q15[24] = {
 *	round(twiddleCoefq15(i) * pow(2, 15))    
 *    
 */
-const q15_t twiddleCoef_32_q15[48] = {
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_TWIDDLECOEF_Q15_32)
+const q15_t twiddleCoef_32_q15[48] ARM_TABLE_SECTION(twiddleCoef_32_q15) = {
     0x7FFF, 0x0000,
     0x7D8A, 0x18F8,
     0x7641, 0x30FB,
@@ -14937,6 +14978,7 @@ const q15_t twiddleCoef_32_q15[48] = {
     0xCF04, 0x89BE,
     0xE707, 0x8275
 };
+#endif
 
 /**    
 * \par   
@@ -14956,7 +14998,8 @@ const q15_t twiddleCoef_32_q15[48] = {
 *	round(twiddleCoefq15(i) * pow(2, 15))    
 *    
 */
-const q15_t twiddleCoef_64_q15[96] = {
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_TWIDDLECOEF_Q15_64)
+const q15_t twiddleCoef_64_q15[96] ARM_TABLE_SECTION(twiddleCoef_64_q15) = {
     0x7FFF, 0x0000,
     0x7F62, 0x0C8B,
     0x7D8A, 0x18F8,
@@ -15006,6 +15049,7 @@ const q15_t twiddleCoef_64_q15[96] = {
     0xE707, 0x8275,
     0xF374, 0x809D
 };
+#endif
 
 /**    
 * \par   
@@ -15025,7 +15069,8 @@ const q15_t twiddleCoef_64_q15[96] = {
 *	round(twiddleCoefq15(i) * pow(2, 15))    
 *    
 */
-const q15_t twiddleCoef_128_q15[192] = {
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_TWIDDLECOEF_Q15_128)
+const q15_t twiddleCoef_128_q15[192] ARM_TABLE_SECTION(twiddleCoef_128_q15) = {
     0x7FFF, 0x0000,
     0x7FD8, 0x0647,
     0x7F62, 0x0C8B,
@@ -15123,6 +15168,7 @@ const q15_t twiddleCoef_128_q15[192] = {
     0xF374, 0x809D,
     0xF9B8, 0x8027
 };
+#endif
 
 /**    
 * \par   
@@ -15142,7 +15188,8 @@ const q15_t twiddleCoef_128_q15[192] = {
 *	round(twiddleCoefq15(i) * pow(2, 15))    
 *    
 */
-const q15_t twiddleCoef_256_q15[384] = {
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_TWIDDLECOEF_Q15_256)
+const q15_t twiddleCoef_256_q15[384] ARM_TABLE_SECTION(twiddleCoef_256_q15) = {
     0x7FFF, 0x0000,
     0x7FF6, 0x0324,
     0x7FD8, 0x0647,
@@ -15336,6 +15383,7 @@ const q15_t twiddleCoef_256_q15[384] = {
     0xF9B8, 0x8027,
     0xFCDB, 0x8009
 };
+#endif
 
 /**    
 * \par   
@@ -15355,7 +15403,8 @@ const q15_t twiddleCoef_256_q15[384] = {
 *	round(twiddleCoefq15(i) * pow(2, 15))    
 *    
 */
-const q15_t twiddleCoef_512_q15[768] = {
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_TWIDDLECOEF_Q15_512)
+const q15_t twiddleCoef_512_q15[768] ARM_TABLE_SECTION(twiddleCoef_512_q15) = {
     0x7FFF, 0x0000,
     0x7FFD, 0x0192,
     0x7FF6, 0x0324,
@@ -15741,6 +15790,7 @@ const q15_t twiddleCoef_512_q15[768] = {
     0xFCDB, 0x8009,
     0xFE6D, 0x8002
 };
+#endif
 
 /**    
 * \par   
@@ -15760,7 +15810,8 @@ const q15_t twiddleCoef_512_q15[768] = {
 *	round(twiddleCoefq15(i) * pow(2, 15))    
 *    
 */
-const q15_t twiddleCoef_1024_q15[1536] = {
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_TWIDDLECOEF_Q15_1024)
+const q15_t twiddleCoef_1024_q15[1536] ARM_TABLE_SECTION(twiddleCoef_1024_q15) = {
     0x7FFF, 0x0000,
     0x7FFF, 0x00C9,
     0x7FFD, 0x0192,
@@ -16530,6 +16581,7 @@ const q15_t twiddleCoef_1024_q15[1536] = {
     0xFE6D, 0x8002,
     0xFF36, 0x8000
 };
+#endif
 
 /**    
 * \par   
@@ -16549,7 +16601,8 @@ const q15_t twiddleCoef_1024_q15[1536] = {
 *	round(twiddleCoefq15(i) * pow(2, 15))    
 *    
 */
-const q15_t twiddleCoef_2048_q15[3072] = {
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_TWIDDLECOEF_Q15_2048)
+const q15_t twiddleCoef_2048_q15[3072] ARM_TABLE_SECTION(twiddleCoef_2048_q15) = {
     0x7FFF, 0x0000,
     0x7FFF, 0x0064,
     0x7FFF, 0x00C9,
@@ -18087,6 +18140,7 @@ const q15_t twiddleCoef_2048_q15[3072] = {
     0xFF36, 0x8000,
     0xFF9B, 0x8000
 };
+#endif
 
 /**    
 * \par   
@@ -18106,7 +18160,8 @@ const q15_t twiddleCoef_2048_q15[3072] = {
 *	round(twiddleCoefq15(i) * pow(2, 15))    
 *    
 */
-const q15_t twiddleCoef_4096_q15[6144] = 
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_TWIDDLECOEF_Q15_4096)
+const q15_t twiddleCoef_4096_q15[6144] ARM_TABLE_SECTION(twiddleCoef_4096_q15) = 
 {
     0x7FFF, 0x0000,
     0x7FFF, 0x0032,
@@ -21181,6 +21236,7 @@ const q15_t twiddleCoef_4096_q15[6144] =
     0xFF9B, 0x8000,
     0xFFCD, 0x8000
 };
+#endif
 
 
 /**    
@@ -21221,21 +21277,26 @@ const q31_t armRecipTableQ31[64] = {
   0x41CCDDB6, 0x4146A3C6, 0x40C28923, 0x40408102
 };
 
-const uint16_t armBitRevIndexTable16[ARMBITREVINDEXTABLE__16_TABLE_LENGTH] = 
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_BITREVIDX_FLT_16)
+const uint16_t armBitRevIndexTable16[ARMBITREVINDEXTABLE__16_TABLE_LENGTH] ARM_TABLE_SECTION(armBitRevIndexTable16) = 
 {
    //8x2, size 20
    8,64, 24,72, 16,64, 40,80, 32,64, 56,88, 48,72, 88,104, 72,96, 104,112
 };
+#endif
 
-const uint16_t armBitRevIndexTable32[ARMBITREVINDEXTABLE__32_TABLE_LENGTH] = 
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_BITREVIDX_FLT_32)
+const uint16_t armBitRevIndexTable32[ARMBITREVINDEXTABLE__32_TABLE_LENGTH] ARM_TABLE_SECTION(armBitRevIndexTable32) = 
 {
    //8x4, size 48
    8,64, 16,128, 24,192, 32,64, 40,72, 48,136, 56,200, 64,128, 72,80, 88,208,
    80,144, 96,192, 104,208, 112,152, 120,216, 136,192, 144,160, 168,208,
    152,224, 176,208, 184,232, 216,240, 200,224, 232,240
 };
+#endif
 
-const uint16_t armBitRevIndexTable64[ARMBITREVINDEXTABLE__64_TABLE_LENGTH] = 
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_BITREVIDX_FLT_64)
+const uint16_t armBitRevIndexTable64[ARMBITREVINDEXTABLE__64_TABLE_LENGTH] ARM_TABLE_SECTION(armBitRevIndexTable64) = 
 {   
    //radix 8, size 56
    8,64, 16,128, 24,192, 32,256, 40,320, 48,384, 56,448, 80,136, 88,200, 
@@ -21243,8 +21304,10 @@ const uint16_t armBitRevIndexTable64[ARMBITREVINDEXTABLE__64_TABLE_LENGTH] =
    184,464, 224,280, 232,344, 240,408, 248,472, 296,352, 304,416, 312,480, 
    368,424, 376,488, 440,496
 };
+#endif
 
-const uint16_t armBitRevIndexTable128[ARMBITREVINDEXTABLE_128_TABLE_LENGTH] = 
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_BITREVIDX_FLT_128)
+const uint16_t armBitRevIndexTable128[ARMBITREVINDEXTABLE_128_TABLE_LENGTH] ARM_TABLE_SECTION(armBitRevIndexTable128) = 
 {
    //8x2, size 208
    8,512, 16,64, 24,576, 32,128, 40,640, 48,192, 56,704, 64,256, 72,768, 
@@ -21261,8 +21324,10 @@ const uint16_t armBitRevIndexTable128[ARMBITREVINDEXTABLE_128_TABLE_LENGTH] =
    792,864, 808,904, 816,864, 824,920, 840,864, 856,880, 872,944, 888,1008, 
    904,928, 912,960, 920,992, 944,968, 952,1000, 968,992, 984,1008
 };
+#endif
 
-const uint16_t armBitRevIndexTable256[ARMBITREVINDEXTABLE_256_TABLE_LENGTH] = 
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_BITREVIDX_FLT_256)
+const uint16_t armBitRevIndexTable256[ARMBITREVINDEXTABLE_256_TABLE_LENGTH] ARM_TABLE_SECTION(armBitRevIndexTable256) = 
 {
    //8x4, size 440
    8,512, 16,1024, 24,1536, 32,64, 40,576, 48,1088, 56,1600, 64,128, 72,640, 
@@ -21299,8 +21364,10 @@ const uint16_t armBitRevIndexTable256[ARMBITREVINDEXTABLE_256_TABLE_LENGTH] =
    1880,1904, 1888,1984, 1896,2000, 1912,2032, 1904,2016, 1976,2032,
    1960,1968, 2008,2032, 1992,2016, 2024,2032
 };
+#endif
 
-const uint16_t armBitRevIndexTable512[ARMBITREVINDEXTABLE_512_TABLE_LENGTH] = 
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_BITREVIDX_FLT_512)
+const uint16_t armBitRevIndexTable512[ARMBITREVINDEXTABLE_512_TABLE_LENGTH] ARM_TABLE_SECTION(armBitRevIndexTable512) = 
 {
    //radix 8, size 448
    8,512, 16,1024, 24,1536, 32,2048, 40,2560, 48,3072, 56,3584, 72,576, 
@@ -21339,8 +21406,10 @@ const uint16_t armBitRevIndexTable512[ARMBITREVINDEXTABLE_512_TABLE_LENGTH] =
    3064,4072, 3128,3632, 3192,3696, 3256,3760, 3320,3824, 3384,3888, 
    3448,3952, 3512,4016, 3576,4080
 };
+#endif
 
-const uint16_t armBitRevIndexTable1024[ARMBITREVINDEXTABLE1024_TABLE_LENGTH] = 
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_BITREVIDX_FLT_1024)
+const uint16_t armBitRevIndexTable1024[ARMBITREVINDEXTABLE1024_TABLE_LENGTH] ARM_TABLE_SECTION(armBitRevIndexTable1024) = 
 {
    //8x2, size 1800
    8,4096, 16,512, 24,4608, 32,1024, 40,5120, 48,1536, 56,5632, 64,2048, 
@@ -21491,8 +21560,10 @@ const uint16_t armBitRevIndexTable1024[ARMBITREVINDEXTABLE1024_TABLE_LENGTH] =
    8008,8032, 8024,8048, 8056,8120, 8072,8096, 8080,8128, 8088,8160, 
    8112,8136, 8120,8168, 8136,8160, 8152,8176
 };
+#endif
 
-const uint16_t armBitRevIndexTable2048[ARMBITREVINDEXTABLE2048_TABLE_LENGTH] = 
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_BITREVIDX_FLT_2048)
+const uint16_t armBitRevIndexTable2048[ARMBITREVINDEXTABLE2048_TABLE_LENGTH] ARM_TABLE_SECTION(armBitRevIndexTable2048) = 
 {
    //8x2, size 3808
    8,4096, 16,8192, 24,12288, 32,512, 40,4608, 48,8704, 56,12800, 64,1024, 
@@ -21833,8 +21904,10 @@ const uint16_t armBitRevIndexTable2048[ARMBITREVINDEXTABLE2048_TABLE_LENGTH] =
    16248,16368, 16264,16288, 16280,16296, 16296,16304, 16344,16368,
    16328,16352, 16360,16368
 };
+#endif
 
-const uint16_t armBitRevIndexTable4096[ARMBITREVINDEXTABLE4096_TABLE_LENGTH] = 
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_BITREVIDX_FLT_4096)
+const uint16_t armBitRevIndexTable4096[ARMBITREVINDEXTABLE4096_TABLE_LENGTH] ARM_TABLE_SECTION(armBitRevIndexTable4096) = 
 {
    //radix 8, size 4032
    8,4096, 16,8192, 24,12288, 32,16384, 40,20480, 48,24576, 56,28672, 64,512, 
@@ -22204,30 +22277,38 @@ const uint16_t armBitRevIndexTable4096[ARMBITREVINDEXTABLE4096_TABLE_LENGTH] =
    31096,31544, 31160,32056, 31224,32568, 31672,32120, 31736,32632, 
    32248,32696
 };
+#endif
 
 
-const uint16_t armBitRevIndexTable_fixed_16[ARMBITREVINDEXTABLE_FIXED___16_TABLE_LENGTH] = 
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_BITREVIDX_FXT_16)
+const uint16_t armBitRevIndexTable_fixed_16[ARMBITREVINDEXTABLE_FIXED___16_TABLE_LENGTH] ARM_TABLE_SECTION(armBitRevIndexTable_fixed_16) = 
 {
    //radix 4, size 12
    8,64, 16,32, 24,96, 40,80, 56,112, 88,104
 };
+#endif
 
-const uint16_t armBitRevIndexTable_fixed_32[ARMBITREVINDEXTABLE_FIXED___32_TABLE_LENGTH] = 
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_BITREVIDX_FXT_32)
+const uint16_t armBitRevIndexTable_fixed_32[ARMBITREVINDEXTABLE_FIXED___32_TABLE_LENGTH] ARM_TABLE_SECTION(armBitRevIndexTable_fixed_32) = 
 {
    //4x2, size 24
    8,128, 16,64, 24,192, 40,160, 48,96, 56,224, 72,144,
    88,208, 104,176, 120,240, 152,200, 184,232
 };
+#endif
 
-const uint16_t armBitRevIndexTable_fixed_64[ARMBITREVINDEXTABLE_FIXED___64_TABLE_LENGTH] = 
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_BITREVIDX_FXT_64)
+const uint16_t armBitRevIndexTable_fixed_64[ARMBITREVINDEXTABLE_FIXED___64_TABLE_LENGTH] ARM_TABLE_SECTION(armBitRevIndexTable_fixed_64) = 
 {   
    //radix 4, size 56
    8,256, 16,128, 24,384, 32,64, 40,320, 48,192, 56,448, 72,288, 80,160, 88,416, 104,352,
    112,224, 120,480, 136,272, 152,400, 168,336, 176,208, 184,464, 200,304, 216,432,
    232,368, 248,496, 280,392, 296,328, 312,456, 344,424, 376,488, 440,472
 };
+#endif
 
-const uint16_t armBitRevIndexTable_fixed_128[ARMBITREVINDEXTABLE_FIXED__128_TABLE_LENGTH] = 
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_BITREVIDX_FXT_128)
+const uint16_t armBitRevIndexTable_fixed_128[ARMBITREVINDEXTABLE_FIXED__128_TABLE_LENGTH] ARM_TABLE_SECTION(armBitRevIndexTable_fixed_128) = 
 {
    //4x2, size 112
    8,512, 16,256, 24,768, 32,128, 40,640, 48,384, 56,896, 72,576, 80,320, 88,832, 96,192,
@@ -22237,8 +22318,10 @@ const uint16_t armBitRevIndexTable_fixed_128[ARMBITREVINDEXTABLE_FIXED__128_TABL
    472,880, 488,752, 504,1008, 536,776, 552,648, 568,904, 600,840, 616,712, 632,968,
    664,808, 696,936, 728,872, 760,1000, 824,920, 888,984
 };
+#endif
 
-const uint16_t armBitRevIndexTable_fixed_256[ARMBITREVINDEXTABLE_FIXED__256_TABLE_LENGTH] = 
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_BITREVIDX_FXT_256)
+const uint16_t armBitRevIndexTable_fixed_256[ARMBITREVINDEXTABLE_FIXED__256_TABLE_LENGTH] ARM_TABLE_SECTION(armBitRevIndexTable_fixed_256) = 
 {
    //radix 4, size 240
    8,1024, 16,512, 24,1536, 32,256, 40,1280, 48,768, 56,1792, 64,128, 72,1152, 80,640,
@@ -22256,8 +22339,10 @@ const uint16_t armBitRevIndexTable_fixed_256[ARMBITREVINDEXTABLE_FIXED__256_TABL
    1368,1704, 1384,1448, 1400,1960, 1432,1640, 1464,1896, 1496,1768, 1528,2024, 1592,1816,
    1624,1688, 1656,1944, 1720,1880, 1784,2008, 1912,1976
 };
+#endif
 
-const uint16_t armBitRevIndexTable_fixed_512[ARMBITREVINDEXTABLE_FIXED__512_TABLE_LENGTH] = 
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_BITREVIDX_FXT_512)
+const uint16_t armBitRevIndexTable_fixed_512[ARMBITREVINDEXTABLE_FIXED__512_TABLE_LENGTH] ARM_TABLE_SECTION(armBitRevIndexTable_fixed_512) = 
 {
    //4x2, size 480
    8,2048, 16,1024, 24,3072, 32,512, 40,2560, 48,1536, 56,3584, 64,256, 72,2304, 80,1280,
@@ -22290,8 +22375,10 @@ const uint16_t armBitRevIndexTable_fixed_512[ARMBITREVINDEXTABLE_FIXED__512_TABL
    3128,3608, 3160,3352, 3192,3864, 3256,3736, 3288,3480, 3320,3992, 3384,3672, 3448,3928,
    3512,3800, 3576,4056, 3704,3896, 3832,4024
 };
+#endif
 
-const uint16_t armBitRevIndexTable_fixed_1024[ARMBITREVINDEXTABLE_FIXED_1024_TABLE_LENGTH] = 
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_BITREVIDX_FXT_1024)
+const uint16_t armBitRevIndexTable_fixed_1024[ARMBITREVINDEXTABLE_FIXED_1024_TABLE_LENGTH] ARM_TABLE_SECTION(armBitRevIndexTable_fixed_1024) = 
 {
     //radix 4, size 992
     8,4096, 16,2048, 24,6144, 32,1024, 40,5120, 48,3072, 56,7168, 64,512, 72,4608, 
@@ -22364,8 +22451,10 @@ const uint16_t armBitRevIndexTable_fixed_1024[ARMBITREVINDEXTABLE_FIXED_1024_TAB
     6872,7000, 6904,8024, 6968,7384, 7032,7896, 7096,7640, 7160,8152, 7288,7736, 
     7352,7480, 7416,7992, 7544,7864, 7672,8120, 7928,8056 
 };
+#endif
 
-const uint16_t armBitRevIndexTable_fixed_2048[ARMBITREVINDEXTABLE_FIXED_2048_TABLE_LENGTH] = 
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_BITREVIDX_FXT_2048)
+const uint16_t armBitRevIndexTable_fixed_2048[ARMBITREVINDEXTABLE_FIXED_2048_TABLE_LENGTH] ARM_TABLE_SECTION(armBitRevIndexTable_fixed_2048) = 
 {
     //4x2, size 1984
     8,8192, 16,4096, 24,12288, 32,2048, 40,10240, 48,6144, 56,14336, 64,1024, 
@@ -22520,8 +22609,10 @@ const uint16_t armBitRevIndexTable_fixed_2048[ARMBITREVINDEXTABLE_FIXED_2048_TAB
     14456,15416, 14520,14904, 14584,15928, 14712,15672, 14776,15160, 14840,16184, 
     14968,15544, 15096,16056, 15224,15800, 15352,16312, 15608,15992, 15864,16248 
 };
+#endif
 
-const uint16_t armBitRevIndexTable_fixed_4096[ARMBITREVINDEXTABLE_FIXED_4096_TABLE_LENGTH] = 
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_BITREVIDX_FXT_4096)
+const uint16_t armBitRevIndexTable_fixed_4096[ARMBITREVINDEXTABLE_FIXED_4096_TABLE_LENGTH] ARM_TABLE_SECTION(armBitRevIndexTable_fixed_4096) = 
 {
     //radix 4, size 4032
     8,16384, 16,8192, 24,24576, 32,4096, 40,20480, 48,12288, 56,28672, 64,2048, 
@@ -22858,6 +22949,7 @@ const uint16_t armBitRevIndexTable_fixed_4096[ARMBITREVINDEXTABLE_FIXED_4096_TAB
     30456,32184, 30584,31672, 30712,32696, 30968,31864, 31096,31352, 31224,32376, 
     31480,32120, 31736,32632, 32248,32504 
 };
+#endif
 
 /**    
 * \par    
@@ -22867,7 +22959,8 @@ const uint16_t armBitRevIndexTable_fixed_4096[ARMBITREVINDEXTABLE_FIXED_4096_TAB
 * \par    
 * Real and Imag values are in interleaved fashion    
 */
-const float32_t twiddleCoef_rfft_32[32] = {
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_TWIDDLECOEF_RFFT_F32_32)
+const float32_t twiddleCoef_rfft_32[32] ARM_TABLE_SECTION(twiddleCoef_rfft_32) = {
 0.0f			,	1.0f			,
 0.195090322f	,	0.98078528f 	,
 0.382683432f	,	0.923879533f	,
@@ -22885,8 +22978,10 @@ const float32_t twiddleCoef_rfft_32[32] = {
 0.382683432f	,	-0.923879533f	,
 0.195090322f	,	-0.98078528f	
 };
+#endif
 
-const float32_t twiddleCoef_rfft_64[64] = {
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_TWIDDLECOEF_RFFT_F32_64)
+const float32_t twiddleCoef_rfft_64[64] ARM_TABLE_SECTION(twiddleCoef_rfft_64) = {
 0.0f,	1.0f,
 0.098017140329561f,	0.995184726672197f,
 0.195090322016128f,	0.98078528040323f,
@@ -22920,8 +23015,10 @@ const float32_t twiddleCoef_rfft_64[64] = {
 0.195090322016129f,	-0.98078528040323f,
 0.098017140329561f,	-0.995184726672197f
 };
+#endif
 
-const float32_t twiddleCoef_rfft_128[128] = {
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_TWIDDLECOEF_RFFT_F32_128)
+const float32_t twiddleCoef_rfft_128[128] ARM_TABLE_SECTION(twiddleCoef_rfft_128) = {
     0.000000000f,  1.000000000f,
     0.049067674f,  0.998795456f,
     0.098017140f,  0.995184727f,
@@ -22987,8 +23084,10 @@ const float32_t twiddleCoef_rfft_128[128] = {
     0.098017140f, -0.995184727f,
     0.049067674f, -0.998795456f
 };
+#endif
 
-const float32_t twiddleCoef_rfft_256[256] = {
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_TWIDDLECOEF_RFFT_F32_256)
+const float32_t twiddleCoef_rfft_256[256] ARM_TABLE_SECTION(twiddleCoef_rfft_256) = {
     0.000000000f,  1.000000000f,
     0.024541229f,  0.999698819f,
     0.049067674f,  0.998795456f,
@@ -23118,8 +23217,10 @@ const float32_t twiddleCoef_rfft_256[256] = {
     0.049067674f, -0.998795456f,
     0.024541229f, -0.999698819f
 };
+#endif
 
-const float32_t twiddleCoef_rfft_512[512] = {
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_TWIDDLECOEF_RFFT_F32_512)
+const float32_t twiddleCoef_rfft_512[512] ARM_TABLE_SECTION(twiddleCoef_rfft_512) = {
     0.000000000f,  1.000000000f,
     0.012271538f,  0.999924702f,
     0.024541229f,  0.999698819f,
@@ -23377,8 +23478,10 @@ const float32_t twiddleCoef_rfft_512[512] = {
     0.024541229f, -0.999698819f,
     0.012271538f, -0.999924702f
 };
+#endif
 
-const float32_t twiddleCoef_rfft_1024[1024] = {
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_TWIDDLECOEF_RFFT_F32_1024)
+const float32_t twiddleCoef_rfft_1024[1024] ARM_TABLE_SECTION(twiddleCoef_rfft_1024) = {
     0.000000000f,  1.000000000f,
     0.006135885f,  0.999981175f,
     0.012271538f,  0.999924702f,
@@ -23892,8 +23995,10 @@ const float32_t twiddleCoef_rfft_1024[1024] = {
     0.012271538f, -0.999924702f,
     0.006135885f, -0.999981175f
 };
+#endif
 
-const float32_t twiddleCoef_rfft_2048[2048] = {
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_TWIDDLECOEF_RFFT_F32_2048)
+const float32_t twiddleCoef_rfft_2048[2048] ARM_TABLE_SECTION(twiddleCoef_rfft_2048) = {
     0.000000000f,  1.000000000f,
     0.003067957f,  0.999995294f,
     0.006135885f,  0.999981175f,
@@ -24919,8 +25024,10 @@ const float32_t twiddleCoef_rfft_2048[2048] = {
     0.006135885f, -0.999981175f,
     0.003067957f, -0.999995294f
 };
+#endif
 
-const float32_t twiddleCoef_rfft_4096[4096] = {
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_TWIDDLECOEF_RFFT_F32_4096)
+const float32_t twiddleCoef_rfft_4096[4096] ARM_TABLE_SECTION(twiddleCoef_rfft_4096) = {
     0.000000000f,  1.000000000f,
     0.001533980f,  0.999998823f,
     0.003067957f,  0.999995294f,
@@ -26970,6 +27077,7 @@ const float32_t twiddleCoef_rfft_4096[4096] = {
     0.003067957f, -0.999995294f,
     0.001533980f, -0.999998823f
 };
+#endif
 
 
 /**   
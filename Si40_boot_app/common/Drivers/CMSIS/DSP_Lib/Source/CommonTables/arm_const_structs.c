@@ -44,113 +44,167 @@
 
 //Floating-point structs
 
-const arm_cfft_instance_f32 arm_cfft_sR_f32_len16 = {
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_FFT_CFFT_F32_16)
+const arm_cfft_instance_f32 arm_cfft_sR_f32_len16 ARM_TABLE_SECTION(arm_cfft_sR_f32_len16) = {
 	16, twiddleCoef_16, armBitRevIndexTable16, ARMBITREVINDEXTABLE__16_TABLE_LENGTH
 };
+#endif
 
-const arm_cfft_instance_f32 arm_cfft_sR_f32_len32 = {
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_FFT_CFFT_F32_32)
+const arm_cfft_instance_f32 arm_cfft_sR_f32_len32 ARM_TABLE_SECTION(arm_cfft_sR_f32_len32) = {
 	32, twiddleCoef_32, armBitRevIndexTable32, ARMBITREVINDEXTABLE__32_TABLE_LENGTH
 };
+#endif
 
-const arm_cfft_instance_f32 arm_cfft_sR_f32_len64 = {
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_FFT_CFFT_F32_64)
+const arm_cfft_instance_f32 arm_cfft_sR_f32_len64 ARM_TABLE_SECTION(arm_cfft_sR_f32_len64) = {
 	64, twiddleCoef_64, armBitRevIndexTable64, ARMBITREVINDEXTABLE__64_TABLE_LENGTH
 };
+#endif
 
-const arm_cfft_instance_f32 arm_cfft_sR_f32_len128 = {
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_FFT_CFFT_F32_128)
+const arm_cfft_instance_f32 arm_cfft_sR_f32_len128 ARM_TABLE_SECTION(arm_cfft_sR_f32_len128) = {
 	128, twiddleCoef_128, armBitRevIndexTable128, ARMBITREVINDEXTABLE_128_TABLE_LENGTH
 };
+#endif
 
-const arm_cfft_instance_f32 arm_cfft_sR_f32_len256 = {
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_FFT_CFFT_F32_256)
+const arm_cfft_instance_f32 arm_cfft_sR_f32_len256 ARM_TABLE_SECTION(arm_cfft_sR_f32_len256) = {
 	256, twiddleCoef_256, armBitRevIndexTable256, ARMBITREVINDEXTABLE_256_TABLE_LENGTH
 };
+#endif
 
-const arm_cfft_instance_f32 arm_cfft_sR_f32_len512 = {
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_FFT_CFFT_F32_512)
+const arm_cfft_instance_f32 arm_cfft_sR_f32_len512 ARM_TABLE_SECTION(arm_cfft_sR_f32_len512) = {
 	512, twiddleCoef_512, armBitRevIndexTable512, ARMBITREVINDEXTABLE_512_TABLE_LENGTH
 };
+#endif
 
-const arm_cfft_instance_f32 arm_cfft_sR_f32_len1024 = {
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_FFT_CFFT_F32_1024)
+const arm_cfft_instance_f32 arm_cfft_sR_f32_len1024 ARM_TABLE_SECTION(arm_cfft_sR_f32_len1024) = {
 	1024, twiddleCoef_1024, armBitRevIndexTable1024, ARMBITREVINDEXTABLE1024_TABLE_LENGTH
 };
+#endif
 
-const arm_cfft_instance_f32 arm_cfft_sR_f32_len2048 = {
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_FFT_CFFT_F32_2048)
+const arm_cfft_instance_f32 arm_cfft_sR_f32_len2048 ARM_TABLE_SECTION(arm_cfft_sR_f32_len2048) = {
 	2048, twiddleCoef_2048, armBitRevIndexTable2048, ARMBITREVINDEXTABLE2048_TABLE_LENGTH
 };
+#endif
 
-const arm_cfft_instance_f32 arm_cfft_sR_f32_len4096 = {
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_FFT_CFFT_F32_4096)
+const arm_cfft_instance_f32 arm_cfft_sR_f32_len4096 ARM_TABLE_SECTION(arm_cfft_sR_f32_len4096) = {
 	4096, twiddleCoef_4096, armBitRevIndexTable4096, ARMBITREVINDEXTABLE4096_TABLE_LENGTH
 };
+#endif
 
 //Fixed-point structs
 
-const arm_cfft_instance_q31 arm_cfft_sR_q31_len16 = {
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_FFT_CFFT_Q31_16)
+const arm_cfft_instance_q31 arm_cfft_sR_q31_len16 ARM_TABLE_SECTION(arm_cfft_sR_q31_len16) = {
 	16, twiddleCoef_16_q31, armBitRevIndexTable_fixed_16, ARMBITREVINDEXTABLE_FIXED___16_TABLE_LENGTH
 };
+#endif
 
-const arm_cfft_instance_q31 arm_cfft_sR_q31_len32 = {
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_FFT_CFFT_Q31_32)
+const arm_cfft_instance_q31 arm_cfft_sR_q31_len32 ARM_TABLE_SECTION(arm_cfft_sR_q31_len32) = {
 	32, twiddleCoef_32_q31, armBitRevIndexTable_fixed_32, ARMBITREVINDEXTABLE_FIXED___32_TABLE_LENGTH
 };
+#endif
 
-const arm_cfft_instance_q31 arm_cfft_sR_q31_len64 = {
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_FFT_CFFT_Q31_64)
+const arm_cfft_instance_q31 arm_cfft_sR_q31_len64 ARM_TABLE_SECTION(arm_cfft_sR_q31_len64) = {
 	64, twiddleCoef_64_q31, armBitRevIndexTable_fixed_64, ARMBITREVINDEXTABLE_FIXED___64_TABLE_LENGTH
 };
+#endif
 
-const arm_cfft_instance_q31 arm_cfft_sR_q31_len128 = {
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_FFT_CFFT_Q31_128)
+const arm_cfft_instance_q31 arm_cfft_sR_q31_len128 ARM_TABLE_SECTION(arm_cfft_sR_q31_len128) = {
 	128, twiddleCoef_128_q31, armBitRevIndexTable_fixed_128, ARMBITREVINDEXTABLE_FIXED__128_TABLE_LENGTH
 };
+#endif
 
-const arm_cfft_instance_q31 arm_cfft_sR_q31_len256 = {
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_FFT_CFFT_Q31_256)
+const arm_cfft_instance_q31 arm_cfft_sR_q31_len256 ARM_TABLE_SECTION(arm_cfft_sR_q31_len256) = {
 	256, twiddleCoef_256_q31, armBitRevIndexTable_fixed_256, ARMBITREVINDEXTABLE_FIXED__256_TABLE_LENGTH
 };
+#endif
 
-const arm_cfft_instance_q31 arm_cfft_sR_q31_len512 = {
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_FFT_CFFT_Q31_512)
+const arm_cfft_instance_q31 arm_cfft_sR_q31_len512 ARM_TABLE_SECTION(arm_cfft_sR_q31_len512) = {
 	512, twiddleCoef_512_q31, armBitRevIndexTable_fixed_512, ARMBITREVINDEXTABLE_FIXED__512_TABLE_LENGTH
 };
+#endif
 
-const arm_cfft_instance_q31 arm_cfft_sR_q31_len1024 = {
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_FFT_CFFT_Q31_1024)
+const arm_cfft_instance_q31 arm_cfft_sR_q31_len1024 ARM_TABLE_SECTION(arm_cfft_sR_q31_len1024) = {
 	1024, twiddleCoef_1024_q31, armBitRevIndexTable_fixed_1024, ARMBITREVINDEXTABLE_FIXED_1024_TABLE_LENGTH
 };
+#endif
 
-const arm_cfft_instance_q31 arm_cfft_sR_q31_len2048 = {
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_FFT_CFFT_Q31_2048)
+const arm_cfft_instance_q31 arm_cfft_sR_q31_len2048 ARM_TABLE_SECTION(arm_cfft_sR_q31_len2048) = {
 	2048, twiddleCoef_2048_q31, armBitRevIndexTable_fixed_2048, ARMBITREVINDEXTABLE_FIXED_2048_TABLE_LENGTH
 };
+#endif
 
-const arm_cfft_instance_q31 arm_cfft_sR_q31_len4096 = {
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_FFT_CFFT_Q31_4096)
+const arm_cfft_instance_q31 arm_cfft_sR_q31_len4096 ARM_TABLE_SECTION(arm_cfft_sR_q31_len4096) = {
 	4096, twiddleCoef_4096_q31, armBitRevIndexTable_fixed_4096, ARMBITREVINDEXTABLE_FIXED_4096_TABLE_LENGTH
 };
+#endif
 
 
-const arm_cfft_instance_q15 arm_cfft_sR_q15_len16 = {
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_FFT_CFFT_Q15_16)
+const arm_cfft_instance_q15 arm_cfft_sR_q15_len16 ARM_TABLE_SECTION(arm_cfft_sR_q15_len16) = {
 	16, twiddleCoef_16_q15, armBitRevIndexTable_fixed_16, ARMBITREVINDEXTABLE_FIXED___16_TABLE_LENGTH
 };
+#endif
 
-const arm_cfft_instance_q15 arm_cfft_sR_q15_len32 = {
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_FFT_CFFT_Q15_32)
+const arm_cfft_instance_q15 arm_cfft_sR_q15_len32 ARM_TABLE_SECTION(arm_cfft_sR_q15_len32) = {
 	32, twiddleCoef_32_q15, armBitRevIndexTable_fixed_32, ARMBITREVINDEXTABLE_FIXED___32_TABLE_LENGTH
 };
+#endif
 
-const arm_cfft_instance_q15 arm_cfft_sR_q15_len64 = {
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_FFT_CFFT_Q15_64)
+const arm_cfft_instance_q15 arm_cfft_sR_q15_len64 ARM_TABLE_SECTION(arm_cfft_sR_q15_len64) = {
 	64, twiddleCoef_64_q15, armBitRevIndexTable_fixed_64, ARMBITREVINDEXTABLE_FIXED___64_TABLE_LENGTH
 };
+#endif
 
-const arm_cfft_instance_q15 arm_cfft_sR_q15_len128 = {
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_FFT_CFFT_Q15_128)
+const arm_cfft_instance_q15 arm_cfft_sR_q15_len128 ARM_TABLE_SECTION(arm_cfft_sR_q15_len128) = {
 	128, twiddleCoef_128_q15, armBitRevIndexTable_fixed_128, ARMBITREVINDEXTABLE_FIXED__128_TABLE_LENGTH
 };
+#endif
 
-const arm_cfft_instance_q15 arm_cfft_sR_q15_len256 = {
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_FFT_CFFT_Q15_256)
+const arm_cfft_instance_q15 arm_cfft_sR_q15_len256 ARM_TABLE_SECTION(arm_cfft_sR_q15_len256) = {
 	256, twiddleCoef_256_q15, armBitRevIndexTable_fixed_256, ARMBITREVINDEXTABLE_FIXED__256_TABLE_LENGTH
 };
+#endif
 
-const arm_cfft_instance_q15 arm_cfft_sR_q15_len512 = {
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_FFT_CFFT_Q15_512)
+const arm_cfft_instance_q15 arm_cfft_sR_q15_len512 ARM_TABLE_SECTION(arm_cfft_sR_q15_len512) = {
 	512, twiddleCoef_512_q15, armBitRevIndexTable_fixed_512, ARMBITREVINDEXTABLE_FIXED__512_TABLE_LENGTH
 };
+#endif
 
-const arm_cfft_instance_q15 arm_cfft_sR_q15_len1024 = {
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_FFT_CFFT_Q15_1024)
+const arm_cfft_instance_q15 arm_cfft_sR_q15_len1024 ARM_TABLE_SECTION(arm_cfft_sR_q15_len1024) = {
 	1024, twiddleCoef_1024_q15, armBitRevIndexTable_fixed_1024, ARMBITREVINDEXTABLE_FIXED_1024_TABLE_LENGTH
 };
+#endif
 
-const arm_cfft_instance_q15 arm_cfft_sR_q15_len2048 = {
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_FFT_CFFT_Q15_2048)
+const arm_cfft_instance_q15 arm_cfft_sR_q15_len2048 ARM_TABLE_SECTION(arm_cfft_sR_q15_len2048) = {
 	2048, twiddleCoef_2048_q15, armBitRevIndexTable_fixed_2048, ARMBITREVINDEXTABLE_FIXED_2048_TABLE_LENGTH
 };
+#endif
 
-const arm_cfft_instance_q15 arm_cfft_sR_q15_len4096 = {
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_FFT_CFFT_Q15_4096)
+const arm_cfft_instance_q15 arm_cfft_sR_q15_len4096 ARM_TABLE_SECTION(arm_cfft_sR_q15_len4096) = {
 	4096, twiddleCoef_4096_q15, armBitRevIndexTable_fixed_4096, ARMBITREVINDEXTABLE_FIXED_4096_TABLE_LENGTH
 };
+#endif
@@ -68,7 +68,8 @@ void arm_sin_cos_q31(
 {
   q31_t fract;                                 /* Temporary variables for input, output */
   uint16_t indexS, indexC;                     /* Index variable */
-  q31_t f1, f2, d1, d2;                        /* Two nearest output values */
+  q31_t f1, f2;                                /* Two nearest output values */
+  q63_t d1, d2;                                /* Slopes at the two values */
   q31_t Dn, Df;
   q63_t temp;
   
@@ -82,8 +83,9 @@ void arm_sin_cos_q31(
   /* Read two nearest values of input value from the cos & sin tables */
   f1 = sinTable_q31[indexC+0];
   f2 = sinTable_q31[indexC+1];
-  d1 = -sinTable_q31[indexS+0];
-  d2 = -sinTable_q31[indexS+1];
+  /* negated in 64 bits, sinTable_q31[384] is 0x80000000 */
+  d1 = -(q63_t)sinTable_q31[indexS+0];
+  d2 = -(q63_t)sinTable_q31[indexS+1];
 
   Dn = 0x1921FB5; // delta between the two points (fixed), in this case 2*pi/FAST_MATH_TABLE_SIZE
   Df = f2 - f1; // delta between the values of the functions
@@ -0,0 +1,95 @@
+/* ----------------------------------------------------------------------
+* $Date:        19. October 2026
+*
+* Project:      CMSIS DSP Library
+* Title:        arm_biquad_cascade_df1_bank_init_q15.c
+*
+* Description:  Initialization function for the Q15 Biquad cascade filter bank.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup BiquadCascadeDF1Bank
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the Q15 Biquad cascade filter bank.
+ * @param[in,out] *S              points to an instance of the Q15 Biquad cascade filter bank structure.
+ * @param[in]     numFilters      number of filters in the bank.
+ * @param[in]     numStages       number of 2nd order stages of every filter.
+ * @param[in]     *pFilterCoeffs  points to the coefficients of the filters one after another, 6*numStages each.
+ * @param[out]    *pCoeffs        points to the coefficient buffer of the bank, 6*numStages*numFilters values.
+ * @param[in]     *pState         points to the state buffer, 4*numStages*numFilters values.
+ * @param[in]     postShift       Shift to be applied to the output. Varies according to the coefficients format.
+ * @return        none
+ *
+ * <b>Coefficient and State Ordering:</b>
+ * \par
+ * The coefficients of a filter are the array of arm_biquad_cascade_df1_init_q15():
+ * <pre>
+ *     {b10, 0, b11, b12, a11, a12, b20, 0, b21, b22, a21, a22, ...}
+ * </pre>
+ * They are copied to <code>pCoeffs</code> stage by stage, every stage as three arrays
+ * of one word per filter, so the word of the next filter is next in memory:
+ * <pre>
+ *     {b0, 0} x numFilters, {b1, b2} x numFilters, {a1, a2} x numFilters
+ * </pre>
+ * The state of a stage is two arrays of one word per filter, zeroed here:
+ * <pre>
+ *     {x[n-1], x[n-2]} x numFilters, {y[n-1], y[n-2]} x numFilters
+ * </pre>
+ */
+
+void arm_biquad_cascade_df1_bank_init_q15(
+  arm_biquad_casd_df1_bank_inst_q15 * S,
+  uint16_t numFilters,
+  uint8_t numStages,
+  const q15_t * pFilterCoeffs,
+  q15_t * pCoeffs,
+  q15_t * pState,
+  int8_t postShift)
+{
+  uint32_t f, stage;
+  q15_t *pStage;
+  const q15_t *pSrc;
+
+  for (f = 0u; f < numFilters; f++)
+  {
+    pSrc = &pFilterCoeffs[6u * numStages * f];
+    pStage = &pCoeffs[2u * f];
+
+    for (stage = 0u; stage < numStages; stage++)
+    {
+      pStage[0] = pSrc[0];
+      pStage[1] = 0;
+      pStage[2u * numFilters] = pSrc[2];
+      pStage[(2u * numFilters) + 1u] = pSrc[3];
+      pStage[4u * numFilters] = pSrc[4];
+      pStage[(4u * numFilters) + 1u] = pSrc[5];
+
+      pSrc += 6u;
+      pStage += 6u * numFilters;
+    }
+  }
+
+  S->numFilters = numFilters;
+  S->numStages = numStages;
+  S->postShift = postShift;
+  S->pCoeffs = pCoeffs;
+
+  /* Clear the state buffer. */
+  memset(pState, 0, (4u * (uint32_t) numStages * numFilters) * sizeof(q15_t));
+  S->pState = pState;
+}
+
+/**
+ * @} end of BiquadCascadeDF1Bank group
+ */
@@ -0,0 +1,143 @@
+/* ----------------------------------------------------------------------
+* $Date:        19. October 2026
+*
+* Project:      CMSIS DSP Library
+* Title:        arm_biquad_cascade_df1_bank_q15.c
+*
+* Description:  Processing function for the Q15 Biquad cascade filter bank.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @defgroup BiquadCascadeDF1Bank Biquad Cascade IIR Filter Bank Using Direct Form I Structure
+ *
+ * A bank of Q15 Biquad cascade filters, all of the same number of stages, run over
+ * the same input block. Each filter computes exactly the output of
+ * arm_biquad_cascade_df1_q15() with its coefficients, the bank only changes the order
+ * of the work and of the memory:
+ *
+ * \par
+ * The output block holds <code>blockSize * numFilters</code> values interleaved by filter,
+ * <code>pDst[n * numFilters + f]</code> is sample n of filter f, the layout of the
+ * channels of a stereo or multi-channel block.
+ *
+ * \par
+ * The coefficients and the state of a stage are stored filter after filter (see
+ * arm_biquad_cascade_df1_bank_init_q15()), so the same coefficient of all the filters is
+ * contiguous. On the host build arm_math_host.h runs the filters of a vector at once,
+ * sample by sample through all the stages; on the Cortex-M the filters run one after
+ * the other like single instances.
+ *
+ * \par
+ * <code>pDst</code> must not overlap <code>pSrc</code>.
+ */
+
+/**
+ * @addtogroup BiquadCascadeDF1Bank
+ * @{
+ */
+
+/**
+ * @brief Processing function for the Q15 Biquad cascade filter bank.
+ * @param[in]  *S         points to an instance of the Q15 Biquad cascade filter bank structure.
+ * @param[in]  *pSrc      points to the block of input data.
+ * @param[out] *pDst      points to the block of output data, blockSize*numFilters values interleaved by filter.
+ * @param[in]  blockSize  number of samples to process per call.
+ * @return     none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The same as arm_biquad_cascade_df1_q15(): a 64-bit accumulator, shifted by
+ * <code>postShift</code> to 1.15 format and saturated.
+ */
+
+void ARM_MATH_PORTABLE(arm_biquad_cascade_df1_bank_q15)(
+  const arm_biquad_casd_df1_bank_inst_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  q15_t *pIn;                                    /*  Source pointer                               */
+  q15_t *pOut;                                   /*  Destination pointer                          */
+  q15_t *pState;                                 /*  State pointer of the filter                  */
+  q15_t *pCoeffs;                                /*  Coefficient pointer of the filter            */
+  q31_t in, out;                                 /*  Input and output values                      */
+  q31_t b0, b1, a1;                              /*  Filter coefficients, packed                  */
+  q31_t state_in, state_out;                     /*  Filter state variables                       */
+  q63_t acc;                                     /*  Accumulator                                  */
+  int32_t lShift = (15 - (int32_t) S->postShift);       /*  Post shift                                   */
+  uint32_t numFilters = (uint32_t) S->numFilters;
+  uint32_t inStride;                             /*  Input step, 1 for pSrc, numFilters for pDst  */
+  uint32_t f, sample, stage;
+
+  for (f = 0u; f < numFilters; f++)
+  {
+    pIn = pSrc;
+    inStride = 1u;
+    pState = S->pState + (2u * f);
+    pCoeffs = S->pCoeffs + (2u * f);
+    stage = (uint32_t) S->numStages;
+
+    do
+    {
+      /* {b0, 0}, {b1, b2} and {a1, a2} of the filter */
+      b0 = _SIMD32_OFFSET(pCoeffs);
+      b1 = _SIMD32_OFFSET(pCoeffs + (2u * numFilters));
+      a1 = _SIMD32_OFFSET(pCoeffs + (4u * numFilters));
+
+      /* {x[n-1], x[n-2]} and {y[n-1], y[n-2]} of the filter */
+      state_in = _SIMD32_OFFSET(pState);
+      state_out = _SIMD32_OFFSET(pState + (2u * numFilters));
+
+      pOut = pDst + f;
+      sample = blockSize;
+
+      while(sample > 0u)
+      {
+        in = *pIn;
+        pIn += inStride;
+
+        /* acc =  b0 * x[n] + b1 * x[n-1] + b2 * x[n-2] + a1 * y[n-1] + a2 * y[n-2] */
+        out = __SMUAD(b0, in);
+        acc = __SMLALD(b1, state_in, out);
+        acc = __SMLALD(a1, state_out, acc);
+
+        /* 3.29 to 1.15 if postShift = 1, then saturated */
+        out = __SSAT((q31_t) (acc >> lShift), 16);
+
+        *pOut = (q15_t) out;
+        pOut += numFilters;
+
+        /* x[n-1] = x[n], x[n-2] = x[n-1] and the same for y */
+        state_in = __PKHBT(in, state_in, 16);
+        state_out = __PKHBT(out, state_out, 16);
+
+        sample--;
+      }
+
+      _SIMD32_OFFSET(pState) = state_in;
+      _SIMD32_OFFSET(pState + (2u * numFilters)) = state_out;
+
+      /*  The first stage goes from the input to the output of the filter,
+       *  the next stages run in place on the output of the filter. */
+      pIn = pDst + f;
+      inStride = numFilters;
+      pState += 4u * numFilters;
+      pCoeffs += 6u * numFilters;
+
+      stage--;
+
+    } while(stage > 0u);
+  }
+}
+
+/**
+ * @} end of BiquadCascadeDF1Bank group
+ */
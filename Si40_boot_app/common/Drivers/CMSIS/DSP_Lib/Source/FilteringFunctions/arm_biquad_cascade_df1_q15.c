@@ -72,7 +72,7 @@
  * Refer to the function <code>arm_biquad_cascade_df1_fast_q15()</code> for a faster but less precise implementation of this filter for Cortex-M3 and Cortex-M4.    
  */
 
-void arm_biquad_cascade_df1_q15(
+void ARM_MATH_PORTABLE(arm_biquad_cascade_df1_q15)(
   const arm_biquad_casd_df1_inst_q15 * S,
   q15_t * pSrc,
   q15_t * pDst,
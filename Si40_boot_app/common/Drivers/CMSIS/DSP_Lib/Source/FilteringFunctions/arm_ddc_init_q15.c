@@ -0,0 +1,79 @@
+/* ----------------------------------------------------------------------
+* $Date:        19. October 2026
+*
+* Project:      CMSIS DSP Library
+* Title:        arm_ddc_init_q15.c
+*
+* Description:  Initialization function for the Q15 digital down converter.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup DDC
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the Q15 digital down converter.
+ * @param[in,out] *S           points to an instance of the Q15 digital down converter structure.
+ * @param[in]     numTaps      number of coefficients of the lowpass filter.
+ * @param[in]     M            decimation factor.
+ * @param[in]     *pCoeffs     points to the lowpass filter coefficients, time reversed as for arm_fir_decimate_init_q15().
+ * @param[in]     centerFreq   frequency in Hz that is moved to 0 Hz.
+ * @param[in]     sampleRate   input sample rate in Hz.
+ * @param[in]     *pState      points to the state buffer of 2*(numTaps+blockSize-1) values.
+ * @param[in]     *pScratch    points to the scratch buffer of 2*blockSize values.
+ * @param[in]     blockSize    largest number of input samples per call.
+ * @return        ARM_MATH_SUCCESS, ARM_MATH_LENGTH_ERROR if <code>blockSize</code> is not a multiple of
+ * <code>M</code> or ARM_MATH_ARGUMENT_ERROR if <code>centerFreq</code> is not inside [0, sampleRate/2).
+ *
+ * \par
+ * The oscillator starts at phase 0 and steps by round(2^32 * centerFreq / sampleRate) a
+ * sample, the frequency is off by less than sampleRate / 2^33. The two decimators share
+ * the coefficients, each has one half of <code>pState</code>, both are cleared.
+ */
+
+arm_status arm_ddc_init_q15(
+  arm_ddc_instance_q15 * S,
+  uint16_t numTaps,
+  uint8_t M,
+  q15_t * pCoeffs,
+  uint32_t centerFreq,
+  uint32_t sampleRate,
+  q15_t * pState,
+  q15_t * pScratch,
+  uint32_t blockSize)
+{
+  arm_status status;
+
+  if((M == 0u) || (2u * (uint64_t) centerFreq >= sampleRate))
+  {
+    return ARM_MATH_ARGUMENT_ERROR;
+  }
+
+  status = arm_fir_decimate_init_q15(&S->re, numTaps, M, pCoeffs, pState, blockSize);
+  if(status != ARM_MATH_SUCCESS)
+  {
+    return status;
+  }
+  (void) arm_fir_decimate_init_q15(&S->im, numTaps, M, pCoeffs, pState + (numTaps + (blockSize - 1u)),
+                                   blockSize);
+
+  S->phase = 0u;
+  S->phaseInc = (uint32_t) ((((uint64_t) centerFreq << 32) + (sampleRate / 2u)) / sampleRate);
+  S->blockSize = blockSize;
+  S->pScratch = pScratch;
+
+  return ARM_MATH_SUCCESS;
+}
+
+/**
+ * @} end of DDC group
+ */
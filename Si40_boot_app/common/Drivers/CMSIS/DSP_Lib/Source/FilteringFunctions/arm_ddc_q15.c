@@ -0,0 +1,95 @@
+/* ----------------------------------------------------------------------
+* $Date:        19. October 2026
+*
+* Project:      CMSIS DSP Library
+* Title:        arm_ddc_q15.c
+*
+* Description:  Q15 digital down converter, complex mixer and FIR decimators.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @defgroup DDC Digital Down Converter
+ *
+ * A digital down converter moves a band of a real signal to complex baseband at a lower
+ * rate: the samples are multiplied by exp(-j * 2 * pi * centerFreq * n / sampleRate),
+ * the oscillator of arm_sin_cos_q31(), and the in-phase and quadrature products go
+ * through the same lowpass FIR decimator, arm_fir_decimate_fast_q15(). The band
+ * centerFreq +- sampleRate / (2 * M) comes out at sampleRate / M complex samples,
+ * centerFreq at 0 Hz, lower frequencies negative.
+ *
+ * \par
+ * The functions keep their state between calls, the blocks of a stream may have any
+ * size that is a multiple of M, and need no memory but the buffers of the init.
+ */
+
+/**
+ * @addtogroup DDC
+ * @{
+ */
+
+/**
+ * @brief  Q15 digital down converter, a block of real samples to complex baseband at sampleRate/M.
+ * @param[in,out] *S          points to an instance of the Q15 digital down converter structure.
+ * @param[in]     *pSrc       points to the block of real input samples.
+ * @param[out]    *pDst       points to the complex output, 2*blockSize/M values {re, im}.
+ * @param[in]     blockSize   number of input samples, a multiple of M up to the blockSize of the init.
+ * @return        none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The products of the mixer are 1.15, rounded, so a sine of amplitude A gives a complex
+ * value of amplitude A/2 at baseband (and its image at twice centerFreq, for the
+ * lowpass to remove). Only -1 * -1 saturates. The decimators are the fast Q15 ones with
+ * a 2.30 accumulator: the sum of the absolute values of the coefficients must stay under
+ * 2 to avoid a wrap, a lowpass of gain 1 does.
+ */
+
+void arm_ddc_q15(
+  arm_ddc_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  q15_t *pRe = S->pScratch;                      /* in-phase products */
+  q15_t *pIm = S->pScratch + S->blockSize;       /* quadrature products */
+  q31_t sinVal, cosVal;
+  q63_t x;
+  uint32_t phase = S->phase;
+  uint32_t phaseInc = S->phaseInc;
+  uint32_t outSize = blockSize / S->re.M;
+  uint32_t i;
+
+  /* x * exp(-j phase), 1.15 x 1.31 products rounded to 1.15 */
+  for (i = 0u; i < blockSize; i++)
+  {
+    arm_sin_cos_q31((q31_t) phase, &sinVal, &cosVal);
+    x = (q63_t) pSrc[i];
+    pRe[i] = (q15_t) __SSAT((q31_t) (((x * cosVal) + 0x40000000) >> 31), 16);
+    pIm[i] = (q15_t) __SSAT((q31_t) (((-(x * sinVal)) + 0x40000000) >> 31), 16);
+    phase += phaseInc;
+  }
+  S->phase = phase;
+
+  /* both branches into pDst, then interleaved through the scratch */
+  arm_fir_decimate_fast_q15(&S->re, pRe, pDst, blockSize);
+  arm_fir_decimate_fast_q15(&S->im, pIm, pDst + outSize, blockSize);
+  arm_copy_q15(pDst, S->pScratch, 2u * outSize);
+
+  for (i = 0u; i < outSize; i++)
+  {
+    pDst[2u * i] = S->pScratch[i];
+    pDst[(2u * i) + 1u] = S->pScratch[outSize + i];
+  }
+}
+
+/**
+ * @} end of DDC group
+ */
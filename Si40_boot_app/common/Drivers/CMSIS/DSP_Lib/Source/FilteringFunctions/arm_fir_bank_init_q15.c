@@ -0,0 +1,86 @@
+/* ----------------------------------------------------------------------
+* $Date:        19. October 2026
+*
+* Project:      CMSIS DSP Library
+* Title:        arm_fir_bank_init_q15.c
+*
+* Description:  Initialization function for the Q15 FIR filter bank.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIRBank
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the Q15 FIR filter bank.
+ * @param[in,out] *S              points to an instance of the Q15 FIR filter bank structure.
+ * @param[in]     numFilters      number of filters in the bank.
+ * @param[in]     numTaps         number of coefficients of every filter. Must be even and greater than or equal to 4.
+ * @param[in]     *pFilterCoeffs  points to the coefficients of the filters one after another, numTaps each.
+ * @param[out]    *pCoeffs        points to the coefficient buffer of the bank, numTaps*numFilters values.
+ * @param[in]     *pState         points to the state buffer, numTaps+blockSize-1 values.
+ * @param[in]     blockSize       number of samples that are processed per call.
+ * @return        The function returns ARM_MATH_SUCCESS if initialization was successful or ARM_MATH_ARGUMENT_ERROR if
+ * <code>numTaps</code> is not a supported value.
+ *
+ * <b>Description:</b>
+ * \par
+ * The coefficients of every filter are in time reversed order as for arm_fir_init_q15().
+ * They are copied to <code>pCoeffs</code> two by two, the pair k of all the filters is
+ * contiguous:
+ * <pre>
+ *     {b0[0], b0[1], b1[0], b1[1], ..., b0[2], b0[3], b1[2], b1[3], ...}
+ * </pre>
+ * where bf[k] is coefficient k of filter f. The filters share the state of the input,
+ * <code>pState</code> is zeroed here.
+ */
+
+arm_status arm_fir_bank_init_q15(
+  arm_fir_bank_instance_q15 * S,
+  uint16_t numFilters,
+  uint16_t numTaps,
+  const q15_t * pFilterCoeffs,
+  q15_t * pCoeffs,
+  q15_t * pState,
+  uint32_t blockSize)
+{
+  uint32_t f, k;
+
+  /* The Number of filter coefficients in the filter must be even and at least 4 */
+  if((numTaps & 0x1u) || (numTaps < 4u))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  for (f = 0u; f < numFilters; f++)
+  {
+    for (k = 0u; k < numTaps; k += 2u)
+    {
+      pCoeffs[(k * numFilters) + (2u * f)] = pFilterCoeffs[(f * numTaps) + k];
+      pCoeffs[(k * numFilters) + (2u * f) + 1u] = pFilterCoeffs[(f * numTaps) + k + 1u];
+    }
+  }
+
+  S->numFilters = numFilters;
+  S->numTaps = numTaps;
+  S->pCoeffs = pCoeffs;
+
+  /* Clear the state buffer.  The size is always (numTaps + blockSize - 1) */
+  memset(pState, 0, (numTaps + (blockSize - 1u)) * sizeof(q15_t));
+  S->pState = pState;
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of FIRBank group
+ */
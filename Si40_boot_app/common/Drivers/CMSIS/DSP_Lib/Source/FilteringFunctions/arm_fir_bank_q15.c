@@ -0,0 +1,156 @@
+/* ----------------------------------------------------------------------
+* $Date:        19. October 2026
+*
+* Project:      CMSIS DSP Library
+* Title:        arm_fir_bank_q15.c
+*
+* Description:  Processing function for the Q15 FIR filter bank.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @defgroup FIRBank FIR Filter Bank
+ *
+ * A bank of Q15 FIR filters of the same length run over the same input block. Each
+ * filter computes exactly the output of arm_fir_q15() with its coefficients; the input
+ * is copied to the state once for all the filters instead of once per filter.
+ *
+ * \par
+ * The output block holds <code>blockSize * numFilters</code> values interleaved by filter,
+ * <code>pDst[n * numFilters + f]</code> is sample n of filter f.
+ *
+ * \par
+ * The coefficient pairs are stored filter after filter (see arm_fir_bank_init_q15()), so
+ * on the host build arm_math_host.h multiplies one input pair by the pair of every filter
+ * of a vector at once. On the Cortex-M the filters run one after the other, 4 outputs per
+ * pass over the coefficients as arm_fir_q15().
+ *
+ * \par
+ * <code>pDst</code> must not overlap <code>pSrc</code>.
+ */
+
+/**
+ * @addtogroup FIRBank
+ * @{
+ */
+
+/**
+ * @brief Processing function for the Q15 FIR filter bank.
+ * @param[in]  *S          points to an instance of the Q15 FIR filter bank structure.
+ * @param[in]  *pSrc       points to the block of input data.
+ * @param[out] *pDst       points to the block of output data, blockSize*numFilters values interleaved by filter.
+ * @param[in]  blockSize   number of samples to process per call.
+ * @return     none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The same as arm_fir_q15(): a 64-bit accumulator in 34.30 format, truncated to 1.15
+ * format and saturated.
+ */
+
+void ARM_MATH_PORTABLE(arm_fir_bank_q15)(
+  const arm_fir_bank_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  q15_t *pState = S->pState;                     /* State pointer */
+  q15_t *pCoeffs = S->pCoeffs;                   /* Coefficient pointer */
+  q15_t *px;                                     /* Temporary pointer for state buffer */
+  q15_t *pb;                                     /* Temporary pointer for coefficient buffer */
+  q31_t x0, x1, x2, x3, c0;                      /* Temporary variables to hold SIMD state and coefficient values */
+  q63_t acc0, acc1, acc2, acc3;                  /* Accumulators */
+  uint32_t numFilters = (uint32_t) S->numFilters;
+  uint32_t numTaps = (uint32_t) S->numTaps;      /* Number of taps in the filter */
+  uint32_t f, n, tapCnt;
+
+  /* The state holds numTaps - 1 old samples and the block of all the filters */
+  memcpy(pState + (numTaps - 1u), pSrc, blockSize * sizeof(q15_t));
+
+  for (f = 0u; f < numFilters; f++)
+  {
+    /* 4 outputs per pass over the coefficients of the filter */
+    for (n = 0u; (n + 4u) <= blockSize; n += 4u)
+    {
+      acc0 = 0;
+      acc1 = 0;
+      acc2 = 0;
+      acc3 = 0;
+
+      px = pState + n;
+      pb = pCoeffs + (2u * f);
+
+      /* x[n], x[n+1] and x[n+1], x[n+2] */
+      x0 = _SIMD32_OFFSET(px);
+      x1 = _SIMD32_OFFSET(px + 1);
+      px += 2u;
+
+      tapCnt = numTaps >> 1u;
+
+      do
+      {
+        /* The coefficient pair of the filter, the next pair is numFilters words on */
+        c0 = _SIMD32_OFFSET(pb);
+        pb += 2u * numFilters;
+
+        x2 = _SIMD32_OFFSET(px);
+        x3 = _SIMD32_OFFSET(px + 1);
+        px += 2u;
+
+        acc0 = __SMLALD(x0, c0, acc0);
+        acc1 = __SMLALD(x1, c0, acc1);
+        acc2 = __SMLALD(x2, c0, acc2);
+        acc3 = __SMLALD(x3, c0, acc3);
+
+        x0 = x2;
+        x1 = x3;
+
+        tapCnt--;
+
+      } while(tapCnt > 0u);
+
+      /* The results in the 4 accumulators are in 2.30 format.  Convert to 1.15 with saturation. */
+      pDst[(n * numFilters) + f] = (q15_t) (__SSAT((acc0 >> 15), 16));
+      pDst[((n + 1u) * numFilters) + f] = (q15_t) (__SSAT((acc1 >> 15), 16));
+      pDst[((n + 2u) * numFilters) + f] = (q15_t) (__SSAT((acc2 >> 15), 16));
+      pDst[((n + 3u) * numFilters) + f] = (q15_t) (__SSAT((acc3 >> 15), 16));
+    }
+
+    /* The remaining outputs, one at a time */
+    for (; n < blockSize; n++)
+    {
+      acc0 = 0;
+
+      px = pState + n;
+      pb = pCoeffs + (2u * f);
+
+      tapCnt = numTaps >> 1u;
+
+      do
+      {
+        acc0 = __SMLALD(_SIMD32_OFFSET(px), _SIMD32_OFFSET(pb), acc0);
+        px += 2u;
+        pb += 2u * numFilters;
+
+        tapCnt--;
+
+      } while(tapCnt > 0u);
+
+      pDst[(n * numFilters) + f] = (q15_t) (__SSAT((acc0 >> 15), 16));
+    }
+  }
+
+  /* Processing is complete.  Now copy the last numTaps - 1 samples to the start of the state buffer. */
+  memmove(pState, pState + blockSize, (numTaps - 1u) * sizeof(q15_t));
+}
+
+/**
+ * @} end of FIRBank group
+ */
@@ -82,7 +82,7 @@
 #ifndef UNALIGNED_SUPPORT_DISABLE
 
 
-void arm_fir_q15(
+void ARM_MATH_PORTABLE(arm_fir_q15)(
   const arm_fir_instance_q15 * S,
   q15_t * pSrc,
   q15_t * pDst,
@@ -325,7 +325,7 @@ void arm_fir_q15(
 
 #else /* UNALIGNED_SUPPORT_DISABLE */
 
-void arm_fir_q15(
+void ARM_MATH_PORTABLE(arm_fir_q15)(
   const arm_fir_instance_q15 * S,
   q15_t * pSrc,
   q15_t * pDst,
@@ -600,7 +600,7 @@ void arm_fir_q15(
 
 /* Run the below code for Cortex-M0 */
 
-void arm_fir_q15(
+void ARM_MATH_PORTABLE(arm_fir_q15)(
   const arm_fir_instance_q15 * S,
   q15_t * pSrc,
   q15_t * pDst,
@@ -0,0 +1,79 @@
+/* ----------------------------------------------------------------------
+* $Date:        19. October 2026
+*
+* Project:      CMSIS DSP Library, host build
+* Title:        arm_host_avx2.c
+*
+* Description:  AVX2 kernels of the host functions, 256 bit vectors of
+*               arm_host_kernels.h
+*
+* Target Processor: x86-64 host, see arm_math_host.h
+* -------------------------------------------------------------------- */
+
+#include "arm_host_simd.h"
+#include <immintrin.h>
+
+#define HOST_ISA              avx2
+#define HOST_TARGET           __attribute__((target("avx2")))
+#define V_WORDS               8u
+
+typedef __m256i v_t;
+
+#define vLoad(p)              _mm256_loadu_si256((const __m256i *) (const void *) (p))
+#define vStore(p, x)          _mm256_storeu_si256((__m256i *) (void *) (p), (x))
+#define vAdds16(a, b)         _mm256_adds_epi16((a), (b))
+#define vSubs16(a, b)         _mm256_subs_epi16((a), (b))
+#define vAdd16(a, b)          _mm256_add_epi16((a), (b))
+#define vSub16(a, b)          _mm256_sub_epi16((a), (b))
+#define vSrai16(x, n)         _mm256_srai_epi16((x), (n))
+#define vSlli16(x, n)         _mm256_slli_epi16((x), (n))
+#define vAnd(a, b)            _mm256_and_si256((a), (b))
+#define vXor(a, b)            _mm256_xor_si256((a), (b))
+#define vAndnot(a, b)         _mm256_andnot_si256((a), (b))
+#define vMadd(a, b)           _mm256_madd_epi16((a), (b))
+#define vSub32(a, b)          _mm256_sub_epi32((a), (b))
+#define vSrli32(x, n)         _mm256_srli_epi32((x), (n))
+#define vSet1(x)              _mm256_set1_epi32((int32_t) (x))
+#define vBlendOdd16(a, b)     _mm256_blend_epi16((a), (b), 0xAA)
+#define vSwap16(x)            _mm256_shufflehi_epi16(_mm256_shufflelo_epi16((x), 0xB1), 0xB1)
+#define vUnpackLo32(a, b)     _mm256_unpacklo_epi32((a), (b))
+#define vUnpackHi32(a, b)     _mm256_unpackhi_epi32((a), (b))
+#define vUnpackLo64(a, b)     _mm256_unpacklo_epi64((a), (b))
+#define vUnpackHi64(a, b)     _mm256_unpackhi_epi64((a), (b))
+#define vCvtLo64(x)           _mm256_cvtepi32_epi64(_mm256_castsi256_si128(x))
+#define vCvtHi64(x)           _mm256_cvtepi32_epi64(_mm256_extracti128_si256((x), 1))
+#define vAdd64(a, b)          _mm256_add_epi64((a), (b))
+#define vSrli64(x, n)         _mm256_srli_epi64((x), (n))
+#define vMul32(a, b)          _mm256_mul_epi32((a), (b))
+#define vAdd32(a, b)          _mm256_add_epi32((a), (b))
+#define vSrai32(x, n)         _mm256_sra_epi32((x), _mm_cvtsi32_si128((int) (n)))
+#define vSlli32(x, n)         _mm256_slli_epi32((x), (n))
+#define vOr(a, b)             _mm256_or_si256((a), (b))
+#define vMin32(a, b)          _mm256_min_epi32((a), (b))
+#define vMax32(a, b)          _mm256_max_epi32((a), (b))
+
+HOST_TARGET static inline q63_t vSum64(v_t x)
+{
+  __m128i s = _mm_add_epi64(_mm256_castsi256_si128(x), _mm256_extracti128_si256(x, 1));
+
+  return (q63_t) _mm_cvtsi128_si64(s) + (q63_t) _mm_extract_epi64(s, 1);
+}
+
+HOST_TARGET static inline v_t vGather(const int32_t * w, uint32_t i, uint32_t s)
+{
+  const __m256i step = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+
+  if (s == 1u)
+    return vLoad(w + i);
+  return _mm256_i32gather_epi32((const int *) (w + i),
+                                _mm256_mullo_epi32(step, _mm256_set1_epi32((int32_t) s)), 4);
+}
+
+/* packs works in 128 bit lanes, the halves are packed apart */
+HOST_TARGET static inline void vStoreSat16(q15_t * p, v_t x)
+{
+  _mm_storeu_si128((__m128i *) (void *) p,
+                   _mm_packs_epi32(_mm256_castsi256_si128(x), _mm256_extracti128_si256(x, 1)));
+}
+
+#include "arm_host_kernels.h"
@@ -0,0 +1,848 @@
+/* ----------------------------------------------------------------------
+* $Date:        19. October 2026
+*
+* Project:      CMSIS DSP Library, host build
+* Title:        arm_host_kernels.h
+*
+* Description:  Kernels of the host functions written once for a vector of
+*               V_WORDS 32 bit words. Included by arm_host_sse41.c and
+*               arm_host_avx2.c, which define the vector operations below
+*               for their instruction set.
+*
+* Target Processor: x86-64 host, see arm_math_host.h
+* -------------------------------------------------------------------- */
+
+/*
+   Operations of the including file (lanes of 16, 32 or 64 bit):
+
+     v_t                  vector type, V_WORDS words
+     HOST_ISA             suffix of the kernels, sse41 or avx2
+     HOST_TARGET          target attribute of the functions
+     vLoad(p) vStore(p,x) unaligned
+     vAdds16 vSubs16      saturating, QADD16 QSUB16 lane by lane
+     vAdd16 vSub16 vSrai16 vSlli16 vAnd vXor vAndnot(a,b) = ~a & b
+     vMadd                pmaddwd, SMUAD of every word
+     vAdd32 vSub32 vSrli32 vSlli32 vSet1(x)
+     vSrai32(x, n)        any count n, not only a constant
+     vOr vMin32 vMax32
+     vStoreSat16(p, x)    the words saturated to 16 bit, V_WORDS q15 at p
+     vBlendOdd16(a,b)     low halfwords of a, high halfwords of b
+     vSwap16(x)           halfwords of every word swapped
+     vUnpackLo32 vUnpackHi32 vUnpackLo64 vUnpackHi64   in 128 bit lanes
+     vCvtLo64 vCvtHi64    first and second half words sign extended to 64 bit
+     vAdd64 vSrli64
+     vMul32               pmuldq, even words to 64 bit products
+     vSum64(x)            sum of the 64 bit lanes
+     vGather(w, i, s)     words w[i], w[i + s], ... w[i + (V_WORDS - 1)*s]
+
+   A word is one q15 complex value or two q15 samples, low halfword first,
+   as _SIMD32_OFFSET() of the library reads them.
+ */
+
+#define KERNEL__(name, isa)   name##_##isa
+#define KERNEL_(name, isa)    KERNEL__(name, isa)
+#define KERNEL(name)          KERNEL_(name, HOST_ISA)
+
+#define BIQUAD_CHUNK          256u    /* samples of the feed forward buffer */
+
+
+/* ----------------------------------------------------------------------
+ * Packed q15 instructions of arm_math.h, every word
+ * -------------------------------------------------------------------- */
+
+/* SHADD16, exact halving: a + b = (a ^ b) + 2(a & b) */
+HOST_TARGET static inline v_t vShadd16(v_t a, v_t b)
+{
+  return vAdd16(vAnd(a, b), vSrai16(vXor(a, b), 1));
+}
+
+/* SHSUB16, exact halving: a - b = (a ^ b) - 2(~a & b) */
+HOST_TARGET static inline v_t vShsub16(v_t a, v_t b)
+{
+  return vSub16(vSrai16(vXor(a, b), 1), vAndnot(a, b));
+}
+
+/* QASX: low x.lo - y.hi, high x.hi + y.lo, saturated */
+HOST_TARGET static inline v_t vQasx(v_t x, v_t y)
+{
+  v_t ys = vSwap16(y);
+  return vBlendOdd16(vSubs16(x, ys), vAdds16(x, ys));
+}
+
+/* QSAX: low x.lo + y.hi, high x.hi - y.lo, saturated */
+HOST_TARGET static inline v_t vQsax(v_t x, v_t y)
+{
+  v_t ys = vSwap16(y);
+  return vBlendOdd16(vAdds16(x, ys), vSubs16(x, ys));
+}
+
+/* SHASX, halving QASX */
+HOST_TARGET static inline v_t vShasx(v_t x, v_t y)
+{
+  v_t ys = vSwap16(y);
+  return vBlendOdd16(vShsub16(x, ys), vShadd16(x, ys));
+}
+
+/* SHSAX, halving QSAX */
+HOST_TARGET static inline v_t vShsax(v_t x, v_t y)
+{
+  v_t ys = vSwap16(y);
+  return vBlendOdd16(vShadd16(x, ys), vShsub16(x, ys));
+}
+
+/* twiddle multiply of the butterflies, word of the upper halfwords of
+   forward: SMUAD(c, x) and SMUSDX(c, x)
+   inverse: SMUSD(c, x) and SMUADX(c, x)
+   the dual multiplies wrap at 32 bit like the C of arm_math.h */
+HOST_TARGET static inline v_t vCmul(v_t c, v_t x, int inverse)
+{
+  const v_t lo = vSet1(0x0000FFFF);
+  v_t xs = vSwap16(x), out1, out2;
+
+  if(inverse)
+  {
+    out1 = vSub32(vMadd(c, vAnd(x, lo)), vMadd(c, vAndnot(lo, x)));
+    out2 = vMadd(c, xs);
+  }
+  else
+  {
+    out1 = vMadd(c, x);
+    out2 = vSub32(vMadd(c, vAnd(xs, lo)), vMadd(c, vAndnot(lo, xs)));
+  }
+  return vBlendOdd16(vSrli32(out1, 16), out2);
+}
+
+/* 4 x 4 words transposed in every 128 bit lane */
+#define vTranspose4(r0, r1, r2, r3)                                            \
+  do                                                                           \
+  {                                                                            \
+    v_t t0 = vUnpackLo32(r0, r1), t1 = vUnpackLo32(r2, r3);                    \
+    v_t t2 = vUnpackHi32(r0, r1), t3 = vUnpackHi32(r2, r3);                    \
+    r0 = vUnpackLo64(t0, t1);                                                  \
+    r1 = vUnpackHi64(t0, t1);                                                  \
+    r2 = vUnpackLo64(t2, t3);                                                  \
+    r3 = vUnpackHi64(t2, t3);                                                  \
+  } while(0)
+
+
+/* ----------------------------------------------------------------------
+ * arm_fir_q15
+ * -------------------------------------------------------------------- */
+
+/* one output of the unrolled loop of the portable C: sum of the SMLALD of
+   the coefficient pairs, every pair wraps at 32 bit */
+HOST_TARGET static inline q63_t firDot(const q15_t * px, const q15_t * pb, uint32_t numTaps)
+{
+  v_t acc = vSet1(0);
+  q63_t sum;
+  uint32_t k = 0u;
+
+  for (; k + 2u * V_WORDS <= numTaps; k += 2u * V_WORDS)
+  {
+    v_t m = vMadd(vLoad(px + k), vLoad(pb + k));
+    acc = vAdd64(acc, vCvtLo64(m));
+    acc = vAdd64(acc, vCvtHi64(m));
+  }
+  sum = vSum64(acc);
+  for (; k < numTaps; k += 2u)
+  {
+    sum += (q31_t) ((uint32_t) ((q31_t) px[k] * pb[k]) +
+                    (uint32_t) ((q31_t) px[k + 1] * pb[k + 1]));
+  }
+  return sum;
+}
+
+/* 2*V_WORDS outputs at once, every coefficient pair broadcast: the words
+   of px are the pairs of the even outputs, the words of px + 1 the pairs
+   of the odd ones */
+HOST_TARGET static inline void firOutputs(const q15_t * px, const q15_t * pb, uint32_t numTaps, q15_t * pDst)
+{
+  q63_t even[V_WORDS], odd[V_WORDS];
+  v_t e0 = vSet1(0), e1 = vSet1(0), o0 = vSet1(0), o1 = vSet1(0);
+  uint32_t k;
+
+  for (k = 0u; k < numTaps; k += 2u)
+  {
+    v_t c = vSet1(*(const int32_t *) (const void *) (pb + k));
+    v_t me = vMadd(vLoad(px + k), c);
+    v_t mo = vMadd(vLoad(px + k + 1), c);
+
+    e0 = vAdd64(e0, vCvtLo64(me));
+    e1 = vAdd64(e1, vCvtHi64(me));
+    o0 = vAdd64(o0, vCvtLo64(mo));
+    o1 = vAdd64(o1, vCvtHi64(mo));
+  }
+  vStore(even, e0);
+  vStore(even + V_WORDS / 2u, e1);
+  vStore(odd, o0);
+  vStore(odd + V_WORDS / 2u, o1);
+  for (k = 0u; k < V_WORDS; k++)
+  {
+    pDst[2u * k] = (q15_t) __SSAT((q31_t) (even[k] >> 15), 16);
+    pDst[2u * k + 1u] = (q15_t) __SSAT((q31_t) (odd[k] >> 15), 16);
+  }
+}
+
+HOST_TARGET void KERNEL(arm_host_fir_q15)(
+  const arm_fir_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  q15_t *pState = S->pState;
+  q15_t *pCoeffs = S->pCoeffs;
+  uint32_t numTaps = S->numTaps;
+  uint32_t n;
+
+  /* the state holds numTaps - 1 old samples and the block, in place works
+     as the input is copied before the first output */
+  memcpy(pState + numTaps - 1u, pSrc, blockSize * sizeof(q15_t));
+
+  for (n = 0u; n + 2u * V_WORDS <= blockSize; n += 2u * V_WORDS)
+  {
+    firOutputs(pState + n, pCoeffs, numTaps, pDst + n);
+  }
+  for (; n < blockSize; n++)
+  {
+    pDst[n] = (q15_t) __SSAT((q31_t) (firDot(pState + n, pCoeffs, numTaps) >> 15), 16);
+  }
+
+  memmove(pState, pState + blockSize, (numTaps - 1u) * sizeof(q15_t));
+}
+
+
+/* ----------------------------------------------------------------------
+ * arm_fir_bank_q15
+ * -------------------------------------------------------------------- */
+
+/* The filters of a vector at once, one pair of the input broadcast to the
+   coefficient pairs of the filters. acc >> 15 of the portable C is taken
+   exactly in 32 bit: the sum of every m >> 15 and of the low 15 bits. */
+HOST_TARGET static inline v_t firBankSum(v_t hi, v_t lo)
+{
+  return vAdd32(hi, vSrai32(lo, 15));
+}
+
+/* outputs n to n + 3 of V_WORDS filters, pDst at output n of the first */
+HOST_TARGET static inline void firBankOutputs(
+  const q15_t * px,
+  const q15_t * pb,
+  uint32_t numTaps,
+  uint32_t numFilters,
+  q15_t * pDst)
+{
+  const v_t low = vSet1(0x7FFF);
+  v_t h0 = vSet1(0), h1 = vSet1(0), h2 = vSet1(0), h3 = vSet1(0);
+  v_t l0 = vSet1(0), l1 = vSet1(0), l2 = vSet1(0), l3 = vSet1(0);
+  uint32_t k;
+
+  for (k = 0u; k < numTaps; k += 2u)
+  {
+    v_t c = vLoad(pb);
+    v_t m0 = vMadd(vSet1(*(const int32_t *) (const void *) (px + k)), c);
+    v_t m1 = vMadd(vSet1(*(const int32_t *) (const void *) (px + k + 1)), c);
+    v_t m2 = vMadd(vSet1(*(const int32_t *) (const void *) (px + k + 2)), c);
+    v_t m3 = vMadd(vSet1(*(const int32_t *) (const void *) (px + k + 3)), c);
+
+    h0 = vAdd32(h0, vSrai32(m0, 15));
+    l0 = vAdd32(l0, vAnd(m0, low));
+    h1 = vAdd32(h1, vSrai32(m1, 15));
+    l1 = vAdd32(l1, vAnd(m1, low));
+    h2 = vAdd32(h2, vSrai32(m2, 15));
+    l2 = vAdd32(l2, vAnd(m2, low));
+    h3 = vAdd32(h3, vSrai32(m3, 15));
+    l3 = vAdd32(l3, vAnd(m3, low));
+    pb += 2u * numFilters;
+  }
+  vStoreSat16(pDst, firBankSum(h0, l0));
+  vStoreSat16(pDst + numFilters, firBankSum(h1, l1));
+  vStoreSat16(pDst + 2u * numFilters, firBankSum(h2, l2));
+  vStoreSat16(pDst + 3u * numFilters, firBankSum(h3, l3));
+}
+
+/* outputs n to n + 3 of V_WORDS filters whose sum of |coefficient| is
+   below 2.0: no pair wraps and the sum stays in 32 bit, so the words add
+   up without the split */
+HOST_TARGET static inline void firBankOutputsShort(
+  const q15_t * px,
+  const q15_t * pb,
+  uint32_t numTaps,
+  uint32_t numFilters,
+  q15_t * pDst)
+{
+  v_t a0 = vSet1(0), a1 = vSet1(0), a2 = vSet1(0), a3 = vSet1(0);
+  uint32_t k;
+
+  for (k = 0u; k < numTaps; k += 2u)
+  {
+    v_t c = vLoad(pb);
+
+    a0 = vAdd32(a0, vMadd(vSet1(*(const int32_t *) (const void *) (px + k)), c));
+    a1 = vAdd32(a1, vMadd(vSet1(*(const int32_t *) (const void *) (px + k + 1)), c));
+    a2 = vAdd32(a2, vMadd(vSet1(*(const int32_t *) (const void *) (px + k + 2)), c));
+    a3 = vAdd32(a3, vMadd(vSet1(*(const int32_t *) (const void *) (px + k + 3)), c));
+    pb += 2u * numFilters;
+  }
+  vStoreSat16(pDst, vSrai32(a0, 15));
+  vStoreSat16(pDst + numFilters, vSrai32(a1, 15));
+  vStoreSat16(pDst + 2u * numFilters, vSrai32(a2, 15));
+  vStoreSat16(pDst + 3u * numFilters, vSrai32(a3, 15));
+}
+
+/* 1 if the sum of |coefficient| of every filter of the group is below 2.0,
+   |acc| < 32768 * 65536 */
+static int firBankShort(
+  const q15_t * pb,
+  uint32_t numTaps,
+  uint32_t numFilters)
+{
+  uint32_t f, k;
+
+  for (f = 0u; f < 2u * V_WORDS; f += 2u)
+  {
+    int32_t sum = 0;
+
+    for (k = 0u; k < numTaps; k += 2u)
+    {
+      const q15_t *c = pb + k * numFilters + f;
+
+      sum += ((c[0] < 0) ? -c[0] : c[0]) + ((c[1] < 0) ? -c[1] : c[1]);
+    }
+    if (sum >= 0x10000)
+      return 0;
+  }
+  return 1;
+}
+
+/* one output of V_WORDS filters */
+HOST_TARGET static inline void firBankOutput(
+  const q15_t * px,
+  const q15_t * pb,
+  uint32_t numTaps,
+  uint32_t numFilters,
+  q15_t * pDst)
+{
+  const v_t low = vSet1(0x7FFF);
+  v_t h = vSet1(0), l = vSet1(0);
+  uint32_t k;
+
+  for (k = 0u; k < numTaps; k += 2u)
+  {
+    v_t m = vMadd(vSet1(*(const int32_t *) (const void *) (px + k)), vLoad(pb));
+
+    h = vAdd32(h, vSrai32(m, 15));
+    l = vAdd32(l, vAnd(m, low));
+    pb += 2u * numFilters;
+  }
+  vStoreSat16(pDst, firBankSum(h, l));
+}
+
+HOST_TARGET void KERNEL(arm_host_fir_bank_q15)(
+  const arm_fir_bank_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  q15_t *pState = S->pState;
+  q15_t *pCoeffs = S->pCoeffs;
+  uint32_t numFilters = S->numFilters;
+  uint32_t numTaps = S->numTaps;
+  uint32_t f, n;
+
+  if (numFilters < V_WORDS)
+  {
+    if (V_WORDS > 4u && numFilters >= 4u)
+      arm_host_fir_bank_q15_sse41(S, pSrc, pDst, blockSize);
+    else
+      arm_fir_bank_q15_portable(S, pSrc, pDst, blockSize);
+    return;
+  }
+
+  memcpy(pState + numTaps - 1u, pSrc, blockSize * sizeof(q15_t));
+
+  for (f = 0u; f < numFilters; f += V_WORDS)
+  {
+    /* the last group overlaps the one before, the filters of both write
+       the same outputs */
+    if (f + V_WORDS > numFilters)
+      f = numFilters - V_WORDS;
+
+    if (firBankShort(pCoeffs + 2u * f, numTaps, numFilters))
+    {
+      for (n = 0u; n + 4u <= blockSize; n += 4u)
+      {
+        firBankOutputsShort(pState + n, pCoeffs + 2u * f, numTaps, numFilters, pDst + n * numFilters + f);
+      }
+    }
+    else
+    {
+      for (n = 0u; n + 4u <= blockSize; n += 4u)
+      {
+        firBankOutputs(pState + n, pCoeffs + 2u * f, numTaps, numFilters, pDst + n * numFilters + f);
+      }
+    }
+    for (; n < blockSize; n++)
+    {
+      firBankOutput(pState + n, pCoeffs + 2u * f, numTaps, numFilters, pDst + n * numFilters + f);
+    }
+  }
+
+  memmove(pState, pState + blockSize, (numTaps - 1u) * sizeof(q15_t));
+}
+
+
+/* ----------------------------------------------------------------------
+ * arm_cfft_q15, radix-4 butterflies of arm_cfft_radix4_q15.c
+ * -------------------------------------------------------------------- */
+
+/* first stage, the inputs scaled by 4, V_WORDS butterflies of j at once */
+HOST_TARGET static void radix4First(
+  int32_t * p,
+  uint32_t n2,
+  const int32_t * w,
+  uint32_t twidCoefModifier,
+  int inverse)
+{
+  uint32_t j;
+
+  for (j = 0u; j < n2; j += V_WORDS)
+  {
+    uint32_t ic = j * twidCoefModifier;
+    v_t C1 = vGather(w, ic, twidCoefModifier);
+    v_t C2 = vGather(w, 2u * ic, 2u * twidCoefModifier);
+    v_t C3 = vGather(w, 3u * ic, 3u * twidCoefModifier);
+    v_t xa = vSrai16(vLoad(p + j), 2);
+    v_t xb = vSrai16(vLoad(p + j + n2), 2);
+    v_t xc = vSrai16(vLoad(p + j + 2u * n2), 2);
+    v_t xd = vSrai16(vLoad(p + j + 3u * n2), 2);
+    v_t R = vAdds16(xa, xc);
+    v_t S = vSubs16(xa, xc);
+    v_t T = vAdds16(xb, xd);
+    v_t U;
+
+    vStore(p + j, vShadd16(R, T));
+    R = vSubs16(R, T);
+    vStore(p + j + n2, vCmul(C2, R, inverse));
+    T = vSubs16(xb, xd);
+    U = S;
+    R = inverse ? vQsax(U, T) : vQasx(U, T);
+    S = inverse ? vQasx(U, T) : vQsax(U, T);
+    vStore(p + j + 2u * n2, vCmul(C1, S, inverse));
+    vStore(p + j + 3u * n2, vCmul(C3, R, inverse));
+  }
+}
+
+/* one middle stage, n2 >= V_WORDS */
+HOST_TARGET void KERNEL(arm_host_radix4_middle_q15)(
+  q15_t * pSrc16,
+  uint32_t fftLen,
+  uint32_t n2,
+  const q15_t * pCoef16,
+  uint32_t twidCoefModifier,
+  int inverse)
+{
+  int32_t *p = (int32_t *) pSrc16;
+  const int32_t *w = (const int32_t *) pCoef16;
+  uint32_t n1 = 4u * n2;
+  uint32_t j, i0;
+
+  for (j = 0u; j < n2; j += V_WORDS)
+  {
+    uint32_t ic = j * twidCoefModifier;
+    v_t C1 = vGather(w, ic, twidCoefModifier);
+    v_t C2 = vGather(w, 2u * ic, 2u * twidCoefModifier);
+    v_t C3 = vGather(w, 3u * ic, 3u * twidCoefModifier);
+
+    for (i0 = j; i0 < fftLen; i0 += n1)
+    {
+      v_t xa = vLoad(p + i0);
+      v_t xb = vLoad(p + i0 + n2);
+      v_t xc = vLoad(p + i0 + 2u * n2);
+      v_t xd = vLoad(p + i0 + 3u * n2);
+      v_t R = vAdds16(xa, xc);
+      v_t S = vSubs16(xa, xc);
+      v_t T = vAdds16(xb, xd);
+      v_t U;
+
+      vStore(p + i0, vSrai16(vShadd16(R, T), 1));
+      R = vShsub16(R, T);
+      vStore(p + i0 + n2, vCmul(C2, R, inverse));
+      T = vSubs16(xb, xd);
+      U = S;
+      R = inverse ? vShsax(U, T) : vShasx(U, T);
+      S = inverse ? vShasx(U, T) : vShsax(U, T);
+      vStore(p + i0 + 2u * n2, vCmul(C1, S, inverse));
+      vStore(p + i0 + 3u * n2, vCmul(C3, R, inverse));
+    }
+  }
+}
+
+/* last stage, butterflies of 4 neighbour words, transposed to vectors */
+HOST_TARGET static void radix4Last(
+  int32_t * p,
+  uint32_t fftLen,
+  int inverse)
+{
+  uint32_t i;
+
+  for (i = 0u; i < fftLen; i += 4u * V_WORDS)
+  {
+    v_t xa = vLoad(p + i);
+    v_t xb = vLoad(p + i + V_WORDS);
+    v_t xc = vLoad(p + i + 2u * V_WORDS);
+    v_t xd = vLoad(p + i + 3u * V_WORDS);
+    v_t R, S, T, U;
+
+    vTranspose4(xa, xb, xc, xd);
+    R = vAdds16(xa, xc);
+    T = vAdds16(xb, xd);
+    S = vSubs16(xa, xc);
+    U = vSubs16(xb, xd);
+    xa = vShadd16(R, T);
+    xb = vShsub16(R, T);
+    xc = inverse ? vShasx(S, U) : vShsax(S, U);
+    xd = inverse ? vShsax(S, U) : vShasx(S, U);
+    vTranspose4(xa, xb, xc, xd);
+    vStore(p + i, xa);
+    vStore(p + i + V_WORDS, xb);
+    vStore(p + i + 2u * V_WORDS, xc);
+    vStore(p + i + 3u * V_WORDS, xd);
+  }
+}
+
+/* arm_radix4_butterfly_q15() and arm_radix4_butterfly_inverse_q15(),
+   stages too short for the vector are done by the SSE4.1 kernels */
+HOST_TARGET void KERNEL(arm_host_radix4_q15)(
+  q15_t * pSrc16,
+  uint32_t fftLen,
+  const q15_t * pCoef16,
+  uint32_t twidCoefModifier,
+  int inverse)
+{
+  uint32_t n2 = fftLen >> 2u;
+
+  if (n2 < V_WORDS)
+  {
+    arm_host_radix4_q15_sse41(pSrc16, fftLen, pCoef16, twidCoefModifier, inverse);
+    return;
+  }
+  radix4First((int32_t *) pSrc16, n2, (const int32_t *) pCoef16, twidCoefModifier, inverse);
+  twidCoefModifier <<= 2u;
+  for (n2 >>= 2u; n2 >= 4u; n2 >>= 2u)
+  {
+    if (n2 < V_WORDS)
+    {
+      arm_host_radix4_middle_q15_sse41(pSrc16, fftLen, n2, pCoef16, twidCoefModifier, inverse);
+    }
+    else
+    {
+      KERNEL(arm_host_radix4_middle_q15)(pSrc16, fftLen, n2, pCoef16, twidCoefModifier, inverse);
+    }
+    twidCoefModifier <<= 2u;
+  }
+  radix4Last((int32_t *) pSrc16, fftLen, inverse);
+}
+
+/* arm_cfft_radix4by2_q15() and arm_cfft_radix4by2_inverse_q15() */
+HOST_TARGET static void radix4by2(
+  q15_t * pSrc,
+  uint32_t fftLen,
+  const q15_t * pCoef,
+  int inverse)
+{
+  int32_t *pSi = (int32_t *) pSrc;
+  const int32_t *pC = (const int32_t *) pCoef;
+  uint32_t n2 = fftLen >> 1u;
+  uint32_t i;
+
+  for (i = 0u; i < n2; i += V_WORDS)
+  {
+    v_t T = vSrai16(vLoad(pSi + i), 1);
+    v_t S = vSrai16(vLoad(pSi + n2 + i), 1);
+    v_t R = vSubs16(T, S);
+
+    vStore(pSi + i, vShadd16(T, S));
+    vStore(pSi + n2 + i, vCmul(vLoad(pC + i), R, inverse));
+  }
+
+  KERNEL(arm_host_radix4_q15)(pSrc, n2, pCoef, 2u, inverse);
+  KERNEL(arm_host_radix4_q15)(pSrc + fftLen, n2, pCoef, 2u, inverse);
+
+  for (i = 0u; i < fftLen; i += V_WORDS)
+  {
+    vStore(pSi + i, vSlli16(vLoad(pSi + i), 1));
+  }
+}
+
+HOST_TARGET void KERNEL(arm_host_cfft_q15)(
+  const arm_cfft_instance_q15 * S,
+  q15_t * p1,
+  uint8_t ifftFlag,
+  uint8_t bitReverseFlag)
+{
+  uint32_t L = S->fftLen;
+  int inverse = (ifftFlag == 1u);
+
+  switch (L)
+  {
+  case 16:
+  case 64:
+  case 256:
+  case 1024:
+  case 4096:
+    KERNEL(arm_host_radix4_q15)(p1, L, S->pTwiddle, 1u, inverse);
+    break;
+
+  case 32:
+  case 128:
+  case 512:
+  case 2048:
+    radix4by2(p1, L, S->pTwiddle, inverse);
+    break;
+  }
+
+  if (bitReverseFlag)
+    arm_bitreversal_16((uint16_t *) p1, S->bitRevLength, S->pBitRevTable);
+}
+
+
+/* ----------------------------------------------------------------------
+ * arm_biquad_cascade_df1_q15
+ * -------------------------------------------------------------------- */
+
+/* The feed forward part b0*x[n] + b1*x[n-1] + b2*x[n-2] of a block is done
+   in vectors, the feedback a1*y[n-1] + a2*y[n-2] stays a scalar recursion.
+   As the portable C, SMLALD of (b1, b2) and of (a1, a2) wrap at 32 bit. */
+HOST_TARGET static void biquadForward(
+  const q15_t * x,
+  uint32_t count,
+  const q15_t * pCoeffs,
+  q63_t * ffEven,
+  q63_t * ffOdd)
+{
+  /* x[-2] x[-1] are in front of x, pairs of even n start at x - 2 */
+  v_t b0 = vSet1((uint16_t) pCoeffs[0]);
+  v_t b0h = vSet1((int32_t) ((uint32_t) (uint16_t) pCoeffs[0] << 16));
+  v_t b21 = vSet1((int32_t) ((uint32_t) (uint16_t) pCoeffs[3] | ((uint32_t) (uint16_t) pCoeffs[2] << 16)));
+  uint32_t n = 0u;
+
+  for (; n + 2u * V_WORDS <= count; n += 2u * V_WORDS)
+  {
+    v_t x0 = vLoad(x + n);
+    v_t e = vAdd64(vCvtLo64(vMadd(vLoad(x + n - 2), b21)), vCvtLo64(vMadd(x0, b0)));
+    v_t eh = vAdd64(vCvtHi64(vMadd(vLoad(x + n - 2), b21)), vCvtHi64(vMadd(x0, b0)));
+    v_t o = vAdd64(vCvtLo64(vMadd(vLoad(x + n - 1), b21)), vCvtLo64(vMadd(x0, b0h)));
+    v_t oh = vAdd64(vCvtHi64(vMadd(vLoad(x + n - 1), b21)), vCvtHi64(vMadd(x0, b0h)));
+
+    vStore(ffEven + n / 2u, e);
+    vStore(ffEven + n / 2u + V_WORDS / 2u, eh);
+    vStore(ffOdd + n / 2u, o);
+    vStore(ffOdd + n / 2u + V_WORDS / 2u, oh);
+  }
+  for (; n < count; n++)
+  {
+    const q15_t *px = x + n;
+    q63_t ff = (q63_t) ((q31_t) pCoeffs[0] * px[0]) +
+               (q31_t) ((uint32_t) ((q31_t) pCoeffs[2] * px[-1]) +
+                        (uint32_t) ((q31_t) pCoeffs[3] * px[-2]));
+
+    if (n & 1u)
+      ffOdd[n / 2u] = ff;
+    else
+      ffEven[n / 2u] = ff;
+  }
+}
+
+HOST_TARGET void KERNEL(arm_host_biquad_cascade_df1_q15)(
+  const arm_biquad_casd_df1_inst_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  q15_t x[BIQUAD_CHUNK + 2u];
+  q63_t ffEven[BIQUAD_CHUNK / 2u], ffOdd[BIQUAD_CHUNK / 2u];
+  q15_t *pIn = pSrc;
+  q15_t *pState = S->pState;
+  q15_t *pCoeffs = S->pCoeffs;
+  int32_t lShift = (15 - (int32_t) S->postShift);
+  uint32_t stage = (uint32_t) S->numStages;
+
+  do
+  {
+    q31_t a1 = pCoeffs[4], a2 = pCoeffs[5];
+    q31_t y1 = pState[2], y2 = pState[3];
+    uint32_t done, count, n;
+
+    x[0] = pState[1];
+    x[1] = pState[0];
+    for (done = 0u; done < blockSize; done += count)
+    {
+      count = blockSize - done;
+      if (count > BIQUAD_CHUNK)
+        count = BIQUAD_CHUNK;
+
+      /* the input of the chunk is copied, so pDst may be pSrc */
+      memcpy(x + 2, pIn + done, count * sizeof(q15_t));
+      biquadForward(x + 2, count, pCoeffs, ffEven, ffOdd);
+
+      for (n = 0u; n < count; n++)
+      {
+        q63_t ff = (n & 1u) ? ffOdd[n / 2u] : ffEven[n / 2u];
+        q63_t acc = ff + (q31_t) ((uint32_t) (a1 * y1) + (uint32_t) (a2 * y2));
+
+        y2 = y1;
+        y1 = __SSAT((q31_t) (acc >> lShift), 16);
+        pDst[done + n] = (q15_t) y1;
+      }
+      x[0] = x[count];
+      x[1] = x[count + 1u];
+    }
+
+    pState[0] = x[1];
+    pState[1] = x[0];
+    pState[2] = (q15_t) y1;
+    pState[3] = (q15_t) y2;
+    pState += 4u;
+    pCoeffs += 6u;
+    pIn = pDst;
+  } while (--stage);
+}
+
+
+/* ----------------------------------------------------------------------
+ * arm_biquad_cascade_df1_bank_q15
+ * -------------------------------------------------------------------- */
+
+/* The filters of a vector at once, every sample through all the stages.
+   A word of x and y is a sample, the word of the state {x[n-1], x[n-2]}.
+   acc >> lShift of the portable C is taken in 32 bit from the three words
+   t0 = b0*x[n], t1 = SMUAD(b1 b2, x state), t2 = SMUAD(a1 a2, y state):
+   the sum of every t >> lShift and of the low lShift bits, which wraps to
+   the (q31_t) of the C. fresh is the first lane whose state is stored, the
+   lanes before belong to the group before. */
+HOST_TARGET static void biquadBankGroup(
+  const arm_biquad_casd_df1_bank_inst_q15 * S,
+  uint32_t f,
+  uint32_t fresh,
+  const q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  v_t xs[255], ys[255];                  /* numStages is an uint8_t */
+  q15_t words[2u * V_WORDS];
+  uint32_t numFilters = S->numFilters;
+  uint32_t numStages = S->numStages;
+  int32_t lShift = (15 - (int32_t) S->postShift);
+  const v_t mask = vSet1((1 << lShift) - 1);
+  const v_t low = vSet1(0xFFFF);
+  const v_t yMax = vSet1(0x7FFF);
+  const v_t yMin = vSet1(-0x8000);
+  uint32_t n, s;
+
+  for (s = 0u; s < numStages; s++)
+  {
+    xs[s] = vLoad(S->pState + s * 4u * numFilters + 2u * f);
+    ys[s] = vLoad(S->pState + s * 4u * numFilters + 2u * (numFilters + f));
+  }
+
+  for (n = 0u; n < blockSize; n++)
+  {
+    const q15_t *pc = S->pCoeffs + 2u * f;
+    v_t x = vSet1((uint16_t) pSrc[n]);
+    v_t y = x;
+
+    for (s = 0u; s < numStages; s++)
+    {
+      v_t t0 = vMadd(vLoad(pc), x);
+      v_t t1 = vMadd(vLoad(pc + 2u * numFilters), xs[s]);
+      v_t t2 = vMadd(vLoad(pc + 4u * numFilters), ys[s]);
+      v_t r = vAdd32(vAdd32(vAnd(t0, mask), vAnd(t1, mask)), vAnd(t2, mask));
+
+      y = vAdd32(vAdd32(vSrai32(t0, lShift), vSrai32(t1, lShift)),
+                 vAdd32(vSrai32(t2, lShift), vSrai32(r, lShift)));
+      y = vMax32(vMin32(y, yMax), yMin);
+      xs[s] = vOr(vSlli32(xs[s], 16), x);
+      x = vAnd(y, low);
+      ys[s] = vOr(vSlli32(ys[s], 16), x);
+      pc += 6u * numFilters;
+    }
+    vStoreSat16(pDst + n * numFilters + f, y);
+  }
+
+  for (s = 0u; s < numStages; s++)
+  {
+    vStore(words, xs[s]);
+    memcpy(S->pState + s * 4u * numFilters + 2u * (f + fresh), words + 2u * fresh,
+           2u * (V_WORDS - fresh) * sizeof(q15_t));
+    vStore(words, ys[s]);
+    memcpy(S->pState + s * 4u * numFilters + 2u * (numFilters + f + fresh), words + 2u * fresh,
+           2u * (V_WORDS - fresh) * sizeof(q15_t));
+  }
+}
+
+HOST_TARGET void KERNEL(arm_host_biquad_cascade_df1_bank_q15)(
+  const arm_biquad_casd_df1_bank_inst_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t numFilters = S->numFilters;
+  uint32_t tail = numFilters % V_WORDS;
+  uint32_t f;
+
+  if (numFilters < V_WORDS)
+  {
+    if (V_WORDS > 4u && numFilters >= 4u)
+      arm_host_biquad_cascade_df1_bank_q15_sse41(S, pSrc, pDst, blockSize);
+    else
+      arm_biquad_cascade_df1_bank_q15_portable(S, pSrc, pDst, blockSize);
+    return;
+  }
+
+  /* the last group overlaps the one before and runs first, on the state
+     of the overlapped filters before their group updates it; their
+     outputs are written again by their group */
+  if (tail != 0u)
+    biquadBankGroup(S, numFilters - V_WORDS, V_WORDS - tail, pSrc, pDst, blockSize);
+
+  for (f = 0u; f + V_WORDS <= numFilters; f += V_WORDS)
+  {
+    biquadBankGroup(S, f, 0u, pSrc, pDst, blockSize);
+  }
+}
+
+
+/* ----------------------------------------------------------------------
+ * arm_dot_prod_q31
+ * -------------------------------------------------------------------- */
+
+/* p >> 14 of the portable C is the logical shift less 2^50 for p < 0, the
+   negative products are counted by their sign bits */
+HOST_TARGET void KERNEL(arm_host_dot_prod_q31)(
+  q31_t * pSrcA,
+  q31_t * pSrcB,
+  uint32_t blockSize,
+  q63_t * result)
+{
+  v_t acc = vSet1(0), neg = vSet1(0);
+  q63_t sum;
+  uint32_t k = 0u;
+
+  for (; k + V_WORDS <= blockSize; k += V_WORDS)
+  {
+    v_t a = vLoad(pSrcA + k);
+    v_t b = vLoad(pSrcB + k);
+    v_t pe = vMul32(a, b);
+    v_t po = vMul32(vSrli64(a, 32), vSrli64(b, 32));
+
+    acc = vAdd64(acc, vAdd64(vSrli64(pe, 14), vSrli64(po, 14)));
+    neg = vAdd64(neg, vAdd64(vSrli64(pe, 63), vSrli64(po, 63)));
+  }
+  /* the sum wraps like the portable C */
+  sum = (q63_t) ((uint64_t) vSum64(acc) - ((uint64_t) vSum64(neg) << 50));
+  for (; k < blockSize; k++)
+  {
+    sum += ((q63_t) pSrcA[k] * pSrcB[k]) >> 14u;
+  }
+  *result = sum;
+}
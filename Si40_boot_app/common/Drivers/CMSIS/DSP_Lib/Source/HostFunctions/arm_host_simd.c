@@ -0,0 +1,180 @@
+/* ----------------------------------------------------------------------
+* $Date:        19. October 2026
+*
+* Project:      CMSIS DSP Library, host build
+* Title:        arm_host_simd.c
+*
+* Description:  Kernel level of the CPU and the functions of arm_math.h
+*               that run the SSE4.1/AVX2 kernels or the portable C
+*
+* Target Processor: x86-64 host, see arm_math_host.h
+* -------------------------------------------------------------------- */
+
+#include "arm_host_simd.h"
+#include <stdlib.h>
+#include <string.h>
+
+static int hostLevel = -1;                       /* not detected yet */
+static const char *const hostName[] = {"none", "sse4.1", "avx2"};
+
+arm_host_simd_t arm_host_simd_detect(void)
+{
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx2"))
+    return ARM_HOST_SIMD_AVX2;
+  if (__builtin_cpu_supports("sse4.1"))
+    return ARM_HOST_SIMD_SSE41;
+  return ARM_HOST_SIMD_NONE;
+}
+
+arm_host_simd_t arm_host_simd_get(void)
+{
+  if (hostLevel < 0)
+  {
+    const char *env = getenv("ARM_MATH_HOST_SIMD");
+    arm_host_simd_t level = ARM_HOST_SIMD_AVX2;
+    int i;
+
+    for (i = 0; (env != NULL) && (i <= (int) ARM_HOST_SIMD_AVX2); i++)
+    {
+      if (strcmp(env, hostName[i]) == 0)
+        level = (arm_host_simd_t) i;
+    }
+    return arm_host_simd_set(level);
+  }
+  return (arm_host_simd_t) hostLevel;
+}
+
+arm_host_simd_t arm_host_simd_set(arm_host_simd_t level)
+{
+  arm_host_simd_t cpu = arm_host_simd_detect();
+
+  hostLevel = (int) ((level > cpu) ? cpu : level);
+  return (arm_host_simd_t) hostLevel;
+}
+
+const char *arm_host_simd_name(arm_host_simd_t level)
+{
+  return ((unsigned) level <= ARM_HOST_SIMD_AVX2) ? hostName[level] : "?";
+}
+
+
+void arm_fir_q15(
+  const arm_fir_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  switch (arm_host_simd_get())
+  {
+  case ARM_HOST_SIMD_AVX2:
+    arm_host_fir_q15_avx2(S, pSrc, pDst, blockSize);
+    break;
+  case ARM_HOST_SIMD_SSE41:
+    arm_host_fir_q15_sse41(S, pSrc, pDst, blockSize);
+    break;
+  default:
+    arm_fir_q15_portable(S, pSrc, pDst, blockSize);
+    break;
+  }
+}
+
+void arm_fir_bank_q15(
+  const arm_fir_bank_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  switch (arm_host_simd_get())
+  {
+  case ARM_HOST_SIMD_AVX2:
+    arm_host_fir_bank_q15_avx2(S, pSrc, pDst, blockSize);
+    break;
+  case ARM_HOST_SIMD_SSE41:
+    arm_host_fir_bank_q15_sse41(S, pSrc, pDst, blockSize);
+    break;
+  default:
+    arm_fir_bank_q15_portable(S, pSrc, pDst, blockSize);
+    break;
+  }
+}
+
+void arm_cfft_q15(
+  const arm_cfft_instance_q15 * S,
+  q15_t * p1,
+  uint8_t ifftFlag,
+  uint8_t bitReverseFlag)
+{
+  switch (arm_host_simd_get())
+  {
+  case ARM_HOST_SIMD_AVX2:
+    arm_host_cfft_q15_avx2(S, p1, ifftFlag, bitReverseFlag);
+    break;
+  case ARM_HOST_SIMD_SSE41:
+    arm_host_cfft_q15_sse41(S, p1, ifftFlag, bitReverseFlag);
+    break;
+  default:
+    arm_cfft_q15_portable(S, p1, ifftFlag, bitReverseFlag);
+    break;
+  }
+}
+
+void arm_biquad_cascade_df1_q15(
+  const arm_biquad_casd_df1_inst_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  switch (arm_host_simd_get())
+  {
+  case ARM_HOST_SIMD_AVX2:
+    arm_host_biquad_cascade_df1_q15_avx2(S, pSrc, pDst, blockSize);
+    break;
+  case ARM_HOST_SIMD_SSE41:
+    arm_host_biquad_cascade_df1_q15_sse41(S, pSrc, pDst, blockSize);
+    break;
+  default:
+    arm_biquad_cascade_df1_q15_portable(S, pSrc, pDst, blockSize);
+    break;
+  }
+}
+
+void arm_biquad_cascade_df1_bank_q15(
+  const arm_biquad_casd_df1_bank_inst_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  switch (arm_host_simd_get())
+  {
+  case ARM_HOST_SIMD_AVX2:
+    arm_host_biquad_cascade_df1_bank_q15_avx2(S, pSrc, pDst, blockSize);
+    break;
+  case ARM_HOST_SIMD_SSE41:
+    arm_host_biquad_cascade_df1_bank_q15_sse41(S, pSrc, pDst, blockSize);
+    break;
+  default:
+    arm_biquad_cascade_df1_bank_q15_portable(S, pSrc, pDst, blockSize);
+    break;
+  }
+}
+
+void arm_dot_prod_q31(
+  q31_t * pSrcA,
+  q31_t * pSrcB,
+  uint32_t blockSize,
+  q63_t * result)
+{
+  switch (arm_host_simd_get())
+  {
+  case ARM_HOST_SIMD_AVX2:
+    arm_host_dot_prod_q31_avx2(pSrcA, pSrcB, blockSize, result);
+    break;
+  case ARM_HOST_SIMD_SSE41:
+    arm_host_dot_prod_q31_sse41(pSrcA, pSrcB, blockSize, result);
+    break;
+  default:
+    arm_dot_prod_q31_portable(pSrcA, pSrcB, blockSize, result);
+    break;
+  }
+}
@@ -0,0 +1,52 @@
+/* ----------------------------------------------------------------------
+* $Date:        19. October 2026
+*
+* Project:      CMSIS DSP Library, host build
+* Title:        arm_host_simd.h
+*
+* Description:  Kernels of arm_host_sse41.c and arm_host_avx2.c, used by
+*               the dispatch of arm_host_simd.c
+*
+* Target Processor: x86-64 host, see arm_math_host.h
+* -------------------------------------------------------------------- */
+
+#ifndef __ARM_HOST_SIMD_H
+#define __ARM_HOST_SIMD_H
+
+#include "arm_math_host.h"
+
+/* C of arm_bitreversal2.S, TransformFunctions/arm_bitreversal2.c */
+extern void arm_bitreversal_16(
+  uint16_t * pSrc,
+  const uint16_t bitRevLen,
+  const uint16_t * pBitRevTable);
+
+/* one set of kernels for every instruction set, the suffix is the set */
+#define ARM_HOST_KERNELS(isa)                                                  \
+  void arm_host_fir_q15_##isa(const arm_fir_instance_q15 * S, q15_t * pSrc,    \
+                              q15_t * pDst, uint32_t blockSize);               \
+  void arm_host_fir_bank_q15_##isa(const arm_fir_bank_instance_q15 * S,      \
+                                   q15_t * pSrc, q15_t * pDst,                 \
+                                   uint32_t blockSize);                        \
+  void arm_host_cfft_q15_##isa(const arm_cfft_instance_q15 * S, q15_t * p1,    \
+                               uint8_t ifftFlag, uint8_t bitReverseFlag);      \
+  void arm_host_radix4_q15_##isa(q15_t * pSrc16, uint32_t fftLen,              \
+                                 const q15_t * pCoef16,                        \
+                                 uint32_t twidCoefModifier, int inverse);      \
+  void arm_host_radix4_middle_q15_##isa(q15_t * pSrc16, uint32_t fftLen,       \
+                                        uint32_t n2, const q15_t * pCoef16,    \
+                                        uint32_t twidCoefModifier,             \
+                                        int inverse);                          \
+  void arm_host_biquad_cascade_df1_q15_##isa(                                  \
+                              const arm_biquad_casd_df1_inst_q15 * S,          \
+                              q15_t * pSrc, q15_t * pDst, uint32_t blockSize); \
+  void arm_host_biquad_cascade_df1_bank_q15_##isa(                             \
+                              const arm_biquad_casd_df1_bank_inst_q15 * S,     \
+                              q15_t * pSrc, q15_t * pDst, uint32_t blockSize); \
+  void arm_host_dot_prod_q31_##isa(q31_t * pSrcA, q31_t * pSrcB,               \
+                                   uint32_t blockSize, q63_t * result);
+
+ARM_HOST_KERNELS(sse41)
+ARM_HOST_KERNELS(avx2)
+
+#endif /* __ARM_HOST_SIMD_H */
@@ -0,0 +1,66 @@
+/* ----------------------------------------------------------------------
+* $Date:        19. October 2026
+*
+* Project:      CMSIS DSP Library, host build
+* Title:        arm_host_sse41.c
+*
+* Description:  SSE4.1 kernels of the host functions, 128 bit vectors of
+*               arm_host_kernels.h
+*
+* Target Processor: x86-64 host, see arm_math_host.h
+* -------------------------------------------------------------------- */
+
+#include "arm_host_simd.h"
+#include <immintrin.h>
+
+#define HOST_ISA              sse41
+#define HOST_TARGET           __attribute__((target("sse4.1")))
+#define V_WORDS               4u
+
+typedef __m128i v_t;
+
+#define vLoad(p)              _mm_loadu_si128((const __m128i *) (const void *) (p))
+#define vStore(p, x)          _mm_storeu_si128((__m128i *) (void *) (p), (x))
+#define vAdds16(a, b)         _mm_adds_epi16((a), (b))
+#define vSubs16(a, b)         _mm_subs_epi16((a), (b))
+#define vAdd16(a, b)          _mm_add_epi16((a), (b))
+#define vSub16(a, b)          _mm_sub_epi16((a), (b))
+#define vSrai16(x, n)         _mm_srai_epi16((x), (n))
+#define vSlli16(x, n)         _mm_slli_epi16((x), (n))
+#define vAnd(a, b)            _mm_and_si128((a), (b))
+#define vXor(a, b)            _mm_xor_si128((a), (b))
+#define vAndnot(a, b)         _mm_andnot_si128((a), (b))
+#define vMadd(a, b)           _mm_madd_epi16((a), (b))
+#define vSub32(a, b)          _mm_sub_epi32((a), (b))
+#define vSrli32(x, n)         _mm_srli_epi32((x), (n))
+#define vSet1(x)              _mm_set1_epi32((int32_t) (x))
+#define vBlendOdd16(a, b)     _mm_blend_epi16((a), (b), 0xAA)
+#define vSwap16(x)            _mm_shufflehi_epi16(_mm_shufflelo_epi16((x), 0xB1), 0xB1)
+#define vUnpackLo32(a, b)     _mm_unpacklo_epi32((a), (b))
+#define vUnpackHi32(a, b)     _mm_unpackhi_epi32((a), (b))
+#define vUnpackLo64(a, b)     _mm_unpacklo_epi64((a), (b))
+#define vUnpackHi64(a, b)     _mm_unpackhi_epi64((a), (b))
+#define vCvtLo64(x)           _mm_cvtepi32_epi64(x)
+#define vCvtHi64(x)           _mm_cvtepi32_epi64(_mm_srli_si128((x), 8))
+#define vAdd64(a, b)          _mm_add_epi64((a), (b))
+#define vSrli64(x, n)         _mm_srli_epi64((x), (n))
+#define vMul32(a, b)          _mm_mul_epi32((a), (b))
+#define vAdd32(a, b)          _mm_add_epi32((a), (b))
+#define vSrai32(x, n)         _mm_sra_epi32((x), _mm_cvtsi32_si128((int) (n)))
+#define vSlli32(x, n)         _mm_slli_epi32((x), (n))
+#define vOr(a, b)             _mm_or_si128((a), (b))
+#define vMin32(a, b)          _mm_min_epi32((a), (b))
+#define vMax32(a, b)          _mm_max_epi32((a), (b))
+#define vStoreSat16(p, x)     _mm_storel_epi64((__m128i *) (void *) (p), _mm_packs_epi32((x), (x)))
+
+HOST_TARGET static inline q63_t vSum64(v_t x)
+{
+  return (q63_t) _mm_cvtsi128_si64(x) + (q63_t) _mm_extract_epi64(x, 1);
+}
+
+HOST_TARGET static inline v_t vGather(const int32_t * w, uint32_t i, uint32_t s)
+{
+  return _mm_set_epi32(w[i + 3u * s], w[i + 2u * s], w[i + s], w[i]);
+}
+
+#include "arm_host_kernels.h"
@@ -0,0 +1,106 @@
+/* ----------------------------------------------------------------------
+* $Date:        19. October 2026
+*
+* Project:      CMSIS DSP Library
+* Title:        arm_arena.c
+*
+* Description:  Static arena of the buffers of the instances.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_arena.h"
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @defgroup Arena Buffer Arena
+ *
+ * The state, coefficient and scratch buffers of the instances are taken one after the
+ * other from one static region, in ARM_ARENA_ALIGN steps. Buffers are not freed one by
+ * one: arm_arena_release() gives back everything taken after a mark, so a pipeline
+ * keeps its instances from the init on and scratch of a setup step can be dropped.
+ *
+ * \par
+ * The lengths of the buffers per kernel and the build time size of a buffer list are
+ * the macros of arm_arena.h. peak is the highest use since the init, for the budget of
+ * lists whose lengths are known only at run time.
+ */
+
+/**
+ * @addtogroup Arena
+ * @{
+ */
+
+/**
+ * @brief  Initialization function of the arena.
+ * @param[out] *S     points to an instance of the arena.
+ * @param[in]  *pMem  points to the region, ARM_ARENA_ALIGN aligned.
+ * @param[in]  size   bytes of the region.
+ * @return none.
+ */
+
+void arm_arena_init(
+  arm_arena_instance * S,
+  void *pMem,
+  uint32_t size)
+{
+  S->pBase = (uint8_t *) pMem;
+  S->size = size;
+  S->used = 0u;
+  S->peak = 0u;
+}
+
+/**
+ * @brief  Takes a buffer from the arena.
+ * @param[in,out] *S     points to an instance of the arena.
+ * @param[in]     bytes  bytes of the buffer.
+ * @return pointer to the buffer, ARM_ARENA_ALIGN aligned, or NULL if the arena is full.
+ */
+
+void *arm_arena_alloc(
+  arm_arena_instance * S,
+  uint32_t bytes)
+{
+  uint8_t *pBuf;
+  uint32_t padded = (bytes + (ARM_ARENA_ALIGN - 1u)) & ~(ARM_ARENA_ALIGN - 1u);
+
+  /* the rounding wraps only for sizes above the address space */
+  if((padded < bytes) || (padded > (S->size - S->used)))
+  {
+    return NULL;
+  }
+
+  pBuf = S->pBase + S->used;
+  S->used += padded;
+
+  if(S->used > S->peak)
+  {
+    S->peak = S->used;
+  }
+
+  return pBuf;
+}
+
+/**
+ * @brief  Gives back all buffers taken after a mark of arm_arena_mark().
+ * @param[in,out] *S     points to an instance of the arena.
+ * @param[in]     mark   value of arm_arena_mark(), 0 for all buffers.
+ * @return none.
+ */
+
+void arm_arena_release(
+  arm_arena_instance * S,
+  uint32_t mark)
+{
+  if(mark < S->used)
+  {
+    S->used = mark;
+  }
+}
+
+/**
+ * @} end of Arena group
+ */
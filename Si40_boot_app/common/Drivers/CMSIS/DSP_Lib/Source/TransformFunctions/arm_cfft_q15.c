@@ -86,7 +86,7 @@ void arm_cfft_radix4by2_inverse_q15(
 * @return none.  
 */
 
-void arm_cfft_q15( 
+void ARM_MATH_PORTABLE(arm_cfft_q15)( 
     const arm_cfft_instance_q15 * S, 
     q15_t * p1,
     uint8_t ifftFlag,
@@ -42,6 +42,16 @@
 #include "arm_math.h"
 #include "arm_common_tables.h"
 
+/* twiddle table of the FFT length, or every (4096/N)-th entry of the table
+   of 4096 when all the tables are built */
+#if defined(ARM_ALL_FFT_TABLES)
+#define ARM_CFFT_TWIDDLE(N)   S->pTwiddle = (float32_t *) twiddleCoef; \
+                              S->twidCoefModifier = 4096u / (N)
+#else
+#define ARM_CFFT_TWIDDLE(N)   S->pTwiddle = (float32_t *) twiddleCoef_##N; \
+                              S->twidCoefModifier = 1u
+#endif
+
 /**    
  * @ingroup groupTransforms    
  */
@@ -86,9 +96,6 @@ arm_status arm_cfft_radix4_init_f32(
   /*  Initialise the FFT length */
   S->fftLen = fftLen;
 
-  /*  Initialise the Twiddle coefficient pointer */
-  S->pTwiddle = (float32_t *) twiddleCoef;
-
   /*  Initialise the Flag for selection of CFFT or CIFFT */
   S->ifftFlag = ifftFlag;
 
@@ -99,11 +106,12 @@ arm_status arm_cfft_radix4_init_f32(
   switch (S->fftLen)
   {
 
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_FFT_RADIX4_F32_4096)
   case 4096u:
     /*  Initializations of structure parameters for 4096 point FFT */
 
     /*  Initialise the twiddle coef modifier value */
-    S->twidCoefModifier = 1u;
+    ARM_CFFT_TWIDDLE(4096);
     /*  Initialise the bit reversal table modifier */
     S->bitRevFactor = 1u;
     /*  Initialise the bit reversal table pointer */
@@ -111,12 +119,14 @@ arm_status arm_cfft_radix4_init_f32(
     /*  Initialise the 1/fftLen Value */
     S->onebyfftLen = 0.000244140625;
     break;
+#endif
 
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_FFT_RADIX4_F32_1024)
   case 1024u:
     /*  Initializations of structure parameters for 1024 point FFT */
 
     /*  Initialise the twiddle coef modifier value */
-    S->twidCoefModifier = 4u;
+    ARM_CFFT_TWIDDLE(1024);
     /*  Initialise the bit reversal table modifier */
     S->bitRevFactor = 4u;
     /*  Initialise the bit reversal table pointer */
@@ -124,31 +134,38 @@ arm_status arm_cfft_radix4_init_f32(
     /*  Initialise the 1/fftLen Value */
     S->onebyfftLen = 0.0009765625f;
     break;
+#endif
 
 
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_FFT_RADIX4_F32_256)
   case 256u:
     /*  Initializations of structure parameters for 256 point FFT */
-    S->twidCoefModifier = 16u;
+    ARM_CFFT_TWIDDLE(256);
     S->bitRevFactor = 16u;
     S->pBitRevTable = (uint16_t *) & armBitRevTable[15];
     S->onebyfftLen = 0.00390625f;
     break;
+#endif
 
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_FFT_RADIX4_F32_64)
   case 64u:
     /*  Initializations of structure parameters for 64 point FFT */
-    S->twidCoefModifier = 64u;
+    ARM_CFFT_TWIDDLE(64);
     S->bitRevFactor = 64u;
     S->pBitRevTable = (uint16_t *) & armBitRevTable[63];
     S->onebyfftLen = 0.015625f;
     break;
+#endif
 
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_FFT_RADIX4_F32_16)
   case 16u:
     /*  Initializations of structure parameters for 16 point FFT */
-    S->twidCoefModifier = 256u;
+    ARM_CFFT_TWIDDLE(16);
     S->bitRevFactor = 256u;
     S->pBitRevTable = (uint16_t *) & armBitRevTable[255];
     S->onebyfftLen = 0.0625f;
     break;
+#endif
 
 
   default:
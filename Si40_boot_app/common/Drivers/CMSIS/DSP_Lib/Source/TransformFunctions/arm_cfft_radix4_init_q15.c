@@ -41,6 +41,16 @@
 #include "arm_math.h"
 #include "arm_common_tables.h"
 
+/* twiddle table of the FFT length, or every (4096/N)-th entry of the table
+   of 4096 when all the tables are built */
+#if defined(ARM_ALL_FFT_TABLES)
+#define ARM_CFFT_TWIDDLE(N)   S->pTwiddle = (q15_t *) twiddleCoef_4096_q15; \
+                              S->twidCoefModifier = 4096u / (N)
+#else
+#define ARM_CFFT_TWIDDLE(N)   S->pTwiddle = (q15_t *) twiddleCoef_##N##_q15; \
+                              S->twidCoefModifier = 1u
+#endif
+
 /**    
  * @ingroup groupTransforms    
  */
@@ -84,8 +94,6 @@ arm_status arm_cfft_radix4_init_q15(
   arm_status status = ARM_MATH_SUCCESS;
   /*  Initialise the FFT length */
   S->fftLen = fftLen;
-  /*  Initialise the Twiddle coefficient pointer */
-  S->pTwiddle = (q15_t *) twiddleCoef_4096_q15;
   /*  Initialise the Flag for selection of CFFT or CIFFT */
   S->ifftFlag = ifftFlag;
   /*  Initialise the Flag for calculation Bit reversal or not */
@@ -94,49 +102,59 @@ arm_status arm_cfft_radix4_init_q15(
   /*  Initializations of structure parameters depending on the FFT length */
   switch (S->fftLen)
   {
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_FFT_RADIX4_Q15_4096)
   case 4096u:
     /*  Initializations of structure parameters for 4096 point FFT */
 
     /*  Initialise the twiddle coef modifier value */
-    S->twidCoefModifier = 1u;
+    ARM_CFFT_TWIDDLE(4096);
     /*  Initialise the bit reversal table modifier */
     S->bitRevFactor = 1u;
     /*  Initialise the bit reversal table pointer */
     S->pBitRevTable = (uint16_t *) armBitRevTable;
 
     break;
+#endif
 
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_FFT_RADIX4_Q15_1024)
   case 1024u:
     /*  Initializations of structure parameters for 1024 point FFT */
-    S->twidCoefModifier = 4u;
+    ARM_CFFT_TWIDDLE(1024);
     S->bitRevFactor = 4u;
     S->pBitRevTable = (uint16_t *) & armBitRevTable[3];
 
     break;
+#endif
 
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_FFT_RADIX4_Q15_256)
   case 256u:
     /*  Initializations of structure parameters for 256 point FFT */
-    S->twidCoefModifier = 16u;
+    ARM_CFFT_TWIDDLE(256);
     S->bitRevFactor = 16u;
     S->pBitRevTable = (uint16_t *) & armBitRevTable[15];
 
     break;
+#endif
 
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_FFT_RADIX4_Q15_64)
   case 64u:
     /*  Initializations of structure parameters for 64 point FFT */
-    S->twidCoefModifier = 64u;
+    ARM_CFFT_TWIDDLE(64);
     S->bitRevFactor = 64u;
     S->pBitRevTable = (uint16_t *) & armBitRevTable[63];
 
     break;
+#endif
 
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_FFT_RADIX4_Q15_16)
   case 16u:
     /*  Initializations of structure parameters for 16 point FFT */
-    S->twidCoefModifier = 256u;
+    ARM_CFFT_TWIDDLE(16);
     S->bitRevFactor = 256u;
     S->pBitRevTable = (uint16_t *) & armBitRevTable[255];
 
     break;
+#endif
 
   default:
     /*  Reporting argument error if fftSize is not valid value */
@@ -40,6 +40,7 @@
 
 
 #include "arm_math.h"
+#include "arm_common_tables.h"
 
 /**    
  * @ingroup groupTransforms    
@@ -72,6 +73,7 @@
 * array length is <code>2*N</code>.    
 */
 
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_FFT_DCT4_F32_128)
 static const float32_t Weights_128[256] = {
   1.000000000000000000f, 0.000000000000000000f, 0.999924701839144500f,
   -0.012271538285719925f,
@@ -202,7 +204,9 @@ static const float32_t Weights_128[256] = {
   0.024541228522912264f, -0.999698818696204250f, 0.012271538285719944f,
   -0.999924701839144500f
 };
+#endif
 
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_FFT_DCT4_F32_512)
 static const float32_t Weights_512[1024] = {
   1.000000000000000000f, 0.000000000000000000f, 0.999995293809576190f,
   -0.003067956762965976f,
@@ -717,7 +721,9 @@ static const float32_t Weights_512[1024] = {
   0.006135884649154515f, -0.999981175282601110f, 0.003067956762966138f,
   -0.999995293809576190f
 };
+#endif
 
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_FFT_DCT4_F32_2048)
 static const float32_t Weights_2048[4096] = {
   1.000000000000000000f, 0.000000000000000000f, 0.999999705862882230f,
   -0.000766990318742704f,
@@ -2768,7 +2774,9 @@ static const float32_t Weights_2048[4096] = {
   0.001533980186284766f, -0.999998823451701880f, 0.000766990318742846f,
   -0.999999705862882230f
 };
+#endif
 
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_FFT_DCT4_F32_8192)
 static const float32_t Weights_8192[16384] = {
   1.000000000000000000, -0.000000000000000000, 0.999999981616429330,
     -0.000191747597310703,
@@ -10964,6 +10972,7 @@ static const float32_t Weights_8192[16384] = {
     -0.999999981616429330,
 
 };
+#endif
 
 /**    
 * \par    
@@ -10978,6 +10987,7 @@ static const float32_t Weights_8192[16384] = {
 * \par    
 * where <code>N</code> is the number of factors to generate and <code>c</code> is <code>pi/(2*N)</code>    
 */
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_FFT_DCT4_F32_128)
 static const float32_t cos_factors_128[128] = {
   0.999981175282601110f, 0.999830581795823400f, 0.999529417501093140f,
   0.999077727752645360f,
@@ -11044,7 +11054,9 @@ static const float32_t cos_factors_128[128] = {
   0.042938256934940959f, 0.030674803176636581f, 0.018406729905804820f,
   0.006135884649154515f
 };
+#endif
 
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_FFT_DCT4_F32_512)
 static const float32_t cos_factors_512[512] = {
   0.999998823451701880f, 0.999989411081928400f, 0.999970586430974140f,
   0.999942349676023910f,
@@ -11303,7 +11315,9 @@ static const float32_t cos_factors_512[512] = {
   0.010737659167264572f, 0.007669828739531077f, 0.004601926120448672f,
   0.001533980186284766f
 };
+#endif
 
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_FFT_DCT4_F32_2048)
 static const float32_t cos_factors_2048[2048] = {
   0.999999926465717890f, 0.999999338191525530f, 0.999998161643486980f,
   0.999996396822294350f,
@@ -12330,7 +12344,9 @@ static const float32_t cos_factors_2048[2048] = {
   0.002684463154596083f, 0.001917474809855460f, 0.001150485337113809f,
   0.000383495187571497f
 };
+#endif
 
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_FFT_DCT4_F32_8192)
 static const float32_t cos_factors_8192[8192] = {
   1.999999990808214700, 1.999999917273932200, 1.999999770205369800,
     1.999999549602533100,
@@ -16430,6 +16446,7 @@ static const float32_t cos_factors_8192[8192] = {
     0.000191747598192208,
 
 };
+#endif
 
 /**    
  * @brief  Initialization function for the floating-point DCT4/IDCT4.   
@@ -16457,18 +16474,6 @@ arm_status arm_dct4_init_f32(
   /*  Initialize the default arm status */
   arm_status status = ARM_MATH_SUCCESS;
 
-  /* Initializing the pointer array with the weight table base addresses of different lengths */
-  float32_t *twiddlePtr[4] =
-    { (float32_t *) Weights_128, (float32_t *) Weights_512,
-    (float32_t *) Weights_2048, (float32_t *) Weights_8192
-  };
-
-  /* Initializing the pointer array with the cos factor table base addresses of different lengths */
-  float32_t *pCosFactor[4] =
-    { (float32_t *) cos_factors_128, (float32_t *) cos_factors_512,
-    (float32_t *) cos_factors_2048, (float32_t *) cos_factors_8192
-  };
-
   /* Initialize the DCT4 length */
   S->N = N;
 
@@ -16487,22 +16492,30 @@ arm_status arm_dct4_init_f32(
   switch (N)
   {
     /* Initialize the table modifier values */
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_FFT_DCT4_F32_8192)
   case 8192u:
-    S->pTwiddle = twiddlePtr[3];
-    S->pCosFactor = pCosFactor[3];
+    S->pTwiddle = (float32_t *) Weights_8192;
+    S->pCosFactor = (float32_t *) cos_factors_8192;
     break;
+#endif
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_FFT_DCT4_F32_2048)
   case 2048u:
-    S->pTwiddle = twiddlePtr[2];
-    S->pCosFactor = pCosFactor[2];
+    S->pTwiddle = (float32_t *) Weights_2048;
+    S->pCosFactor = (float32_t *) cos_factors_2048;
     break;
+#endif
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_FFT_DCT4_F32_512)
   case 512u:
-    S->pTwiddle = twiddlePtr[1];
-    S->pCosFactor = pCosFactor[1];
+    S->pTwiddle = (float32_t *) Weights_512;
+    S->pCosFactor = (float32_t *) cos_factors_512;
     break;
+#endif
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_FFT_DCT4_F32_128)
   case 128u:
-    S->pTwiddle = twiddlePtr[0];
-    S->pCosFactor = pCosFactor[0];
+    S->pTwiddle = (float32_t *) Weights_128;
+    S->pCosFactor = (float32_t *) cos_factors_128;
     break;
+#endif
   default:
     status = ARM_MATH_ARGUMENT_ERROR;
   }
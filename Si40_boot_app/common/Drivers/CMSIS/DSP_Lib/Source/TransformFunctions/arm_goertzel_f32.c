@@ -0,0 +1,111 @@
+/* ----------------------------------------------------------------------
+* $Date:        19. October 2026
+*
+* Project:      CMSIS DSP Library
+* Title:        arm_goertzel_f32.c
+*
+* Description:  Floating-point Goertzel detector, one bin.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @defgroup Goertzel Goertzel Detector
+ *
+ * The Goertzel detector computes single bins of the DFT of a block of real samples,
+ * at any frequency, not only at the multiples of sampleRate/blockSize. A bin costs one
+ * multiply per sample, so a few dozen bins (the channels of a frequency plan) cost less
+ * than the real FFT of the block, which also needs a length the FFT supports.
+ *
+ * \par Algorithm
+ * Every bin at <code>w = 2 * pi * f / sampleRate</code> runs the resonator
+ * <pre>
+ *    s[n] = x[n] + 2 * cos(w) * s[n-1] - s[n-2]
+ * </pre>
+ * over the block of N samples and gives
+ * <pre>
+ *    y = s[N-1] - cos(w) * s[N-2] + j * sin(w) * s[N-2] = sum(x[n] * exp(-j * w * (n - N + 1)))
+ * </pre>
+ * the DFT of the block with the phase referred to its last sample. The output is
+ * <code>y / 2^ceil(log2(N))</code>, {re, im} per bin, for a power of two block a tone of
+ * amplitude A on the bin gives |y| = A / 2. The power of the bins is arm_cmplx_mag_squared_*()
+ * of the output.
+ *
+ * \par
+ * arm_goertzel_*() runs one bin of the instance, arm_goertzel_multi_*() all of them in
+ * one call: 4 bins per pass over the block, their states in registers, every sample is
+ * loaded once for the 4 bins.
+ *
+ * \par Instance Structure
+ * The instance holds the number of bins, the block size, the output scaling and points to
+ * the {2 * cos(w), sin(w)} pairs of the bins. There is no state between the calls, every
+ * call is a new block. The coefficient array may be shared by the instances of the same
+ * frequencies and sample rate.
+ *
+ * \par Initialization Functions
+ * arm_goertzel_init_*() takes the bin frequencies and the sample rate in Hz, the same
+ * integers as a frequency plan, and computes the coefficients by arm_sin_cos_q31(), so all
+ * three types look at the same frequencies. A frequency must be inside (0, sampleRate/2).
+ *
+ * \par Fixed-Point Behavior
+ * The coefficients are 2.30 (2 * cos) and 1.31 (sin) in both Q formats. The resonator of
+ * a bin grows up to <code>N / sin(w)</code> times the input. The Q15 version keeps the input
+ * unscaled in 32 bits, N / sin(w) must be below 32768 and the init function checks it.
+ * The Q31 version shifts the input right by <code>inputShift</code>, chosen by the init
+ * function for the block and the bins, so the precision of the input is 30 - inputShift
+ * bits. Both write 1.31 and saturate.
+ */
+
+/**
+ * @addtogroup Goertzel
+ * @{
+ */
+
+/**
+ * @brief  Floating-point Goertzel detector, one bin.
+ * @param[in]  *S     points to an instance of the floating-point Goertzel structure.
+ * @param[in]  bin    index of the bin.
+ * @param[in]  *pSrc  points to the block of <code>blockSize</code> input samples.
+ * @param[out] *pDst  points to the complex bin value, 2 values.
+ * @return     none.
+ */
+
+void arm_goertzel_f32(
+  const arm_goertzel_instance_f32 * S,
+  uint16_t bin,
+  float32_t * pSrc,
+  float32_t * pDst)
+{
+  const float32_t *pCoeffs = &S->pCoeffs[2u * bin];
+  float32_t coeff = pCoeffs[0];                  /* 2 * cos(w) */
+  float32_t s0, s1 = 0.0f, s2 = 0.0f;            /* s[n], s[n-1], s[n-2] */
+  uint32_t blkCnt = S->blockSize;
+
+  /* two samples per loop, the states swap their roles */
+  while(blkCnt > 1u)
+  {
+    s2 = *pSrc++ + (coeff * s1) - s2;
+    s1 = *pSrc++ + (coeff * s2) - s1;
+    blkCnt -= 2u;
+  }
+
+  if(blkCnt > 0u)
+  {
+    s0 = *pSrc + (coeff * s1) - s2;
+    s2 = s1;
+    s1 = s0;
+  }
+
+  pDst[0] = (s1 - (0.5f * coeff * s2)) * S->scale;
+  pDst[1] = pCoeffs[1] * s2 * S->scale;
+}
+
+/**
+ * @} end of Goertzel group
+ */
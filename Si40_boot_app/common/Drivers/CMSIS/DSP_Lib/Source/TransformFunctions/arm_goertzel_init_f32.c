@@ -0,0 +1,78 @@
+/* ----------------------------------------------------------------------
+* $Date:        19. October 2026
+*
+* Project:      CMSIS DSP Library
+* Title:        arm_goertzel_init_f32.c
+*
+* Description:  Initialization function for the floating-point Goertzel detector.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup Goertzel
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the floating-point Goertzel detector.
+ * @param[in,out] *S          points to an instance of the floating-point Goertzel structure.
+ * @param[in]     numBins     number of frequency bins.
+ * @param[out]    *pCoeffs    points to the coefficient buffer of 2*numBins values.
+ * @param[in]     *pFreqs     points to the bin frequencies in Hz.
+ * @param[in]     sampleRate  sample rate in Hz.
+ * @param[in]     blockSize   number of samples processed per call.
+ * @return        ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR if a frequency is not inside (0, sampleRate/2).
+ *
+ * \par
+ * The coefficients come from arm_sin_cos_q31() as in the Q formats, so all three types
+ * look at the same frequencies.
+ */
+
+arm_status arm_goertzel_init_f32(
+  arm_goertzel_instance_f32 * S,
+  uint16_t numBins,
+  float32_t * pCoeffs,
+  const uint32_t * pFreqs,
+  uint32_t sampleRate,
+  uint32_t blockSize)
+{
+  q31_t sinVal, cosVal;
+  uint32_t i, size = 1u;
+
+  for (i = 0u; i < numBins; i++)
+  {
+    if((pFreqs[i] == 0u) || (2u * (uint64_t) pFreqs[i] >= sampleRate))
+    {
+      return ARM_MATH_ARGUMENT_ERROR;
+    }
+
+    /* angle of the bin in units of pi, 2 * f / fs */
+    arm_sin_cos_q31((q31_t) (((uint64_t) pFreqs[i] << 32) / sampleRate), &sinVal, &cosVal);
+
+    pCoeffs[2u * i] = (float32_t) cosVal / 1073741824.0f;
+    pCoeffs[(2u * i) + 1u] = (float32_t) sinVal / 2147483648.0f;
+  }
+
+  while(size < blockSize)
+  {
+    size <<= 1u;
+  }
+
+  S->numBins = numBins;
+  S->scale = 1.0f / (float32_t) size;
+  S->blockSize = blockSize;
+  S->pCoeffs = pCoeffs;
+
+  return ARM_MATH_SUCCESS;
+}
+
+/**
+ * @} end of Goertzel group
+ */
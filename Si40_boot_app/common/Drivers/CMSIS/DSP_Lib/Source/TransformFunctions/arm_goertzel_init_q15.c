@@ -0,0 +1,88 @@
+/* ----------------------------------------------------------------------
+* $Date:        19. October 2026
+*
+* Project:      CMSIS DSP Library
+* Title:        arm_goertzel_init_q15.c
+*
+* Description:  Initialization function for the Q15 Goertzel detector.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup Goertzel
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the Q15 Goertzel detector.
+ * @param[in,out] *S          points to an instance of the Q15 Goertzel structure.
+ * @param[in]     numBins     number of frequency bins.
+ * @param[out]    *pCoeffs    points to the coefficient buffer of 2*numBins values.
+ * @param[in]     *pFreqs     points to the bin frequencies in Hz.
+ * @param[in]     sampleRate  sample rate in Hz.
+ * @param[in]     blockSize   number of samples processed per call.
+ * @return        ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR if a frequency is not inside (0, sampleRate/2)
+ * or the recursion of a bin would overflow over <code>blockSize</code> samples.
+ *
+ * \par
+ * The recursion keeps the samples unscaled in 17.15, so <code>blockSize / sin(2 * pi * f / sampleRate)</code>
+ * must stay below 32768 for every bin: 32768 samples in the middle of the band, less near 0 and sampleRate/2.
+ * The coefficients are the same as in arm_goertzel_init_q31().
+ */
+
+arm_status arm_goertzel_init_q15(
+  arm_goertzel_instance_q15 * S,
+  uint16_t numBins,
+  q31_t * pCoeffs,
+  const uint32_t * pFreqs,
+  uint32_t sampleRate,
+  uint32_t blockSize)
+{
+  q31_t sinVal, cosVal;
+  uint32_t i;
+  uint8_t shift = 0u;
+
+  for (i = 0u; i < numBins; i++)
+  {
+    if((pFreqs[i] == 0u) || (2u * (uint64_t) pFreqs[i] >= sampleRate))
+    {
+      return ARM_MATH_ARGUMENT_ERROR;
+    }
+
+    /* angle of the bin in units of pi, 2 * f / fs */
+    arm_sin_cos_q31((q31_t) (((uint64_t) pFreqs[i] << 32) / sampleRate), &sinVal, &cosVal);
+
+    /* |s| <= blockSize * 2^15 / sin, below 2^30 */
+    if(((uint64_t) blockSize << 16) >= (uint64_t) sinVal)
+    {
+      return ARM_MATH_ARGUMENT_ERROR;
+    }
+
+    /* 2 * cos in 2.30 has the bits of cos in 1.31 */
+    pCoeffs[2u * i] = cosVal;
+    pCoeffs[(2u * i) + 1u] = sinVal;
+  }
+
+  while(((uint32_t) 1u << shift) < blockSize)
+  {
+    shift++;
+  }
+
+  S->numBins = numBins;
+  S->shift = shift;
+  S->blockSize = blockSize;
+  S->pCoeffs = pCoeffs;
+
+  return ARM_MATH_SUCCESS;
+}
+
+/**
+ * @} end of Goertzel group
+ */
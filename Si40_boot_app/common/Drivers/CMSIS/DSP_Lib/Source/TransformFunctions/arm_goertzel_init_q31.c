@@ -0,0 +1,95 @@
+/* ----------------------------------------------------------------------
+* $Date:        19. October 2026
+*
+* Project:      CMSIS DSP Library
+* Title:        arm_goertzel_init_q31.c
+*
+* Description:  Initialization function for the Q31 Goertzel detector.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup Goertzel
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the Q31 Goertzel detector.
+ * @param[in,out] *S          points to an instance of the Q31 Goertzel structure.
+ * @param[in]     numBins     number of frequency bins.
+ * @param[out]    *pCoeffs    points to the coefficient buffer of 2*numBins values.
+ * @param[in]     *pFreqs     points to the bin frequencies in Hz.
+ * @param[in]     sampleRate  sample rate in Hz.
+ * @param[in]     blockSize   number of samples processed per call.
+ * @return        ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR if a frequency is not inside (0, sampleRate/2).
+ *
+ * \par
+ * The input samples are shifted right by <code>inputShift</code> bits, the smallest shift
+ * that keeps the recursion of every bin inside 2.30 for <code>blockSize</code> full scale samples.
+ * It grows with the block and with the bins near 0 and sampleRate/2.
+ */
+
+arm_status arm_goertzel_init_q31(
+  arm_goertzel_instance_q31 * S,
+  uint16_t numBins,
+  q31_t * pCoeffs,
+  const uint32_t * pFreqs,
+  uint32_t sampleRate,
+  uint32_t blockSize)
+{
+  q31_t sinVal, cosVal, sinMin = 0x7FFFFFFF;
+  uint32_t i;
+  uint8_t shift = 0u, inputShift = 0u;
+
+  for (i = 0u; i < numBins; i++)
+  {
+    if((pFreqs[i] == 0u) || (2u * (uint64_t) pFreqs[i] >= sampleRate))
+    {
+      return ARM_MATH_ARGUMENT_ERROR;
+    }
+
+    /* angle of the bin in units of pi, 2 * f / fs */
+    arm_sin_cos_q31((q31_t) (((uint64_t) pFreqs[i] << 32) / sampleRate), &sinVal, &cosVal);
+
+    /* 2 * cos in 2.30 has the bits of cos in 1.31 */
+    pCoeffs[2u * i] = cosVal;
+    pCoeffs[(2u * i) + 1u] = sinVal;
+    if(sinVal < sinMin)
+    {
+      sinMin = sinVal;
+    }
+  }
+
+  while(((uint32_t) 1u << shift) < blockSize)
+  {
+    shift++;
+  }
+
+  /* |s| <= blockSize * |x| / sin, below 2^30 */
+  while(((uint64_t) blockSize << 32) >= ((uint64_t) sinMin << inputShift))
+  {
+    if(++inputShift > 31u)
+    {
+      return ARM_MATH_ARGUMENT_ERROR;
+    }
+  }
+
+  S->numBins = numBins;
+  S->shift = shift;
+  S->inputShift = inputShift;
+  S->blockSize = blockSize;
+  S->pCoeffs = pCoeffs;
+
+  return ARM_MATH_SUCCESS;
+}
+
+/**
+ * @} end of Goertzel group
+ */
@@ -0,0 +1,125 @@
+/* ----------------------------------------------------------------------
+* $Date:        19. October 2026
+*
+* Project:      CMSIS DSP Library
+* Title:        arm_goertzel_multi_f32.c
+*
+* Description:  Floating-point Goertzel detector, all bins of the instance.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup Goertzel
+ * @{
+ */
+
+/* {re, im} of a bin from s[N-1], s[N-2], as arm_goertzel_f32() */
+static void arm_goertzel_out_f32(
+  const arm_goertzel_instance_f32 * S,
+  const float32_t * pCoeffs,
+  float32_t s1,
+  float32_t s2,
+  float32_t * pDst)
+{
+  pDst[0] = (s1 - (0.5f * pCoeffs[0] * s2)) * S->scale;
+  pDst[1] = pCoeffs[1] * s2 * S->scale;
+}
+
+/**
+ * @brief  Floating-point Goertzel detector, all bins of the instance.
+ * @param[in]  *S     points to an instance of the Floating-point Goertzel structure.
+ * @param[in]  *pSrc  points to the block of <code>blockSize</code> input samples.
+ * @param[out] *pDst  points to the complex bin values, 2*numBins values.
+ * @return     none.
+ *
+ * \par
+ * Same arithmetic as arm_goertzel_f32() bin by bin, so the outputs are identical.
+ * Four bins run per pass over the block, the remaining bins one by one.
+ */
+
+void arm_goertzel_multi_f32(
+  const arm_goertzel_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst)
+{
+  const float32_t *pCoeffs = S->pCoeffs;
+  float32_t *pIn;
+  float32_t c0, c1, c2, c3;                         /* 2 * cos(w) of the 4 bins */
+  float32_t a1, a2, b1, b2, d1, d2, e1, e2;         /* s[n-1], s[n-2] of the 4 bins */
+  float32_t x;
+  uint32_t binCnt = (uint32_t) S->numBins >> 2u;
+  uint32_t blkCnt, i;
+  uint16_t bin;
+
+  while(binCnt > 0u)
+  {
+    c0 = pCoeffs[0];
+    c1 = pCoeffs[2];
+    c2 = pCoeffs[4];
+    c3 = pCoeffs[6];
+    a1 = a2 = b1 = b2 = d1 = d2 = e1 = e2 = 0.0f;
+
+    pIn = pSrc;
+    blkCnt = S->blockSize;
+
+    /* two samples per loop, the states swap their roles */
+    while(blkCnt > 1u)
+    {
+      x = *pIn++;
+      a2 = x + (c0 * a1) - a2;
+      b2 = x + (c1 * b1) - b2;
+      d2 = x + (c2 * d1) - d2;
+      e2 = x + (c3 * e1) - e2;
+      x = *pIn++;
+      a1 = x + (c0 * a2) - a1;
+      b1 = x + (c1 * b2) - b1;
+      d1 = x + (c2 * d2) - d1;
+      e1 = x + (c3 * e2) - e1;
+      blkCnt -= 2u;
+    }
+
+    if(blkCnt > 0u)
+    {
+      x = *pIn++;
+      a2 = x + (c0 * a1) - a2;
+      b2 = x + (c1 * b1) - b2;
+      d2 = x + (c2 * d1) - d2;
+      e2 = x + (c3 * e1) - e2;
+
+      /* back to s[n-1] in a1 */
+      x = a1; a1 = a2; a2 = x;
+      x = b1; b1 = b2; b2 = x;
+      x = d1; d1 = d2; d2 = x;
+      x = e1; e1 = e2; e2 = x;
+    }
+
+    arm_goertzel_out_f32(S, &pCoeffs[0], a1, a2, &pDst[0]);
+    arm_goertzel_out_f32(S, &pCoeffs[2], b1, b2, &pDst[2]);
+    arm_goertzel_out_f32(S, &pCoeffs[4], d1, d2, &pDst[4]);
+    arm_goertzel_out_f32(S, &pCoeffs[6], e1, e2, &pDst[6]);
+
+    pCoeffs += 8u;
+    pDst += 8u;
+    binCnt--;
+  }
+
+  /* the remaining bins */
+  bin = (uint16_t) (S->numBins & ~3u);
+  for (i = 0u; i < ((uint32_t) S->numBins & 3u); i++)
+  {
+    arm_goertzel_f32(S, bin, pSrc, pDst);
+    bin++;
+    pDst += 2u;
+  }
+}
+
+/**
+ * @} end of Goertzel group
+ */
@@ -0,0 +1,130 @@
+/* ----------------------------------------------------------------------
+* $Date:        19. October 2026
+*
+* Project:      CMSIS DSP Library
+* Title:        arm_goertzel_multi_q31.c
+*
+* Description:  Q31 Goertzel detector, all bins of the instance.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup Goertzel
+ * @{
+ */
+
+/* {re, im} of a bin from s[N-1], s[N-2], as arm_goertzel_q31() */
+static void arm_goertzel_out_q31(
+  const arm_goertzel_instance_q31 * S,
+  const q31_t * pCoeffs,
+  q31_t s1,
+  q31_t s2,
+  q31_t * pDst)
+{
+  uint32_t outShift = (uint32_t) S->inputShift - S->shift;
+  q63_t re = (q63_t) s1 - (((q63_t) pCoeffs[0] * s2) >> 31);
+  q63_t im = ((q63_t) pCoeffs[1] * s2) >> 31;
+
+  pDst[0] = clip_q63_to_q31(re << outShift);
+  pDst[1] = clip_q63_to_q31(im << outShift);
+}
+
+/**
+ * @brief  Q31 Goertzel detector, all bins of the instance.
+ * @param[in]  *S     points to an instance of the Q31 Goertzel structure.
+ * @param[in]  *pSrc  points to the block of <code>blockSize</code> input samples.
+ * @param[out] *pDst  points to the complex bin values, 2*numBins values in 1.31 format.
+ * @return     none.
+ *
+ * \par
+ * Same arithmetic as arm_goertzel_q31() bin by bin, so the outputs are identical.
+ * Four bins run per pass over the block, the remaining bins one by one.
+ */
+
+void arm_goertzel_multi_q31(
+  const arm_goertzel_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst)
+{
+  const q31_t *pCoeffs = S->pCoeffs;
+  q31_t *pIn;
+  q31_t c0, c1, c2, c3;                         /* 2 * cos(w) of the 4 bins */
+  q31_t a1, a2, b1, b2, d1, d2, e1, e2;         /* s[n-1], s[n-2] of the 4 bins */
+  q31_t x;
+  uint32_t inputShift = S->inputShift;
+  uint32_t binCnt = (uint32_t) S->numBins >> 2u;
+  uint32_t blkCnt, i;
+  uint16_t bin;
+
+  while(binCnt > 0u)
+  {
+    c0 = pCoeffs[0];
+    c1 = pCoeffs[2];
+    c2 = pCoeffs[4];
+    c3 = pCoeffs[6];
+    a1 = a2 = b1 = b2 = d1 = d2 = e1 = e2 = 0;
+
+    pIn = pSrc;
+    blkCnt = S->blockSize;
+
+    /* two samples per loop, the states swap their roles */
+    while(blkCnt > 1u)
+    {
+      x = *pIn++ >> inputShift;
+      a2 = x + (q31_t) (((q63_t) c0 * a1) >> 30) - a2;
+      b2 = x + (q31_t) (((q63_t) c1 * b1) >> 30) - b2;
+      d2 = x + (q31_t) (((q63_t) c2 * d1) >> 30) - d2;
+      e2 = x + (q31_t) (((q63_t) c3 * e1) >> 30) - e2;
+      x = *pIn++ >> inputShift;
+      a1 = x + (q31_t) (((q63_t) c0 * a2) >> 30) - a1;
+      b1 = x + (q31_t) (((q63_t) c1 * b2) >> 30) - b1;
+      d1 = x + (q31_t) (((q63_t) c2 * d2) >> 30) - d1;
+      e1 = x + (q31_t) (((q63_t) c3 * e2) >> 30) - e1;
+      blkCnt -= 2u;
+    }
+
+    if(blkCnt > 0u)
+    {
+      x = *pIn++ >> inputShift;
+      a2 = x + (q31_t) (((q63_t) c0 * a1) >> 30) - a2;
+      b2 = x + (q31_t) (((q63_t) c1 * b1) >> 30) - b2;
+      d2 = x + (q31_t) (((q63_t) c2 * d1) >> 30) - d2;
+      e2 = x + (q31_t) (((q63_t) c3 * e1) >> 30) - e2;
+
+      /* back to s[n-1] in a1 */
+      x = a1; a1 = a2; a2 = x;
+      x = b1; b1 = b2; b2 = x;
+      x = d1; d1 = d2; d2 = x;
+      x = e1; e1 = e2; e2 = x;
+    }
+
+    arm_goertzel_out_q31(S, &pCoeffs[0], a1, a2, &pDst[0]);
+    arm_goertzel_out_q31(S, &pCoeffs[2], b1, b2, &pDst[2]);
+    arm_goertzel_out_q31(S, &pCoeffs[4], d1, d2, &pDst[4]);
+    arm_goertzel_out_q31(S, &pCoeffs[6], e1, e2, &pDst[6]);
+
+    pCoeffs += 8u;
+    pDst += 8u;
+    binCnt--;
+  }
+
+  /* the remaining bins */
+  bin = (uint16_t) (S->numBins & ~3u);
+  for (i = 0u; i < ((uint32_t) S->numBins & 3u); i++)
+  {
+    arm_goertzel_q31(S, bin, pSrc, pDst);
+    bin++;
+    pDst += 2u;
+  }
+}
+
+/**
+ * @} end of Goertzel group
+ */
@@ -0,0 +1,76 @@
+/* ----------------------------------------------------------------------
+* $Date:        19. October 2026
+*
+* Project:      CMSIS DSP Library
+* Title:        arm_goertzel_q31.c
+*
+* Description:  Q31 Goertzel detector, one bin.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup Goertzel
+ * @{
+ */
+
+/**
+ * @brief  Q31 Goertzel detector, one bin.
+ * @param[in]  *S     points to an instance of the Q31 Goertzel structure.
+ * @param[in]  bin    index of the bin.
+ * @param[in]  *pSrc  points to the block of <code>blockSize</code> input samples.
+ * @param[out] *pDst  points to the complex bin value, 2 values in 1.31 format.
+ * @return     none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The input is shifted right by <code>inputShift</code> bits, the resonator runs in
+ * 32 bits with 2.30 coefficients, the product is 64 bit and truncated back. It does not
+ * overflow. The output is shifted back to 1.31 with the block scaling and saturated.
+ */
+
+void arm_goertzel_q31(
+  const arm_goertzel_instance_q31 * S,
+  uint16_t bin,
+  q31_t * pSrc,
+  q31_t * pDst)
+{
+  const q31_t *pCoeffs = &S->pCoeffs[2u * bin];
+  q31_t coeff = pCoeffs[0];                      /* 2 * cos(w) in 2.30 */
+  q31_t s0, s1 = 0, s2 = 0;                      /* s[n], s[n-1], s[n-2] */
+  q63_t re, im;
+  uint32_t blkCnt = S->blockSize;
+  uint32_t inputShift = S->inputShift;
+  uint32_t outShift = inputShift - S->shift;     /* inputShift >= shift */
+
+  /* two samples per loop, the states swap their roles */
+  while(blkCnt > 1u)
+  {
+    s2 = (*pSrc++ >> inputShift) + (q31_t) (((q63_t) coeff * s1) >> 30) - s2;
+    s1 = (*pSrc++ >> inputShift) + (q31_t) (((q63_t) coeff * s2) >> 30) - s1;
+    blkCnt -= 2u;
+  }
+
+  if(blkCnt > 0u)
+  {
+    s0 = (*pSrc >> inputShift) + (q31_t) (((q63_t) coeff * s1) >> 30) - s2;
+    s2 = s1;
+    s1 = s0;
+  }
+
+  re = (q63_t) s1 - (((q63_t) coeff * s2) >> 31);
+  im = ((q63_t) pCoeffs[1] * s2) >> 31;
+
+  pDst[0] = clip_q63_to_q31(re << outShift);
+  pDst[1] = clip_q63_to_q31(im << outShift);
+}
+
+/**
+ * @} end of Goertzel group
+ */
@@ -40,6 +40,19 @@
 
 
 #include "arm_math.h"
+#include "arm_common_tables.h"
+
+/* A and B of the RFFT length, or every (8192/N)-th entry of the tables of
+   8192 when all the tables are built */
+#if defined(ARM_ALL_FFT_TABLES)
+#define ARM_RFFT_COEF(N)      S->pTwiddleAReal = (float32_t *) realCoefA; \
+                              S->pTwiddleBReal = (float32_t *) realCoefB; \
+                              S->twidCoefRModifier = 8192u / (N)
+#else
+#define ARM_RFFT_COEF(N)      S->pTwiddleAReal = (float32_t *) realCoefA_##N; \
+                              S->pTwiddleBReal = (float32_t *) realCoefB_##N; \
+                              S->twidCoefRModifier = 1u
+#endif
 
 /**    
  * @ingroup groupTransforms    
@@ -64,6 +77,7 @@
 
 
 
+#if defined(ARM_ALL_FFT_TABLES)
 static const float32_t realCoefA[8192] = {
   0.500000000000000f, -0.500000000000000f, 0.499616503715515f,
     -0.499999850988388f,
@@ -4162,6 +4176,7 @@ static const float32_t realCoefA[8192] = {
   0.499233007431030f, 0.499999403953552f, 0.499616503715515f,
     0.499999850988388f,
 };
+#endif
 
 
 /**    
@@ -4176,6 +4191,7 @@ static const float32_t realCoefA[8192] = {
 *  } </pre>    
 *    
 */
+#if defined(ARM_ALL_FFT_TABLES)
 static const float32_t realCoefB[8192] = {
   0.500000000000000f, 0.500000000000000f, 0.500383496284485f,
     0.499999850988388f,
@@ -8274,6 +8290,7 @@ static const float32_t realCoefB[8192] = {
   0.500766992568970f, -0.499999403953552f, 0.500383496284485f,
     -0.499999850988388f,
 };
+#endif
 
 
 
@@ -8318,12 +8335,6 @@ arm_status arm_rfft_init_f32(
   /*  Initialize the Complex FFT length */
   S->fftLenBy2 = (uint16_t) fftLenReal / 2u;
 
-  /*  Initialize the Twiddle coefficientA pointer */
-  S->pTwiddleAReal = (float32_t *) realCoefA;
-
-  /*  Initialize the Twiddle coefficientB pointer */
-  S->pTwiddleBReal = (float32_t *) realCoefB;
-
   /*  Initialize the Flag for selection of RFFT or RIFFT */
   S->ifftFlagR = (uint8_t) ifftFlagR;
 
@@ -8334,18 +8345,26 @@ arm_status arm_rfft_init_f32(
   switch (S->fftLenReal)
   {
     /* Init table modifier value */
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_FFT_RFFT_F32_8192)
   case 8192u:
-    S->twidCoefRModifier = 1u;
+    ARM_RFFT_COEF(8192);
     break;
+#endif
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_FFT_RFFT_F32_2048)
   case 2048u:
-    S->twidCoefRModifier = 4u;
+    ARM_RFFT_COEF(2048);
     break;
+#endif
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_FFT_RFFT_F32_512)
   case 512u:
-    S->twidCoefRModifier = 16u;
+    ARM_RFFT_COEF(512);
     break;
+#endif
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_FFT_RFFT_F32_128)
   case 128u:
-    S->twidCoefRModifier = 64u;
+    ARM_RFFT_COEF(128);
     break;
+#endif
   default:
     /*  Reporting argument error if rfftSize is not valid value */
     status = ARM_MATH_ARGUMENT_ERROR;
@@ -41,6 +41,18 @@
 
 #include "arm_math.h"
 #include "arm_common_tables.h"
+
+/* A and B of the RFFT length, or every (8192/N)-th entry of the tables of
+   8192 when all the tables are built */
+#if defined(ARM_ALL_FFT_TABLES)
+#define ARM_RFFT_COEF(N)      S->pTwiddleAReal = (q15_t *) realCoefAQ15; \
+                              S->pTwiddleBReal = (q15_t *) realCoefBQ15; \
+                              S->twidCoefRModifier = 8192u / (N)
+#else
+#define ARM_RFFT_COEF(N)      S->pTwiddleAReal = (q15_t *) realCoefAQ15_##N; \
+                              S->pTwiddleBReal = (q15_t *) realCoefBQ15_##N; \
+                              S->twidCoefRModifier = 1u
+#endif
 #include "arm_const_structs.h"
 
 /**    
@@ -68,6 +80,7 @@
 * Convert to fixed point Q15 format    
 *       round(pATable[i] * pow(2, 15))    
 */
+#if defined(ARM_ALL_FFT_TABLES)
 static const q15_t ALIGN4 realCoefAQ15[8192] = {
     0x4000, 0xc000, 0x3ff3, 0xc000, 0x3fe7, 0xc000, 0x3fda, 0xc000,
     0x3fce, 0xc000, 0x3fc1, 0xc000, 0x3fb5, 0xc000, 0x3fa8, 0xc000,
@@ -1094,6 +1107,7 @@ static const q15_t ALIGN4 realCoefAQ15[8192] = {
     0x3f9b, 0x4000, 0x3fa8, 0x4000, 0x3fb5, 0x4000, 0x3fc1, 0x4000,
     0x3fce, 0x4000, 0x3fda, 0x4000, 0x3fe7, 0x4000, 0x3ff3, 0x4000,
 };
+#endif
 
 /**    
 * \par   
@@ -1110,6 +1124,7 @@ static const q15_t ALIGN4 realCoefAQ15[8192] = {
 *       round(pBTable[i] * pow(2, 15))    
 *    
 */
+#if defined(ARM_ALL_FFT_TABLES)
 static const q15_t ALIGN4 realCoefBQ15[8192] = {
     0x4000, 0x4000, 0x400d, 0x4000, 0x4019, 0x4000, 0x4026, 0x4000,
     0x4032, 0x4000, 0x403f, 0x4000, 0x404b, 0x4000, 0x4058, 0x4000,
@@ -2136,6 +2151,7 @@ static const q15_t ALIGN4 realCoefBQ15[8192] = {
     0x4065, 0xc000, 0x4058, 0xc000, 0x404b, 0xc000, 0x403f, 0xc000,
     0x4032, 0xc000, 0x4026, 0xc000, 0x4019, 0xc000, 0x400d, 0xc000,
 };
+#endif
 
 /**    
 * @brief  Initialization function for the Q15 RFFT/RIFFT.   
@@ -2169,12 +2185,6 @@ arm_status arm_rfft_init_q15(
     /*  Initialize the Real FFT length */
     S->fftLenReal = (uint16_t) fftLenReal;
 
-    /*  Initialize the Twiddle coefficientA pointer */
-    S->pTwiddleAReal = (q15_t *) realCoefAQ15;
-
-    /*  Initialize the Twiddle coefficientB pointer */
-    S->pTwiddleBReal = (q15_t *) realCoefBQ15;
-
     /*  Initialize the Flag for selection of RFFT or RIFFT */
     S->ifftFlagR = (uint8_t) ifftFlagR;
 
@@ -2184,42 +2194,60 @@ arm_status arm_rfft_init_q15(
     /*  Initialization of coef modifier depending on the FFT length */
     switch (S->fftLenReal)
     {
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_FFT_RFFT_Q15_8192)
     case 8192u:
-        S->twidCoefRModifier = 1u;
+        ARM_RFFT_COEF(8192);
         S->pCfft = &arm_cfft_sR_q15_len4096;
         break;
+#endif
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_FFT_RFFT_Q15_4096)
     case 4096u:
-        S->twidCoefRModifier = 2u;
+        ARM_RFFT_COEF(4096);
         S->pCfft = &arm_cfft_sR_q15_len2048;
         break;
+#endif
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_FFT_RFFT_Q15_2048)
     case 2048u:
-        S->twidCoefRModifier = 4u;
+        ARM_RFFT_COEF(2048);
         S->pCfft = &arm_cfft_sR_q15_len1024;
         break;
+#endif
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_FFT_RFFT_Q15_1024)
     case 1024u:
-        S->twidCoefRModifier = 8u;
+        ARM_RFFT_COEF(1024);
         S->pCfft = &arm_cfft_sR_q15_len512;
         break;
+#endif
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_FFT_RFFT_Q15_512)
     case 512u:
-        S->twidCoefRModifier = 16u;
+        ARM_RFFT_COEF(512);
         S->pCfft = &arm_cfft_sR_q15_len256;
         break;
+#endif
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_FFT_RFFT_Q15_256)
     case 256u:
-        S->twidCoefRModifier = 32u;
+        ARM_RFFT_COEF(256);
         S->pCfft = &arm_cfft_sR_q15_len128;
         break;
+#endif
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_FFT_RFFT_Q15_128)
     case 128u:
-        S->twidCoefRModifier = 64u;
+        ARM_RFFT_COEF(128);
         S->pCfft = &arm_cfft_sR_q15_len64;
         break;
+#endif
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_FFT_RFFT_Q15_64)
     case 64u:
-        S->twidCoefRModifier = 128u;
+        ARM_RFFT_COEF(64);
         S->pCfft = &arm_cfft_sR_q15_len32;
         break;
+#endif
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_FFT_RFFT_Q15_32)
     case 32u:
-        S->twidCoefRModifier = 256u;
+        ARM_RFFT_COEF(32);
         S->pCfft = &arm_cfft_sR_q15_len16;
         break;
+#endif
     default:
         /*  Reporting argument error if rfftSize is not valid value */
         status = ARM_MATH_ARGUMENT_ERROR;
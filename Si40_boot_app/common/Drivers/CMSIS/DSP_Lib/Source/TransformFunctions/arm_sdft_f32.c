@@ -0,0 +1,157 @@
+/* ----------------------------------------------------------------------
+* $Date:        19. October 2026
+*
+* Project:      CMSIS DSP Library
+* Title:        arm_sdft_f32.c
+*
+* Description:  Floating-point sliding DFT.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @defgroup SlidingDFT Sliding DFT
+ *
+ * The sliding DFT keeps a few bins of the DFT of the last N samples of a stream up to
+ * date sample by sample, at any frequency. Every new sample costs one complex multiply
+ * per bin, so the bins can be read after any sample, where a block transform or the
+ * Goertzel detector computes the whole window again for every hop.
+ *
+ * \par Algorithm
+ * Every bin at <code>w = 2 * pi * f / sampleRate</code> is
+ * <pre>
+ *    S[n] = sum(r^k * x[n-k] * exp(j * w * k)),  k = 0 ... N-1
+ * </pre>
+ * updated by
+ * <pre>
+ *    S[n] = r * exp(j * w) * S[n-1] + x[n] - r^N * exp(j * w * N) * x[n-N]
+ * </pre>
+ * The recursion sits on the unit circle, without damping the rounding of every step would
+ * stay in the bin forever. The damping <code>r = 1 - 2^-16</code> (ARM_SDFT_DAMPING_Q31)
+ * forgets it in about 65536 samples and tapers the window by r^N, 0.97 for N = 2048.
+ * r^N * exp(j * w * N) is the power of the rounded r * exp(j * w), so a sample leaves the
+ * window exactly.
+ *
+ * \par
+ * Without the damping the bin is the DFT of the window with the phase referred to its
+ * newest sample, the output of the Goertzel detector for the same N samples. The output is
+ * <code>S / 2^ceil(log2(N))</code>, {re, im} per bin, for a power of two window a tone of
+ * amplitude A on the bin gives |S| = A / 2.
+ *
+ * \par
+ * arm_sdft_*() moves the window over a block of any size and writes the bins after its
+ * last sample. A block of 1 sample gives the bins of every sample.
+ *
+ * \par Instance Structure
+ * The instance holds the number of bins, the window, the coefficients and points to the
+ * state: the bins and the delay line of the last N samples. The state belongs to one
+ * stream, the coefficient array may be shared by the instances of the same frequencies,
+ * sample rate and window.
+ *
+ * \par Initialization Functions
+ * arm_sdft_init_*() takes the bin frequencies and the sample rate in Hz as the Goertzel
+ * detector, computes the coefficients by arm_sin_cos_q31() and clears the state.
+ *
+ * \par Fixed-Point Behavior
+ * The Q31 version shifts the input right by <code>ceil(log2(N)) + 1</code> bits, the
+ * bins cannot overflow and keep one bit of headroom; the precision of the input is
+ * 31 - shift bits. The products are 64 bit and rounded. The output is the bin shifted
+ * back by one bit and saturated to 1.31.
+ */
+
+/**
+ * @addtogroup SlidingDFT
+ * @{
+ */
+
+/**
+ * @brief  Floating-point sliding DFT, the window moves over a block of samples.
+ * @param[in,out] *S          points to an instance of the floating-point sliding DFT structure.
+ * @param[in]     *pSrc       points to the block of input samples.
+ * @param[out]    *pDst       points to the complex bin values after the last sample, 2*numBins values.
+ * @param[in]     blockSize   number of samples in the block.
+ * @return        none.
+ */
+
+void arm_sdft_f32(
+  arm_sdft_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t *pBins = S->pState;                  /* {re, im} of the bins */
+  float32_t *pDelay = S->pState + (2u * S->numBins);    /* last length samples */
+  const float32_t *pCoeffs;
+  float32_t *pOld;
+  float32_t re, im, re1, c, s, cN, sN, old;
+  float32_t scale = S->scale;
+  uint32_t numBins = S->numBins;
+  uint32_t length = S->length;
+  uint32_t pos = S->pos;
+  uint32_t count, i, bin;
+
+  while(blockSize > 0u)
+  {
+    /* the chunk ends at the end of the delay line, the samples it
+       drops are all older than the chunk */
+    count = length - pos;
+    if(count > blockSize)
+    {
+      count = blockSize;
+    }
+    pOld = pDelay + pos;
+    pCoeffs = S->pCoeffs;
+
+    for (bin = 0u; bin < numBins; bin++)
+    {
+      c = pCoeffs[0];
+      s = pCoeffs[1];
+      cN = pCoeffs[2];
+      sN = pCoeffs[3];
+      re = pBins[2u * bin];
+      im = pBins[(2u * bin) + 1u];
+
+      for (i = 0u; i < count; i++)
+      {
+        old = pOld[i];
+
+        /* S = r * exp(jw) * S + x[n] - r^N * exp(jwN) * x[n-N] */
+        re1 = ((re * c) - (im * s)) + (pSrc[i] - (old * cN));
+        im = ((re * s) + (im * c)) - (old * sN);
+        re = re1;
+      }
+
+      pBins[2u * bin] = re;
+      pBins[(2u * bin) + 1u] = im;
+      pCoeffs += 4u;
+    }
+
+    /* the chunk takes the place of the samples it dropped */
+    memcpy(pOld, pSrc, count * sizeof(float32_t));
+
+    pSrc += count;
+    blockSize -= count;
+    pos += count;
+    if(pos == length)
+    {
+      pos = 0u;
+    }
+  }
+
+  S->pos = pos;
+
+  for (i = 0u; i < (2u * numBins); i++)
+  {
+    pDst[i] = pBins[i] * scale;
+  }
+}
+
+/**
+ * @} end of SlidingDFT group
+ */
@@ -0,0 +1,128 @@
+/* ----------------------------------------------------------------------
+* $Date:        19. October 2026
+*
+* Project:      CMSIS DSP Library
+* Title:        arm_sdft_init_f32.c
+*
+* Description:  Initialization function for the floating-point sliding DFT.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup SlidingDFT
+ * @{
+ */
+
+/* (re + j * im)^e, in double as the error of the power stays in the bins
+   for 1 / (1 - r) samples; init time only */
+static void arm_sdft_pow(
+  double re,
+  double im,
+  uint32_t e,
+  double * pRe,
+  double * pIm)
+{
+  double outRe = 1.0, outIm = 0.0, t;
+
+  while(e > 0u)
+  {
+    if(e & 1u)
+    {
+      t = (outRe * re) - (outIm * im);
+      outIm = (outRe * im) + (outIm * re);
+      outRe = t;
+    }
+    t = (re * re) - (im * im);
+    im = 2.0 * re * im;
+    re = t;
+    e >>= 1u;
+  }
+
+  *pRe = outRe;
+  *pIm = outIm;
+}
+
+/**
+ * @brief  Initialization function for the floating-point sliding DFT.
+ * @param[in,out] *S          points to an instance of the floating-point sliding DFT structure.
+ * @param[in]     numBins     number of frequency bins.
+ * @param[out]    *pCoeffs    points to the coefficient buffer of 4*numBins values.
+ * @param[in]     *pFreqs     points to the bin frequencies in Hz.
+ * @param[in]     sampleRate  sample rate in Hz.
+ * @param[in]     length      number of samples in the window.
+ * @param[in]     *pState     points to the state buffer of 2*numBins+length values.
+ * @return        ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR if a frequency is not inside (0, sampleRate/2)
+ * or <code>length</code> is not inside [1, 2^30].
+ *
+ * \par
+ * r * exp(jw) is the one of the Q31 version, so both types look at the same frequencies;
+ * its power N is taken in double from the float32_t coefficient. The state is cleared.
+ */
+
+arm_status arm_sdft_init_f32(
+  arm_sdft_instance_f32 * S,
+  uint16_t numBins,
+  float32_t * pCoeffs,
+  const uint32_t * pFreqs,
+  uint32_t sampleRate,
+  uint32_t length,
+  float32_t * pState)
+{
+  q31_t sinVal, cosVal;
+  float32_t c, s;
+  double re, im;
+  uint32_t i, size = 1u;
+
+  if((length == 0u) || (length > 0x40000000u))
+  {
+    return ARM_MATH_ARGUMENT_ERROR;
+  }
+
+  for (i = 0u; i < numBins; i++)
+  {
+    if((pFreqs[i] == 0u) || (2u * (uint64_t) pFreqs[i] >= sampleRate))
+    {
+      return ARM_MATH_ARGUMENT_ERROR;
+    }
+
+    /* angle of the bin in units of pi, 2 * f / fs */
+    arm_sin_cos_q31((q31_t) (((uint64_t) pFreqs[i] << 32) / sampleRate), &sinVal, &cosVal);
+
+    c = (float32_t) (q31_t) (((q63_t) ARM_SDFT_DAMPING_Q31 * cosVal) >> 31) / 2147483648.0f;
+    s = (float32_t) (q31_t) (((q63_t) ARM_SDFT_DAMPING_Q31 * sinVal) >> 31) / 2147483648.0f;
+    arm_sdft_pow((double) c, (double) s, length, &re, &im);
+
+    pCoeffs[4u * i] = c;
+    pCoeffs[(4u * i) + 1u] = s;
+    pCoeffs[(4u * i) + 2u] = (float32_t) re;
+    pCoeffs[(4u * i) + 3u] = (float32_t) im;
+  }
+
+  while(size < length)
+  {
+    size <<= 1u;
+  }
+
+  S->numBins = numBins;
+  S->scale = 1.0f / (float32_t) size;
+  S->length = length;
+  S->pos = 0u;
+  S->pCoeffs = pCoeffs;
+
+  /* Clear the state buffer.  The size is always (2 * numBins + length) */
+  memset(pState, 0, ((2u * numBins) + length) * sizeof(float32_t));
+  S->pState = pState;
+
+  return ARM_MATH_SUCCESS;
+}
+
+/**
+ * @} end of SlidingDFT group
+ */
@@ -0,0 +1,120 @@
+/* ----------------------------------------------------------------------
+* $Date:        19. October 2026
+*
+* Project:      CMSIS DSP Library
+* Title:        arm_sdft_q31.c
+*
+* Description:  Q31 sliding DFT.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup SlidingDFT
+ * @{
+ */
+
+/**
+ * @brief  Q31 sliding DFT, the window moves over a block of samples.
+ * @param[in,out] *S          points to an instance of the Q31 sliding DFT structure.
+ * @param[in]     *pSrc       points to the block of input samples.
+ * @param[out]    *pDst       points to the complex bin values after the last sample, 2*numBins values in 1.31 format.
+ * @param[in]     blockSize   number of samples in the block.
+ * @return        none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The input is shifted right by <code>shift</code> bits and the delay line holds the
+ * shifted samples. The bins are 2.30: |S| is at most N full scale samples over
+ * 2^shift, 1/2. The three products of a part are added in 64 bits, below 2^63, and
+ * rounded back to 32 bits: truncation would add a bias every sample that the damping
+ * keeps for 65536 samples. The output is the bin shifted left by one bit and saturated.
+ */
+
+void arm_sdft_q31(
+  arm_sdft_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  q31_t *pBins = S->pState;                      /* {re, im} of the bins */
+  q31_t *pDelay = S->pState + (2u * S->numBins); /* last length samples, shifted */
+  const q31_t *pCoeffs;
+  q31_t *pOld;
+  q31_t re, im, re1, c, s, cN, sN, old;
+  uint32_t shift = S->shift;
+  uint32_t numBins = S->numBins;
+  uint32_t length = S->length;
+  uint32_t pos = S->pos;
+  uint32_t count, i, bin;
+
+  while(blockSize > 0u)
+  {
+    /* the chunk ends at the end of the delay line, the samples it
+       drops are all older than the chunk */
+    count = length - pos;
+    if(count > blockSize)
+    {
+      count = blockSize;
+    }
+    pOld = pDelay + pos;
+    pCoeffs = S->pCoeffs;
+
+    for (bin = 0u; bin < numBins; bin++)
+    {
+      c = pCoeffs[0];
+      s = pCoeffs[1];
+      cN = pCoeffs[2];
+      sN = pCoeffs[3];
+      re = pBins[2u * bin];
+      im = pBins[(2u * bin) + 1u];
+
+      for (i = 0u; i < count; i++)
+      {
+        old = pOld[i];
+
+        /* S = r * exp(jw) * S + x[n] - r^N * exp(jwN) * x[n-N] */
+        re1 = (q31_t) (((((q63_t) re * c) - ((q63_t) im * s)) - ((q63_t) old * cN) + 0x40000000) >> 31) +
+              (pSrc[i] >> shift);
+        im = (q31_t) (((((q63_t) re * s) + ((q63_t) im * c)) - ((q63_t) old * sN) + 0x40000000) >> 31);
+        re = re1;
+      }
+
+      pBins[2u * bin] = re;
+      pBins[(2u * bin) + 1u] = im;
+      pCoeffs += 4u;
+    }
+
+    /* the chunk takes the place of the samples it dropped */
+    for (i = 0u; i < count; i++)
+    {
+      pOld[i] = pSrc[i] >> shift;
+    }
+
+    pSrc += count;
+    blockSize -= count;
+    pos += count;
+    if(pos == length)
+    {
+      pos = 0u;
+    }
+  }
+
+  S->pos = pos;
+
+  /* 2.30 to 1.31 */
+  for (i = 0u; i < (2u * numBins); i++)
+  {
+    pDst[i] = clip_q63_to_q31((q63_t) pBins[i] << 1);
+  }
+}
+
+/**
+ * @} end of SlidingDFT group
+ */
@@ -0,0 +1,195 @@
+/**************************************************************************//**
+ * @file     arm_arena.h
+ * @brief    Static arena of the state, coefficient and scratch buffers of
+ *           the CMSIS-DSP instances and the buffer lengths per kernel
+ ******************************************************************************/
+/*
+   The init functions of the library take the buffers of an instance from
+   the caller, with lengths that depend on the kernel. The ARM_*_LEN()
+   macros below are those lengths in elements, constant expressions when
+   the arguments are, including what the sources need beyond the
+   documentation (the Q15 FIR init of Cortex-M3/M4 clears numTaps+blockSize
+   values, the _opt correlations read one pair past their scratch).
+
+   A pipeline lists its buffers once, LIST(X) calls X(name, type, len):
+
+     #define RX_ARENA(X) \
+       X(ddcCoeffs, q15_t, 96) \
+       X(ddcState,  q15_t, ARM_DDC_STATE_LEN(96, 1000)) \
+       X(ddcScratch, q15_t, ARM_DDC_SCRATCH_LEN(1000))
+     ARM_ARENA_CHECK(rx, RX_ARENA, 16384);        build stops above 16 KB
+     ARM_ARENA_DEFINE(rxMem, RX_ARENA);            one static region
+     static const arm_arena_entry rxReport[] = ARM_ARENA_REPORT(RX_ARENA);
+
+   and takes them in the same order from the region at run time:
+
+     arm_arena_init(&arena, rxMem, sizeof(rxMem));
+     arm_ddc_init_q15(&ddc, 96, 10, arm_arena_alloc_q15(&arena, 96), ...
+
+   Every buffer starts on ARM_ARENA_ALIGN bytes, ARM_ARENA_SIZE() counts the
+   padding, so the allocations of the list always fit the region. The
+   report is a constant table {name, type, len, bytes} for the trace or a
+   host tool, the region is one symbol in the map file.
+ */
+
+#ifndef __ARM_ARENA_H
+#define __ARM_ARENA_H
+
+#include "arm_math.h"
+
+#ifdef   __cplusplus
+extern "C"
+{
+#endif
+
+  /*
+   * Lengths of the buffers, in elements of the type of the instance.
+   */
+#define ARM_FIR_STATE_LEN(numTaps, blockSize)              ((numTaps) + (blockSize) - 1u)
+#define ARM_FIR_STATE_LEN_Q15(numTaps, blockSize)          ((numTaps) + (blockSize))
+#define ARM_FIR_DECIMATE_STATE_LEN(numTaps, blockSize)     ((numTaps) + (blockSize) - 1u)
+#define ARM_FIR_INTERPOLATE_STATE_LEN(numTaps, L, blockSize) (((numTaps) / (L)) + (blockSize) - 1u)
+#define ARM_FIR_BANK_STATE_LEN(numTaps, blockSize)         ((numTaps) + (blockSize) - 1u)
+#define ARM_FIR_BANK_COEFFS_LEN(numTaps, numFilters)       ((numTaps) * (numFilters))
+#define ARM_BIQUAD_DF1_STATE_LEN(numStages)                (4u * (numStages))
+#define ARM_BIQUAD_DF1_COEFFS_LEN(numStages)               (5u * (numStages))
+#define ARM_BIQUAD_DF1_COEFFS_LEN_Q15(numStages)           (6u * (numStages))
+#define ARM_BIQUAD_DF1_BANK_STATE_LEN(numStages, numFilters)  (4u * (numStages) * (numFilters))
+#define ARM_BIQUAD_DF1_BANK_COEFFS_LEN(numStages, numFilters) (6u * (numStages) * (numFilters))
+#define ARM_BIQUAD_DF2T_STATE_LEN(numStages)               (2u * (numStages))
+#define ARM_GOERTZEL_COEFFS_LEN(numBins)                   (2u * (numBins))
+#define ARM_SDFT_COEFFS_LEN(numBins)                       (4u * (numBins))
+#define ARM_SDFT_STATE_LEN(numBins, length)                ((2u * (numBins)) + (length))
+#define ARM_DDC_STATE_LEN(numTaps, blockSize)              (2u * ((numTaps) + (blockSize) - 1u))
+#define ARM_DDC_SCRATCH_LEN(blockSize)                     (2u * (blockSize))
+#define ARM_DDC_DST_LEN(M, blockSize)                      (2u * ((blockSize) / (M)))
+#define ARM_CORRELATE_OPT_SCRATCH1_LEN(srcALen, srcBLen) \
+  ((((srcALen) > (srcBLen)) ? (srcALen) : (srcBLen)) + \
+   (2u * (((srcALen) < (srcBLen)) ? (srcALen) : (srcBLen))))
+#define ARM_CORRELATE_OPT_SCRATCH2_LEN(srcALen, srcBLen) \
+  ((((srcALen) < (srcBLen)) ? (srcALen) : (srcBLen)) + 2u)
+#define ARM_CFFT_BUF_LEN(fftLen)                           (2u * (fftLen))
+#define ARM_RFFT_DST_LEN(fftLen)                           (2u * (fftLen))
+#define ARM_RFFT_FAST_BUF_LEN(fftLen)                      (fftLen)
+
+  /*
+   * Bytes of the arena.
+   */
+#define ARM_ARENA_ALIGN                 8u
+#define ARM_ARENA_BYTES(type, len) \
+  ((((uint32_t) (len) * (uint32_t) sizeof(type)) + (ARM_ARENA_ALIGN - 1u)) & ~(ARM_ARENA_ALIGN - 1u))
+
+#define ARM_ARENA_ENTRY_BYTES(name, type, len)   + ARM_ARENA_BYTES(type, len)
+#define ARM_ARENA_ENTRY_REPORT(name, type, len)  {#name, #type, (uint32_t) (len), ARM_ARENA_BYTES(type, len)},
+
+  /* bytes of the buffers of LIST, padding included */
+#define ARM_ARENA_SIZE(LIST)            (0u LIST(ARM_ARENA_ENTRY_BYTES))
+  /* build time check of LIST against budget bytes */
+#define ARM_ARENA_CHECK(tag, LIST, budget) \
+  typedef char arm_arena_check_##tag[(ARM_ARENA_SIZE(LIST) <= (budget)) ? 1 : -1]
+  /* static region of LIST, aligned */
+#define ARM_ARENA_DEFINE(var, LIST) \
+  static uint64_t var[(ARM_ARENA_SIZE(LIST) + 7u) / 8u]
+  /* initializer of an arm_arena_entry table of LIST */
+#define ARM_ARENA_REPORT(LIST)          {LIST(ARM_ARENA_ENTRY_REPORT)}
+
+  /**
+   * @brief Instance structure of the arena.
+   */
+  typedef struct
+  {
+    uint8_t *pBase;                    /**< points to the region, ARM_ARENA_ALIGN aligned. */
+    uint32_t size;                     /**< bytes of the region. */
+    uint32_t used;                     /**< bytes taken, padding included. */
+    uint32_t peak;                     /**< highest used since the init. */
+  } arm_arena_instance;
+
+  /**
+   * @brief Line of the report of a buffer list.
+   */
+  typedef struct
+  {
+    const char *name;                  /**< name of the buffer. */
+    const char *type;                  /**< element type. */
+    uint32_t len;                      /**< elements. */
+    uint32_t bytes;                    /**< bytes in the arena, padding included. */
+  } arm_arena_entry;
+
+  /**
+   * @brief  Initialization function of the arena.
+   * @param[out] *S     points to an instance of the arena.
+   * @param[in]  *pMem  points to the region, ARM_ARENA_ALIGN aligned.
+   * @param[in]  size   bytes of the region.
+   * @return none.
+   */
+  void arm_arena_init(
+  arm_arena_instance * S,
+  void *pMem,
+  uint32_t size);
+
+  /**
+   * @brief  Takes a buffer from the arena.
+   * @param[in,out] *S     points to an instance of the arena.
+   * @param[in]     bytes  bytes of the buffer.
+   * @return pointer to the buffer, ARM_ARENA_ALIGN aligned, or NULL if the arena is full.
+   */
+  void *arm_arena_alloc(
+  arm_arena_instance * S,
+  uint32_t bytes);
+
+  /**
+   * @brief  Gives back all buffers taken after a mark of arm_arena_mark().
+   * @param[in,out] *S     points to an instance of the arena.
+   * @param[in]     mark   value of arm_arena_mark(), 0 for all buffers.
+   * @return none.
+   */
+  void arm_arena_release(
+  arm_arena_instance * S,
+  uint32_t mark);
+
+  /**
+   * @brief  Mark of the buffers taken so far.
+   * @param[in] *S     points to an instance of the arena.
+   * @return mark for arm_arena_release().
+   */
+  static __INLINE uint32_t arm_arena_mark(
+  const arm_arena_instance * S)
+  {
+    return S->used;
+  }
+
+  /**
+   * @brief  Takes a buffer of len Q15 values.
+   */
+  static __INLINE q15_t *arm_arena_alloc_q15(
+  arm_arena_instance * S,
+  uint32_t len)
+  {
+    return (q15_t *) arm_arena_alloc(S, len * (uint32_t) sizeof(q15_t));
+  }
+
+  /**
+   * @brief  Takes a buffer of len Q31 values.
+   */
+  static __INLINE q31_t *arm_arena_alloc_q31(
+  arm_arena_instance * S,
+  uint32_t len)
+  {
+    return (q31_t *) arm_arena_alloc(S, len * (uint32_t) sizeof(q31_t));
+  }
+
+  /**
+   * @brief  Takes a buffer of len floating-point values.
+   */
+  static __INLINE float32_t *arm_arena_alloc_f32(
+  arm_arena_instance * S,
+  uint32_t len)
+  {
+    return (float32_t *) arm_arena_alloc(S, len * (uint32_t) sizeof(float32_t));
+  }
+
+#ifdef   __cplusplus
+}
+#endif
+
+#endif /* __ARM_ARENA_H */
@@ -43,6 +43,482 @@
 
 #include "arm_math.h"
 
+/*
+ * Selection of the FFT tables.
+ *
+ * Without ARM_DSP_CONFIG_TABLES every table is built (ARM_ALL_FFT_TABLES),
+ * as before. With ARM_DSP_CONFIG_TABLES only the tables of the transforms
+ * named by ARM_FFT_<transform>_<type>_<length> are built, the init function
+ * of any other length returns ARM_MATH_ARGUMENT_ERROR:
+ *   ARM_FFT_CFFT_F32_<N>, _Q31_, _Q15_       arm_cfft_sR_*_len<N>, 16..4096
+ *   ARM_FFT_RFFT_FAST_F32_<N>                 arm_rfft_fast_init_f32(), 32..4096
+ *   ARM_FFT_RFFT_Q31_<N>, _Q15_               arm_rfft_init_q31/q15(), 32..8192
+ *   ARM_FFT_RFFT_F32_<N>                      arm_rfft_init_f32(), 128..8192
+ *   ARM_FFT_RADIX2_F32_<N>, _Q31_, _Q15_      arm_cfft_radix2_init_*(), 16..4096
+ *   ARM_FFT_RADIX4_F32_<N>, _Q31_, _Q15_      arm_cfft_radix4_init_*(), 16..4096
+ *   ARM_FFT_DCT4_F32_<N>, _Q31_, _Q15_        arm_dct4_init_*(), 128..8192
+ * Define them for every file of the library, e.g. in the preprocessor
+ * options of the project. The lists below add the tables a transform uses
+ * (ARM_TABLE_*) and the transforms it is built on. In this mode the radix-2
+ * and radix-4 and the RFFT of arm_rfft_init_*() take the table of their own
+ * length instead of every 2^k-th entry of the longest one, the tables of
+ * one length are exactly those entries (arm_rfft_tables.c, made by
+ * tools/dsptables). tools/dsptables built with the same defines prints the
+ * bytes of the tables of a configuration.
+ */
+#if !defined(ARM_DSP_CONFIG_TABLES)
+#define ARM_ALL_FFT_TABLES
+#else
+
+/* DCT4 on the RFFT of its length */
+#if defined(ARM_FFT_DCT4_F32_128)
+#define ARM_FFT_RFFT_F32_128
+#endif
+#if defined(ARM_FFT_DCT4_F32_512)
+#define ARM_FFT_RFFT_F32_512
+#endif
+#if defined(ARM_FFT_DCT4_F32_2048)
+#define ARM_FFT_RFFT_F32_2048
+#endif
+#if defined(ARM_FFT_DCT4_F32_8192)
+#define ARM_FFT_RFFT_F32_8192
+#endif
+#if defined(ARM_FFT_DCT4_Q31_128)
+#define ARM_FFT_RFFT_Q31_128
+#endif
+#if defined(ARM_FFT_DCT4_Q31_512)
+#define ARM_FFT_RFFT_Q31_512
+#endif
+#if defined(ARM_FFT_DCT4_Q31_2048)
+#define ARM_FFT_RFFT_Q31_2048
+#endif
+#if defined(ARM_FFT_DCT4_Q31_8192)
+#define ARM_FFT_RFFT_Q31_8192
+#endif
+#if defined(ARM_FFT_DCT4_Q15_128)
+#define ARM_FFT_RFFT_Q15_128
+#endif
+#if defined(ARM_FFT_DCT4_Q15_512)
+#define ARM_FFT_RFFT_Q15_512
+#endif
+#if defined(ARM_FFT_DCT4_Q15_2048)
+#define ARM_FFT_RFFT_Q15_2048
+#endif
+#if defined(ARM_FFT_DCT4_Q15_8192)
+#define ARM_FFT_RFFT_Q15_8192
+#endif
+
+/* RFFT on the complex FFT of half its length */
+#if defined(ARM_FFT_RFFT_F32_128)
+#define ARM_FFT_RADIX4_F32_64
+#define ARM_TABLE_REALCOEF_F32_128
+#endif
+#if defined(ARM_FFT_RFFT_F32_512)
+#define ARM_FFT_RADIX4_F32_256
+#define ARM_TABLE_REALCOEF_F32_512
+#endif
+#if defined(ARM_FFT_RFFT_F32_2048)
+#define ARM_FFT_RADIX4_F32_1024
+#define ARM_TABLE_REALCOEF_F32_2048
+#endif
+#if defined(ARM_FFT_RFFT_F32_8192)
+#define ARM_FFT_RADIX4_F32_4096
+#define ARM_TABLE_REALCOEF_F32_8192
+#endif
+#if defined(ARM_FFT_RFFT_Q31_32)
+#define ARM_FFT_CFFT_Q31_16
+#define ARM_TABLE_REALCOEF_Q31_32
+#endif
+#if defined(ARM_FFT_RFFT_Q31_64)
+#define ARM_FFT_CFFT_Q31_32
+#define ARM_TABLE_REALCOEF_Q31_64
+#endif
+#if defined(ARM_FFT_RFFT_Q31_128)
+#define ARM_FFT_CFFT_Q31_64
+#define ARM_TABLE_REALCOEF_Q31_128
+#endif
+#if defined(ARM_FFT_RFFT_Q31_256)
+#define ARM_FFT_CFFT_Q31_128
+#define ARM_TABLE_REALCOEF_Q31_256
+#endif
+#if defined(ARM_FFT_RFFT_Q31_512)
+#define ARM_FFT_CFFT_Q31_256
+#define ARM_TABLE_REALCOEF_Q31_512
+#endif
+#if defined(ARM_FFT_RFFT_Q31_1024)
+#define ARM_FFT_CFFT_Q31_512
+#define ARM_TABLE_REALCOEF_Q31_1024
+#endif
+#if defined(ARM_FFT_RFFT_Q31_2048)
+#define ARM_FFT_CFFT_Q31_1024
+#define ARM_TABLE_REALCOEF_Q31_2048
+#endif
+#if defined(ARM_FFT_RFFT_Q31_4096)
+#define ARM_FFT_CFFT_Q31_2048
+#define ARM_TABLE_REALCOEF_Q31_4096
+#endif
+#if defined(ARM_FFT_RFFT_Q31_8192)
+#define ARM_FFT_CFFT_Q31_4096
+#define ARM_TABLE_REALCOEF_Q31_8192
+#endif
+#if defined(ARM_FFT_RFFT_Q15_32)
+#define ARM_FFT_CFFT_Q15_16
+#define ARM_TABLE_REALCOEF_Q15_32
+#endif
+#if defined(ARM_FFT_RFFT_Q15_64)
+#define ARM_FFT_CFFT_Q15_32
+#define ARM_TABLE_REALCOEF_Q15_64
+#endif
+#if defined(ARM_FFT_RFFT_Q15_128)
+#define ARM_FFT_CFFT_Q15_64
+#define ARM_TABLE_REALCOEF_Q15_128
+#endif
+#if defined(ARM_FFT_RFFT_Q15_256)
+#define ARM_FFT_CFFT_Q15_128
+#define ARM_TABLE_REALCOEF_Q15_256
+#endif
+#if defined(ARM_FFT_RFFT_Q15_512)
+#define ARM_FFT_CFFT_Q15_256
+#define ARM_TABLE_REALCOEF_Q15_512
+#endif
+#if defined(ARM_FFT_RFFT_Q15_1024)
+#define ARM_FFT_CFFT_Q15_512
+#define ARM_TABLE_REALCOEF_Q15_1024
+#endif
+#if defined(ARM_FFT_RFFT_Q15_2048)
+#define ARM_FFT_CFFT_Q15_1024
+#define ARM_TABLE_REALCOEF_Q15_2048
+#endif
+#if defined(ARM_FFT_RFFT_Q15_4096)
+#define ARM_FFT_CFFT_Q15_2048
+#define ARM_TABLE_REALCOEF_Q15_4096
+#endif
+#if defined(ARM_FFT_RFFT_Q15_8192)
+#define ARM_FFT_CFFT_Q15_4096
+#define ARM_TABLE_REALCOEF_Q15_8192
+#endif
+#if defined(ARM_FFT_RFFT_FAST_F32_32)
+#define ARM_FFT_CFFT_F32_16
+#define ARM_TABLE_TWIDDLECOEF_RFFT_F32_32
+#endif
+#if defined(ARM_FFT_RFFT_FAST_F32_64)
+#define ARM_FFT_CFFT_F32_32
+#define ARM_TABLE_TWIDDLECOEF_RFFT_F32_64
+#endif
+#if defined(ARM_FFT_RFFT_FAST_F32_128)
+#define ARM_FFT_CFFT_F32_64
+#define ARM_TABLE_TWIDDLECOEF_RFFT_F32_128
+#endif
+#if defined(ARM_FFT_RFFT_FAST_F32_256)
+#define ARM_FFT_CFFT_F32_128
+#define ARM_TABLE_TWIDDLECOEF_RFFT_F32_256
+#endif
+#if defined(ARM_FFT_RFFT_FAST_F32_512)
+#define ARM_FFT_CFFT_F32_256
+#define ARM_TABLE_TWIDDLECOEF_RFFT_F32_512
+#endif
+#if defined(ARM_FFT_RFFT_FAST_F32_1024)
+#define ARM_FFT_CFFT_F32_512
+#define ARM_TABLE_TWIDDLECOEF_RFFT_F32_1024
+#endif
+#if defined(ARM_FFT_RFFT_FAST_F32_2048)
+#define ARM_FFT_CFFT_F32_1024
+#define ARM_TABLE_TWIDDLECOEF_RFFT_F32_2048
+#endif
+#if defined(ARM_FFT_RFFT_FAST_F32_4096)
+#define ARM_FFT_CFFT_F32_2048
+#define ARM_TABLE_TWIDDLECOEF_RFFT_F32_4096
+#endif
+
+/* complex FFTs */
+#if defined(ARM_FFT_RADIX2_F32_16)
+#define ARM_TABLE_TWIDDLECOEF_F32_16
+#define ARM_TABLE_BITREV_1024
+#endif
+#if defined(ARM_FFT_RADIX2_F32_32)
+#define ARM_TABLE_TWIDDLECOEF_F32_32
+#define ARM_TABLE_BITREV_1024
+#endif
+#if defined(ARM_FFT_RADIX2_F32_64)
+#define ARM_TABLE_TWIDDLECOEF_F32_64
+#define ARM_TABLE_BITREV_1024
+#endif
+#if defined(ARM_FFT_RADIX2_F32_128)
+#define ARM_TABLE_TWIDDLECOEF_F32_128
+#define ARM_TABLE_BITREV_1024
+#endif
+#if defined(ARM_FFT_RADIX2_F32_256)
+#define ARM_TABLE_TWIDDLECOEF_F32_256
+#define ARM_TABLE_BITREV_1024
+#endif
+#if defined(ARM_FFT_RADIX2_F32_512)
+#define ARM_TABLE_TWIDDLECOEF_F32_512
+#define ARM_TABLE_BITREV_1024
+#endif
+#if defined(ARM_FFT_RADIX2_F32_1024)
+#define ARM_TABLE_TWIDDLECOEF_F32_1024
+#define ARM_TABLE_BITREV_1024
+#endif
+#if defined(ARM_FFT_RADIX2_F32_2048)
+#define ARM_TABLE_TWIDDLECOEF_F32_2048
+#define ARM_TABLE_BITREV_1024
+#endif
+#if defined(ARM_FFT_RADIX2_F32_4096)
+#define ARM_TABLE_TWIDDLECOEF_F32_4096
+#define ARM_TABLE_BITREV_1024
+#endif
+#if defined(ARM_FFT_RADIX2_Q31_16)
+#define ARM_TABLE_TWIDDLECOEF_Q31_16
+#define ARM_TABLE_BITREV_1024
+#endif
+#if defined(ARM_FFT_RADIX2_Q31_32)
+#define ARM_TABLE_TWIDDLECOEF_Q31_32
+#define ARM_TABLE_BITREV_1024
+#endif
+#if defined(ARM_FFT_RADIX2_Q31_64)
+#define ARM_TABLE_TWIDDLECOEF_Q31_64
+#define ARM_TABLE_BITREV_1024
+#endif
+#if defined(ARM_FFT_RADIX2_Q31_128)
+#define ARM_TABLE_TWIDDLECOEF_Q31_128
+#define ARM_TABLE_BITREV_1024
+#endif
+#if defined(ARM_FFT_RADIX2_Q31_256)
+#define ARM_TABLE_TWIDDLECOEF_Q31_256
+#define ARM_TABLE_BITREV_1024
+#endif
+#if defined(ARM_FFT_RADIX2_Q31_512)
+#define ARM_TABLE_TWIDDLECOEF_Q31_512
+#define ARM_TABLE_BITREV_1024
+#endif
+#if defined(ARM_FFT_RADIX2_Q31_1024)
+#define ARM_TABLE_TWIDDLECOEF_Q31_1024
+#define ARM_TABLE_BITREV_1024
+#endif
+#if defined(ARM_FFT_RADIX2_Q31_2048)
+#define ARM_TABLE_TWIDDLECOEF_Q31_2048
+#define ARM_TABLE_BITREV_1024
+#endif
+#if defined(ARM_FFT_RADIX2_Q31_4096)
+#define ARM_TABLE_TWIDDLECOEF_Q31_4096
+#define ARM_TABLE_BITREV_1024
+#endif
+#if defined(ARM_FFT_RADIX2_Q15_16)
+#define ARM_TABLE_TWIDDLECOEF_Q15_16
+#define ARM_TABLE_BITREV_1024
+#endif
+#if defined(ARM_FFT_RADIX2_Q15_32)
+#define ARM_TABLE_TWIDDLECOEF_Q15_32
+#define ARM_TABLE_BITREV_1024
+#endif
+#if defined(ARM_FFT_RADIX2_Q15_64)
+#define ARM_TABLE_TWIDDLECOEF_Q15_64
+#define ARM_TABLE_BITREV_1024
+#endif
+#if defined(ARM_FFT_RADIX2_Q15_128)
+#define ARM_TABLE_TWIDDLECOEF_Q15_128
+#define ARM_TABLE_BITREV_1024
+#endif
+#if defined(ARM_FFT_RADIX2_Q15_256)
+#define ARM_TABLE_TWIDDLECOEF_Q15_256
+#define ARM_TABLE_BITREV_1024
+#endif
+#if defined(ARM_FFT_RADIX2_Q15_512)
+#define ARM_TABLE_TWIDDLECOEF_Q15_512
+#define ARM_TABLE_BITREV_1024
+#endif
+#if defined(ARM_FFT_RADIX2_Q15_1024)
+#define ARM_TABLE_TWIDDLECOEF_Q15_1024
+#define ARM_TABLE_BITREV_1024
+#endif
+#if defined(ARM_FFT_RADIX2_Q15_2048)
+#define ARM_TABLE_TWIDDLECOEF_Q15_2048
+#define ARM_TABLE_BITREV_1024
+#endif
+#if defined(ARM_FFT_RADIX2_Q15_4096)
+#define ARM_TABLE_TWIDDLECOEF_Q15_4096
+#define ARM_TABLE_BITREV_1024
+#endif
+#if defined(ARM_FFT_RADIX4_F32_16)
+#define ARM_TABLE_TWIDDLECOEF_F32_16
+#define ARM_TABLE_BITREV_1024
+#endif
+#if defined(ARM_FFT_RADIX4_F32_64)
+#define ARM_TABLE_TWIDDLECOEF_F32_64
+#define ARM_TABLE_BITREV_1024
+#endif
+#if defined(ARM_FFT_RADIX4_F32_256)
+#define ARM_TABLE_TWIDDLECOEF_F32_256
+#define ARM_TABLE_BITREV_1024
+#endif
+#if defined(ARM_FFT_RADIX4_F32_1024)
+#define ARM_TABLE_TWIDDLECOEF_F32_1024
+#define ARM_TABLE_BITREV_1024
+#endif
+#if defined(ARM_FFT_RADIX4_F32_4096)
+#define ARM_TABLE_TWIDDLECOEF_F32_4096
+#define ARM_TABLE_BITREV_1024
+#endif
+#if defined(ARM_FFT_RADIX4_Q31_16)
+#define ARM_TABLE_TWIDDLECOEF_Q31_16
+#define ARM_TABLE_BITREV_1024
+#endif
+#if defined(ARM_FFT_RADIX4_Q31_64)
+#define ARM_TABLE_TWIDDLECOEF_Q31_64
+#define ARM_TABLE_BITREV_1024
+#endif
+#if defined(ARM_FFT_RADIX4_Q31_256)
+#define ARM_TABLE_TWIDDLECOEF_Q31_256
+#define ARM_TABLE_BITREV_1024
+#endif
+#if defined(ARM_FFT_RADIX4_Q31_1024)
+#define ARM_TABLE_TWIDDLECOEF_Q31_1024
+#define ARM_TABLE_BITREV_1024
+#endif
+#if defined(ARM_FFT_RADIX4_Q31_4096)
+#define ARM_TABLE_TWIDDLECOEF_Q31_4096
+#define ARM_TABLE_BITREV_1024
+#endif
+#if defined(ARM_FFT_RADIX4_Q15_16)
+#define ARM_TABLE_TWIDDLECOEF_Q15_16
+#define ARM_TABLE_BITREV_1024
+#endif
+#if defined(ARM_FFT_RADIX4_Q15_64)
+#define ARM_TABLE_TWIDDLECOEF_Q15_64
+#define ARM_TABLE_BITREV_1024
+#endif
+#if defined(ARM_FFT_RADIX4_Q15_256)
+#define ARM_TABLE_TWIDDLECOEF_Q15_256
+#define ARM_TABLE_BITREV_1024
+#endif
+#if defined(ARM_FFT_RADIX4_Q15_1024)
+#define ARM_TABLE_TWIDDLECOEF_Q15_1024
+#define ARM_TABLE_BITREV_1024
+#endif
+#if defined(ARM_FFT_RADIX4_Q15_4096)
+#define ARM_TABLE_TWIDDLECOEF_Q15_4096
+#define ARM_TABLE_BITREV_1024
+#endif
+#if defined(ARM_FFT_CFFT_F32_16)
+#define ARM_TABLE_TWIDDLECOEF_F32_16
+#define ARM_TABLE_BITREVIDX_FLT_16
+#endif
+#if defined(ARM_FFT_CFFT_F32_32)
+#define ARM_TABLE_TWIDDLECOEF_F32_32
+#define ARM_TABLE_BITREVIDX_FLT_32
+#endif
+#if defined(ARM_FFT_CFFT_F32_64)
+#define ARM_TABLE_TWIDDLECOEF_F32_64
+#define ARM_TABLE_BITREVIDX_FLT_64
+#endif
+#if defined(ARM_FFT_CFFT_F32_128)
+#define ARM_TABLE_TWIDDLECOEF_F32_128
+#define ARM_TABLE_BITREVIDX_FLT_128
+#endif
+#if defined(ARM_FFT_CFFT_F32_256)
+#define ARM_TABLE_TWIDDLECOEF_F32_256
+#define ARM_TABLE_BITREVIDX_FLT_256
+#endif
+#if defined(ARM_FFT_CFFT_F32_512)
+#define ARM_TABLE_TWIDDLECOEF_F32_512
+#define ARM_TABLE_BITREVIDX_FLT_512
+#endif
+#if defined(ARM_FFT_CFFT_F32_1024)
+#define ARM_TABLE_TWIDDLECOEF_F32_1024
+#define ARM_TABLE_BITREVIDX_FLT_1024
+#endif
+#if defined(ARM_FFT_CFFT_F32_2048)
+#define ARM_TABLE_TWIDDLECOEF_F32_2048
+#define ARM_TABLE_BITREVIDX_FLT_2048
+#endif
+#if defined(ARM_FFT_CFFT_F32_4096)
+#define ARM_TABLE_TWIDDLECOEF_F32_4096
+#define ARM_TABLE_BITREVIDX_FLT_4096
+#endif
+#if defined(ARM_FFT_CFFT_Q31_16)
+#define ARM_TABLE_TWIDDLECOEF_Q31_16
+#define ARM_TABLE_BITREVIDX_FXT_16
+#endif
+#if defined(ARM_FFT_CFFT_Q31_32)
+#define ARM_TABLE_TWIDDLECOEF_Q31_32
+#define ARM_TABLE_BITREVIDX_FXT_32
+#endif
+#if defined(ARM_FFT_CFFT_Q31_64)
+#define ARM_TABLE_TWIDDLECOEF_Q31_64
+#define ARM_TABLE_BITREVIDX_FXT_64
+#endif
+#if defined(ARM_FFT_CFFT_Q31_128)
+#define ARM_TABLE_TWIDDLECOEF_Q31_128
+#define ARM_TABLE_BITREVIDX_FXT_128
+#endif
+#if defined(ARM_FFT_CFFT_Q31_256)
+#define ARM_TABLE_TWIDDLECOEF_Q31_256
+#define ARM_TABLE_BITREVIDX_FXT_256
+#endif
+#if defined(ARM_FFT_CFFT_Q31_512)
+#define ARM_TABLE_TWIDDLECOEF_Q31_512
+#define ARM_TABLE_BITREVIDX_FXT_512
+#endif
+#if defined(ARM_FFT_CFFT_Q31_1024)
+#define ARM_TABLE_TWIDDLECOEF_Q31_1024
+#define ARM_TABLE_BITREVIDX_FXT_1024
+#endif
+#if defined(ARM_FFT_CFFT_Q31_2048)
+#define ARM_TABLE_TWIDDLECOEF_Q31_2048
+#define ARM_TABLE_BITREVIDX_FXT_2048
+#endif
+#if defined(ARM_FFT_CFFT_Q31_4096)
+#define ARM_TABLE_TWIDDLECOEF_Q31_4096
+#define ARM_TABLE_BITREVIDX_FXT_4096
+#endif
+#if defined(ARM_FFT_CFFT_Q15_16)
+#define ARM_TABLE_TWIDDLECOEF_Q15_16
+#define ARM_TABLE_BITREVIDX_FXT_16
+#endif
+#if defined(ARM_FFT_CFFT_Q15_32)
+#define ARM_TABLE_TWIDDLECOEF_Q15_32
+#define ARM_TABLE_BITREVIDX_FXT_32
+#endif
+#if defined(ARM_FFT_CFFT_Q15_64)
+#define ARM_TABLE_TWIDDLECOEF_Q15_64
+#define ARM_TABLE_BITREVIDX_FXT_64
+#endif
+#if defined(ARM_FFT_CFFT_Q15_128)
+#define ARM_TABLE_TWIDDLECOEF_Q15_128
+#define ARM_TABLE_BITREVIDX_FXT_128
+#endif
+#if defined(ARM_FFT_CFFT_Q15_256)
+#define ARM_TABLE_TWIDDLECOEF_Q15_256
+#define ARM_TABLE_BITREVIDX_FXT_256
+#endif
+#if defined(ARM_FFT_CFFT_Q15_512)
+#define ARM_TABLE_TWIDDLECOEF_Q15_512
+#define ARM_TABLE_BITREVIDX_FXT_512
+#endif
+#if defined(ARM_FFT_CFFT_Q15_1024)
+#define ARM_TABLE_TWIDDLECOEF_Q15_1024
+#define ARM_TABLE_BITREVIDX_FXT_1024
+#endif
+#if defined(ARM_FFT_CFFT_Q15_2048)
+#define ARM_TABLE_TWIDDLECOEF_Q15_2048
+#define ARM_TABLE_BITREVIDX_FXT_2048
+#endif
+#if defined(ARM_FFT_CFFT_Q15_4096)
+#define ARM_TABLE_TWIDDLECOEF_Q15_4096
+#define ARM_TABLE_BITREVIDX_FXT_4096
+#endif
+
+#endif /* ARM_DSP_CONFIG_TABLES */
+
+/* every table in a section of its own, so the linker drops the tables
+   nobody refers to without -fdata-sections; ILINK of IAR drops unused
+   objects one by one anyway, the host build does not need it */
+#if defined(__GNUC__) && !defined(ARM_MATH_HOST)
+#define ARM_TABLE_SECTION(name)  __attribute__((section(".rodata." #name)))
+#else
+#define ARM_TABLE_SECTION(name)
+#endif
+
 extern const uint16_t armBitRevTable[1024];
 extern const q15_t armRecipTableQ15[64];
 extern const q31_t armRecipTableQ31[64];
@@ -85,6 +561,31 @@ extern const float32_t twiddleCoef_rfft_1024[1024];
 extern const float32_t twiddleCoef_rfft_2048[2048];
 extern const float32_t twiddleCoef_rfft_4096[4096];
 
+/* coefficients of arm_rfft_init_*() with ARM_DSP_CONFIG_TABLES, A and B of
+   one length, arm_rfft_tables.c */
+extern const float32_t realCoefA_128[128], realCoefB_128[128];
+extern const float32_t realCoefA_512[512], realCoefB_512[512];
+extern const float32_t realCoefA_2048[2048], realCoefB_2048[2048];
+extern const float32_t realCoefA_8192[8192], realCoefB_8192[8192];
+extern const q31_t realCoefAQ31_32[32], realCoefBQ31_32[32];
+extern const q31_t realCoefAQ31_64[64], realCoefBQ31_64[64];
+extern const q31_t realCoefAQ31_128[128], realCoefBQ31_128[128];
+extern const q31_t realCoefAQ31_256[256], realCoefBQ31_256[256];
+extern const q31_t realCoefAQ31_512[512], realCoefBQ31_512[512];
+extern const q31_t realCoefAQ31_1024[1024], realCoefBQ31_1024[1024];
+extern const q31_t realCoefAQ31_2048[2048], realCoefBQ31_2048[2048];
+extern const q31_t realCoefAQ31_4096[4096], realCoefBQ31_4096[4096];
+extern const q31_t realCoefAQ31_8192[8192], realCoefBQ31_8192[8192];
+extern const q15_t realCoefAQ15_32[32], realCoefBQ15_32[32];
+extern const q15_t realCoefAQ15_64[64], realCoefBQ15_64[64];
+extern const q15_t realCoefAQ15_128[128], realCoefBQ15_128[128];
+extern const q15_t realCoefAQ15_256[256], realCoefBQ15_256[256];
+extern const q15_t realCoefAQ15_512[512], realCoefBQ15_512[512];
+extern const q15_t realCoefAQ15_1024[1024], realCoefBQ15_1024[1024];
+extern const q15_t realCoefAQ15_2048[2048], realCoefBQ15_2048[2048];
+extern const q15_t realCoefAQ15_4096[4096], realCoefBQ15_4096[4096];
+extern const q15_t realCoefAQ15_8192[8192], realCoefBQ15_8192[8192];
+
 
 /* floating-point bit reversal tables */
 #define ARMBITREVINDEXTABLE__16_TABLE_LENGTH ((uint16_t)20  )
@@ -134,6 +134,19 @@
    * and ARM_MATH_CM0 for building library on Cortex-M0 target, ARM_MATH_CM0PLUS for building library on Cortex-M0+ target, and
    * ARM_MATH_CM7 for building the library on cortex-M7.
    *
+   * - ARM_MATH_HOST:
+   *
+   * Define macro ARM_MATH_HOST for building the library on the host (x86-64, gcc or clang), for development,
+   * regression tests and benchmarks off-target. The library is built as for Cortex-M3, core instructions are
+   * given in portable C by cmsis_host.h, so fixed-point results are bit-exact to the Cortex-M3 build.
+   *
+   * - ARM_MATH_HOST_SIMD:
+   *
+   * Define macro ARM_MATH_HOST_SIMD together with ARM_MATH_HOST to link the SSE4.1/AVX2 kernels of
+   * DSP_Lib/Source/HostFunctions instead of the portable C of arm_fir_q15(), arm_cfft_q15(),
+   * arm_biquad_cascade_df1_q15() and arm_dot_prod_q31(). The kernel is selected at run time by the CPU,
+   * results are bit-exact to the portable C, which stays available as <function>_portable (arm_math_host.h).
+   *
    * - __FPU_PRESENT:
    *
    * Initialize macro __FPU_PRESENT = 1 when building on FPU supported Targets. Enable this macro for M4bf and M4lf libraries
@@ -310,11 +323,21 @@
 #elif defined (ARM_MATH_CM0PLUS)
   #include "core_cm0plus.h"
   #define ARM_MATH_CM0_FAMILY
+#elif defined (ARM_MATH_HOST)
+  #include "cmsis_host.h"
+  #define ARM_MATH_CM3                /* C intrinsics of Cortex-M3, see cmsis_host.h */
 #else
-  #error "Define according the used Cortex core ARM_MATH_CM7, ARM_MATH_CM4, ARM_MATH_CM3, ARM_MATH_CM0PLUS or ARM_MATH_CM0"
+  #error "Define according the used Cortex core ARM_MATH_CM7, ARM_MATH_CM4, ARM_MATH_CM3, ARM_MATH_CM0PLUS, ARM_MATH_CM0 or ARM_MATH_HOST"
 #endif
 
 #undef  __CMSIS_GENERIC         /* enable NVIC and Systick functions */
+
+/* definition name of the functions with host SIMD kernels, see arm_math_host.h */
+#if defined (ARM_MATH_HOST) && defined (ARM_MATH_HOST_SIMD)
+  #define ARM_MATH_PORTABLE(fn)   fn##_portable
+#else
+  #define ARM_MATH_PORTABLE(fn)   fn
+#endif
 #include "string.h"
 #include "math.h"
 #ifdef   __cplusplus
@@ -1139,6 +1162,50 @@ extern "C"
   q15_t * pState,
   uint32_t blockSize);
 
+  /**
+   * @brief Instance structure for the Q15 FIR filter bank.
+   */
+  typedef struct
+  {
+    uint16_t numFilters;     /**< number of filters in the bank. */
+    uint16_t numTaps;        /**< number of coefficients of every filter, even. */
+    q15_t *pState;           /**< points to the state array of length numTaps+blockSize-1, shared by the filters. */
+    q15_t *pCoeffs;          /**< points to the coefficient array of length numTaps*numFilters, pairs interleaved by filter. */
+  } arm_fir_bank_instance_q15;
+
+  /**
+   * @brief Processing function for the Q15 FIR filter bank.
+   * @param[in]  S          points to an instance of the Q15 FIR filter bank structure.
+   * @param[in]  pSrc       points to the block of input data.
+   * @param[out] pDst       points to the block of output data, blockSize*numFilters values interleaved by filter.
+   * @param[in]  blockSize  number of samples to process.
+   */
+  void arm_fir_bank_q15(
+  const arm_fir_bank_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q15 FIR filter bank.
+   * @param[in,out] S             points to an instance of the Q15 FIR filter bank structure.
+   * @param[in]     numFilters    number of filters in the bank.
+   * @param[in]     numTaps       number of coefficients of every filter. Must be even and greater than or equal to 4.
+   * @param[in]     pFilterCoeffs points to the coefficients of the filters one after another, numTaps each, as for arm_fir_init_q15().
+   * @param[out]    pCoeffs       points to the coefficient buffer of the bank, numTaps*numFilters values.
+   * @param[in]     pState        points to the state buffer, numTaps+blockSize-1 values.
+   * @param[in]     blockSize     number of samples that are processed at a time.
+   * @return ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR if <code>numTaps</code> is not a supported value.
+   */
+  arm_status arm_fir_bank_init_q15(
+  arm_fir_bank_instance_q15 * S,
+  uint16_t numFilters,
+  uint16_t numTaps,
+  const q15_t * pFilterCoeffs,
+  q15_t * pCoeffs,
+  q15_t * pState,
+  uint32_t blockSize);
+
 
   /**
    * @brief Processing function for the Q31 FIR filter.
@@ -1290,6 +1357,50 @@ extern "C"
   q15_t * pDst,
   uint32_t blockSize);
 
+  /**
+   * @brief Instance structure for the Q15 Biquad cascade filter bank.
+   */
+  typedef struct
+  {
+    uint16_t numFilters;     /**< number of filters in the bank. */
+    uint8_t numStages;       /**< number of 2nd order stages of every filter. */
+    int8_t postShift;        /**< Additional shift, in bits, applied to each output sample. */
+    q15_t *pState;           /**< Points to the state array of length 4*numStages*numFilters, interleaved by filter. */
+    q15_t *pCoeffs;          /**< Points to the coefficient array of length 6*numStages*numFilters, interleaved by filter. */
+  } arm_biquad_casd_df1_bank_inst_q15;
+
+  /**
+   * @brief Processing function for the Q15 Biquad cascade filter bank.
+   * @param[in]  S          points to an instance of the Q15 Biquad cascade filter bank structure.
+   * @param[in]  pSrc       points to the block of input data.
+   * @param[out] pDst       points to the block of output data, blockSize*numFilters values interleaved by filter.
+   * @param[in]  blockSize  number of samples to process.
+   */
+  void arm_biquad_cascade_df1_bank_q15(
+  const arm_biquad_casd_df1_bank_inst_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q15 Biquad cascade filter bank.
+   * @param[in,out] S             points to an instance of the Q15 Biquad cascade filter bank structure.
+   * @param[in]     numFilters    number of filters in the bank.
+   * @param[in]     numStages     number of 2nd order stages of every filter.
+   * @param[in]     pFilterCoeffs points to the coefficients of the filters one after another, 6*numStages each, as for arm_biquad_cascade_df1_init_q15().
+   * @param[out]    pCoeffs       points to the coefficient buffer of the bank, 6*numStages*numFilters values.
+   * @param[in]     pState        points to the state buffer, 4*numStages*numFilters values.
+   * @param[in]     postShift     Shift to be applied to the output. Varies according to the coefficients format
+   */
+  void arm_biquad_cascade_df1_bank_init_q15(
+  arm_biquad_casd_df1_bank_inst_q15 * S,
+  uint16_t numFilters,
+  uint8_t numStages,
+  const q15_t * pFilterCoeffs,
+  q15_t * pCoeffs,
+  q15_t * pState,
+  int8_t postShift);
+
 
   /**
    * @brief Processing function for the Q31 Biquad cascade filter
@@ -2385,6 +2496,266 @@ void arm_rfft_fast_f32(
   q15_t * pState,
   q15_t * pInlineBuffer);
 
+  /**
+   * @brief Instance structure for the Q15 Goertzel detector.
+   */
+  typedef struct
+  {
+    uint16_t numBins;                  /**< number of frequency bins. */
+    uint8_t shift;                     /**< output is the bin value divided by 2^shift, ceil(log2(blockSize)). */
+    uint32_t blockSize;                /**< number of samples processed per call. */
+    const q31_t *pCoeffs;              /**< points to the {2*cos, sin} pairs of the bins, 2*numBins values in 2.30 and 1.31 format. */
+  } arm_goertzel_instance_q15;
+
+  /**
+   * @brief Instance structure for the Q31 Goertzel detector.
+   */
+  typedef struct
+  {
+    uint16_t numBins;                  /**< number of frequency bins. */
+    uint8_t shift;                     /**< output is the bin value divided by 2^shift, ceil(log2(blockSize)). */
+    uint8_t inputShift;                /**< right shift of the input samples, headroom of the recursion. */
+    uint32_t blockSize;                /**< number of samples processed per call. */
+    const q31_t *pCoeffs;              /**< points to the {2*cos, sin} pairs of the bins, 2*numBins values in 2.30 and 1.31 format. */
+  } arm_goertzel_instance_q31;
+
+  /**
+   * @brief Instance structure for the floating-point Goertzel detector.
+   */
+  typedef struct
+  {
+    uint16_t numBins;                  /**< number of frequency bins. */
+    float32_t scale;                   /**< output scaling, 2^-ceil(log2(blockSize)) as in the Q formats. */
+    uint32_t blockSize;                /**< number of samples processed per call. */
+    const float32_t *pCoeffs;          /**< points to the {2*cos, sin} pairs of the bins, 2*numBins values. */
+  } arm_goertzel_instance_f32;
+
+  /**
+   * @brief  Initialization function for the Q15 Goertzel detector.
+   * @param[in,out] S          points to an instance of the Q15 Goertzel structure.
+   * @param[in]     numBins    number of frequency bins.
+   * @param[out]    pCoeffs    points to the coefficient buffer of 2*numBins values.
+   * @param[in]     pFreqs     points to the bin frequencies in Hz.
+   * @param[in]     sampleRate sample rate in Hz.
+   * @param[in]     blockSize  number of samples processed per call.
+   * @return     ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR if a frequency is not inside (0, sampleRate/2)
+   * or the recursion of a bin would overflow over <code>blockSize</code> samples.
+   */
+  arm_status arm_goertzel_init_q15(
+  arm_goertzel_instance_q15 * S,
+  uint16_t numBins,
+  q31_t * pCoeffs,
+  const uint32_t * pFreqs,
+  uint32_t sampleRate,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q31 Goertzel detector.
+   * @param[in,out] S          points to an instance of the Q31 Goertzel structure.
+   * @param[in]     numBins    number of frequency bins.
+   * @param[out]    pCoeffs    points to the coefficient buffer of 2*numBins values.
+   * @param[in]     pFreqs     points to the bin frequencies in Hz.
+   * @param[in]     sampleRate sample rate in Hz.
+   * @param[in]     blockSize  number of samples processed per call.
+   * @return     ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR if a frequency is not inside (0, sampleRate/2).
+   */
+  arm_status arm_goertzel_init_q31(
+  arm_goertzel_instance_q31 * S,
+  uint16_t numBins,
+  q31_t * pCoeffs,
+  const uint32_t * pFreqs,
+  uint32_t sampleRate,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the floating-point Goertzel detector.
+   * @param[in,out] S          points to an instance of the floating-point Goertzel structure.
+   * @param[in]     numBins    number of frequency bins.
+   * @param[out]    pCoeffs    points to the coefficient buffer of 2*numBins values.
+   * @param[in]     pFreqs     points to the bin frequencies in Hz.
+   * @param[in]     sampleRate sample rate in Hz.
+   * @param[in]     blockSize  number of samples processed per call.
+   * @return     ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR if a frequency is not inside (0, sampleRate/2).
+   */
+  arm_status arm_goertzel_init_f32(
+  arm_goertzel_instance_f32 * S,
+  uint16_t numBins,
+  float32_t * pCoeffs,
+  const uint32_t * pFreqs,
+  uint32_t sampleRate,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Q15 Goertzel detector, one bin.
+   * @param[in]  S     points to an instance of the Q15 Goertzel structure.
+   * @param[in]  bin   index of the bin.
+   * @param[in]  pSrc  points to the block of input samples.
+   * @param[out] pDst  points to the complex bin value, 2 values in 1.31 format.
+   */
+  void arm_goertzel_q15(
+  const arm_goertzel_instance_q15 * S,
+  uint16_t bin,
+  q15_t * pSrc,
+  q31_t * pDst);
+
+  /**
+   * @brief  Q15 Goertzel detector, all bins of the instance.
+   * @param[in]  S     points to an instance of the Q15 Goertzel structure.
+   * @param[in]  pSrc  points to the block of input samples.
+   * @param[out] pDst  points to the complex bin values, 2*numBins values in 1.31 format.
+   */
+  void arm_goertzel_multi_q15(
+  const arm_goertzel_instance_q15 * S,
+  q15_t * pSrc,
+  q31_t * pDst);
+
+  /**
+   * @brief  Q31 Goertzel detector, one bin.
+   * @param[in]  S     points to an instance of the Q31 Goertzel structure.
+   * @param[in]  bin   index of the bin.
+   * @param[in]  pSrc  points to the block of input samples.
+   * @param[out] pDst  points to the complex bin value, 2 values in 1.31 format.
+   */
+  void arm_goertzel_q31(
+  const arm_goertzel_instance_q31 * S,
+  uint16_t bin,
+  q31_t * pSrc,
+  q31_t * pDst);
+
+  /**
+   * @brief  Q31 Goertzel detector, all bins of the instance.
+   * @param[in]  S     points to an instance of the Q31 Goertzel structure.
+   * @param[in]  pSrc  points to the block of input samples.
+   * @param[out] pDst  points to the complex bin values, 2*numBins values in 1.31 format.
+   */
+  void arm_goertzel_multi_q31(
+  const arm_goertzel_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst);
+
+  /**
+   * @brief  Floating-point Goertzel detector, one bin.
+   * @param[in]  S     points to an instance of the floating-point Goertzel structure.
+   * @param[in]  bin   index of the bin.
+   * @param[in]  pSrc  points to the block of input samples.
+   * @param[out] pDst  points to the complex bin value, 2 values.
+   */
+  void arm_goertzel_f32(
+  const arm_goertzel_instance_f32 * S,
+  uint16_t bin,
+  float32_t * pSrc,
+  float32_t * pDst);
+
+  /**
+   * @brief  Floating-point Goertzel detector, all bins of the instance.
+   * @param[in]  S     points to an instance of the floating-point Goertzel structure.
+   * @param[in]  pSrc  points to the block of input samples.
+   * @param[out] pDst  points to the complex bin values, 2*numBins values.
+   */
+  void arm_goertzel_multi_f32(
+  const arm_goertzel_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst);
+
+  /**
+   * @brief Damping of the sliding DFT, r = 1 - 2^-16 in 1.31 format.
+   */
+#define ARM_SDFT_DAMPING_Q31    ((q31_t) 0x7FFF8000)
+
+  /**
+   * @brief Instance structure for the Q31 sliding DFT.
+   */
+  typedef struct
+  {
+    uint16_t numBins;                  /**< number of frequency bins. */
+    uint8_t shift;                     /**< right shift of the input samples, ceil(log2(length)) + 1. */
+    uint32_t length;                   /**< number of samples in the window. */
+    uint32_t pos;                      /**< index of the oldest sample in the delay line. */
+    const q31_t *pCoeffs;              /**< points to the {r*cos, r*sin} and {r^N*cos, r^N*sin} of the bins, 4*numBins values in 1.31 format. */
+    q31_t *pState;                     /**< points to the state, 2*numBins bins and the delay line of length samples. */
+  } arm_sdft_instance_q31;
+
+  /**
+   * @brief Instance structure for the floating-point sliding DFT.
+   */
+  typedef struct
+  {
+    uint16_t numBins;                  /**< number of frequency bins. */
+    float32_t scale;                   /**< output scaling, 2^-ceil(log2(length)) as in the Q31 format. */
+    uint32_t length;                   /**< number of samples in the window. */
+    uint32_t pos;                      /**< index of the oldest sample in the delay line. */
+    const float32_t *pCoeffs;          /**< points to the {r*cos, r*sin} and {r^N*cos, r^N*sin} of the bins, 4*numBins values. */
+    float32_t *pState;                 /**< points to the state, 2*numBins bins and the delay line of length samples. */
+  } arm_sdft_instance_f32;
+
+  /**
+   * @brief  Initialization function for the Q31 sliding DFT.
+   * @param[in,out] S          points to an instance of the Q31 sliding DFT structure.
+   * @param[in]     numBins    number of frequency bins.
+   * @param[out]    pCoeffs    points to the coefficient buffer of 4*numBins values.
+   * @param[in]     pFreqs     points to the bin frequencies in Hz.
+   * @param[in]     sampleRate sample rate in Hz.
+   * @param[in]     length     number of samples in the window.
+   * @param[in]     pState     points to the state buffer of 2*numBins+length values.
+   * @return     ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR if a frequency is not inside (0, sampleRate/2)
+   * or <code>length</code> is not inside [1, 2^30].
+   */
+  arm_status arm_sdft_init_q31(
+  arm_sdft_instance_q31 * S,
+  uint16_t numBins,
+  q31_t * pCoeffs,
+  const uint32_t * pFreqs,
+  uint32_t sampleRate,
+  uint32_t length,
+  q31_t * pState);
+
+  /**
+   * @brief  Initialization function for the floating-point sliding DFT.
+   * @param[in,out] S          points to an instance of the floating-point sliding DFT structure.
+   * @param[in]     numBins    number of frequency bins.
+   * @param[out]    pCoeffs    points to the coefficient buffer of 4*numBins values.
+   * @param[in]     pFreqs     points to the bin frequencies in Hz.
+   * @param[in]     sampleRate sample rate in Hz.
+   * @param[in]     length     number of samples in the window.
+   * @param[in]     pState     points to the state buffer of 2*numBins+length values.
+   * @return     ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR if a frequency is not inside (0, sampleRate/2)
+   * or <code>length</code> is not inside [1, 2^30].
+   */
+  arm_status arm_sdft_init_f32(
+  arm_sdft_instance_f32 * S,
+  uint16_t numBins,
+  float32_t * pCoeffs,
+  const uint32_t * pFreqs,
+  uint32_t sampleRate,
+  uint32_t length,
+  float32_t * pState);
+
+  /**
+   * @brief  Q31 sliding DFT, the window moves over a block of samples.
+   * @param[in,out] S          points to an instance of the Q31 sliding DFT structure.
+   * @param[in]     pSrc       points to the block of input samples.
+   * @param[out]    pDst       points to the complex bin values after the last sample, 2*numBins values in 1.31 format.
+   * @param[in]     blockSize  number of samples in the block.
+   */
+  void arm_sdft_q31(
+  arm_sdft_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Floating-point sliding DFT, the window moves over a block of samples.
+   * @param[in,out] S          points to an instance of the floating-point sliding DFT structure.
+   * @param[in]     pSrc       points to the block of input samples.
+   * @param[out]    pDst       points to the complex bin values after the last sample, 2*numBins values.
+   * @param[in]     blockSize  number of samples in the block.
+   */
+  void arm_sdft_f32(
+  arm_sdft_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
 
   /**
    * @brief Floating-point vector addition.
@@ -3425,6 +3796,57 @@ void arm_rfft_fast_f32(
   q31_t * pState,
   uint32_t blockSize);
 
+  /**
+   * @brief Instance structure for the Q15 digital down converter.
+   */
+  typedef struct
+  {
+    uint32_t phase;                    /**< phase of the oscillator, 2^32 a turn. */
+    uint32_t phaseInc;                 /**< phase step per input sample, 2^32 * centerFreq / sampleRate rounded. */
+    uint32_t blockSize;                /**< largest number of input samples per call, a multiple of M. */
+    q15_t *pScratch;                   /**< points to the scratch buffer of 2*blockSize values. */
+    arm_fir_decimate_instance_q15 re;  /**< decimator of the in-phase branch. */
+    arm_fir_decimate_instance_q15 im;  /**< decimator of the quadrature branch. */
+  } arm_ddc_instance_q15;
+
+  /**
+   * @brief  Initialization function for the Q15 digital down converter.
+   * @param[in,out] S           points to an instance of the Q15 digital down converter structure.
+   * @param[in]     numTaps     number of coefficients of the lowpass filter.
+   * @param[in]     M           decimation factor.
+   * @param[in]     pCoeffs     points to the lowpass filter coefficients.
+   * @param[in]     centerFreq  frequency in Hz that is moved to 0 Hz.
+   * @param[in]     sampleRate  input sample rate in Hz.
+   * @param[in]     pState      points to the state buffer of 2*(numTaps+blockSize-1) values.
+   * @param[in]     pScratch    points to the scratch buffer of 2*blockSize values.
+   * @param[in]     blockSize   largest number of input samples per call.
+   * @return     ARM_MATH_SUCCESS, ARM_MATH_LENGTH_ERROR if <code>blockSize</code> is not a multiple of
+   * <code>M</code> or ARM_MATH_ARGUMENT_ERROR if <code>centerFreq</code> is not inside [0, sampleRate/2).
+   */
+  arm_status arm_ddc_init_q15(
+  arm_ddc_instance_q15 * S,
+  uint16_t numTaps,
+  uint8_t M,
+  q15_t * pCoeffs,
+  uint32_t centerFreq,
+  uint32_t sampleRate,
+  q15_t * pState,
+  q15_t * pScratch,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Q15 digital down converter, a block of real samples to complex baseband at sampleRate/M.
+   * @param[in,out] S          points to an instance of the Q15 digital down converter structure.
+   * @param[in]     pSrc       points to the block of real input samples.
+   * @param[out]    pDst       points to the complex output, 2*blockSize/M values {re, im}.
+   * @param[in]     blockSize  number of input samples, a multiple of M up to the blockSize of the init.
+   */
+  void arm_ddc_q15(
+  arm_ddc_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
 
   /**
    * @brief Instance structure for the Q15 FIR interpolator.
@@ -5859,12 +6281,13 @@ void arm_rfft_fast_f32(
   uint32_t blockSize)
   {
     uint32_t i = 0u;
-    int32_t rOffset, dst_end;
+    int32_t rOffset;
+    int32_t * dst_end;
 
     /* Copy the value of Index pointer that points
      * to the current location from where the input samples to be read */
     rOffset = *readOffset;
-    dst_end = (int32_t) (dst_base + dst_length);
+    dst_end = dst_base + dst_length;
 
     /* Loop over the blockSize */
     i = blockSize;
@@ -5877,7 +6300,7 @@ void arm_rfft_fast_f32(
       /* Update the input pointer */
       dst += dstInc;
 
-      if(dst == (int32_t *) dst_end)
+      if(dst == dst_end)
       {
         dst = dst_base;
       }
@@ -5958,13 +6381,14 @@ void arm_rfft_fast_f32(
   uint32_t blockSize)
   {
     uint32_t i = 0;
-    int32_t rOffset, dst_end;
+    int32_t rOffset;
+    q15_t * dst_end;
 
     /* Copy the value of Index pointer that points
      * to the current location from where the input samples to be read */
     rOffset = *readOffset;
 
-    dst_end = (int32_t) (dst_base + dst_length);
+    dst_end = dst_base + dst_length;
 
     /* Loop over the blockSize */
     i = blockSize;
@@ -5977,7 +6401,7 @@ void arm_rfft_fast_f32(
       /* Update the input pointer */
       dst += dstInc;
 
-      if(dst == (q15_t *) dst_end)
+      if(dst == dst_end)
       {
         dst = dst_base;
       }
@@ -6058,13 +6482,14 @@ void arm_rfft_fast_f32(
   uint32_t blockSize)
   {
     uint32_t i = 0;
-    int32_t rOffset, dst_end;
+    int32_t rOffset;
+    q7_t * dst_end;
 
     /* Copy the value of Index pointer that points
      * to the current location from where the input samples to be read */
     rOffset = *readOffset;
 
-    dst_end = (int32_t) (dst_base + dst_length);
+    dst_end = dst_base + dst_length;
 
     /* Loop over the blockSize */
     i = blockSize;
@@ -6077,7 +6502,7 @@ void arm_rfft_fast_f32(
       /* Update the input pointer */
       dst += dstInc;
 
-      if(dst == (q7_t *) dst_end)
+      if(dst == dst_end)
       {
         dst = dst_base;
       }
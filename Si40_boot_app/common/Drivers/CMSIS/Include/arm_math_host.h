@@ -0,0 +1,120 @@
+/**************************************************************************//**
+ * @file     arm_math_host.h
+ * @brief    SSE4.1/AVX2 kernels of CMSIS-DSP for host builds (x86-64)
+ ******************************************************************************/
+/*
+   With ARM_MATH_HOST and ARM_MATH_HOST_SIMD the functions below are linked
+   from DSP_Lib/Source/HostFunctions: arm_host_simd.c selects the kernel by
+   the CPU on the first call (AVX2, SSE4.1 or the portable C), the portable
+   C of the library is renamed to <function>_portable by ARM_MATH_PORTABLE()
+   of arm_math.h.
+
+     arm_fir_q15()                  arm_cfft_q15()
+     arm_biquad_cascade_df1_q15()   arm_dot_prod_q31()
+     arm_fir_bank_q15()             arm_biquad_cascade_df1_bank_q15()
+
+   The kernels give the results of the portable C bit for bit, including
+   the 32 bit wrap of the dual multiply of the C __SMLALD and the
+   saturation of the q15 butterflies, tools/simdcheck.c is the differential
+   test. The environment variable ARM_MATH_HOST_SIMD=none|sse4.1|avx2 limits
+   the level, e.g. to compare runs.
+
+   Build the HostFunctions sources with the library, no -m flags are needed,
+   the kernels have target attributes.
+ */
+
+#ifndef __ARM_MATH_HOST_H
+#define __ARM_MATH_HOST_H
+
+#include "arm_math.h"
+
+#if !defined (ARM_MATH_HOST) || !defined (ARM_MATH_HOST_SIMD)
+  #error "arm_math_host.h needs ARM_MATH_HOST and ARM_MATH_HOST_SIMD"
+#endif
+
+#ifdef   __cplusplus
+extern "C"
+{
+#endif
+
+  /**
+   * @brief Kernel level of the host functions.
+   */
+  typedef enum
+  {
+    ARM_HOST_SIMD_NONE  = 0,        /**< portable C, as the Cortex-M3 build */
+    ARM_HOST_SIMD_SSE41 = 1,        /**< SSE4.1, 128 bit */
+    ARM_HOST_SIMD_AVX2  = 2         /**< AVX2, 256 bit */
+  } arm_host_simd_t;
+
+  /**
+   * @brief  Best kernel level of the CPU.
+   * @return level
+   */
+  arm_host_simd_t arm_host_simd_detect(void);
+
+  /**
+   * @brief  Kernel level in use, detected on the first call and limited by
+   *         the environment variable ARM_MATH_HOST_SIMD.
+   * @return level
+   */
+  arm_host_simd_t arm_host_simd_get(void);
+
+  /**
+   * @brief  Sets the kernel level, not above the level of the CPU.
+   * @param[in]  level  wanted level
+   * @return level in use
+   */
+  arm_host_simd_t arm_host_simd_set(arm_host_simd_t level);
+
+  /**
+   * @brief  Name of a kernel level, "none", "sse4.1" or "avx2".
+   * @param[in]  level  level
+   * @return name
+   */
+  const char *arm_host_simd_name(arm_host_simd_t level);
+
+  /*
+   * Portable C of the library, the reference of the kernels.
+   */
+  void arm_fir_q15_portable(
+  const arm_fir_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+  void arm_cfft_q15_portable(
+  const arm_cfft_instance_q15 * S,
+  q15_t * p1,
+  uint8_t ifftFlag,
+  uint8_t bitReverseFlag);
+
+  void arm_biquad_cascade_df1_q15_portable(
+  const arm_biquad_casd_df1_inst_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+  void arm_dot_prod_q31_portable(
+  q31_t * pSrcA,
+  q31_t * pSrcB,
+  uint32_t blockSize,
+  q63_t * result);
+
+  void arm_fir_bank_q15_portable(
+  const arm_fir_bank_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+  void arm_biquad_cascade_df1_bank_q15_portable(
+  const arm_biquad_casd_df1_bank_inst_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+#ifdef   __cplusplus
+}
+#endif
+
+#endif /* __ARM_MATH_HOST_H */
@@ -0,0 +1,145 @@
+/**************************************************************************//**
+ * @file     cmsis_host.h
+ * @brief    CMSIS core instructions for host builds of CMSIS-DSP (x86-64)
+ ******************************************************************************/
+/*
+   Selected by ARM_MATH_HOST in arm_math.h, instead of core_cmX.h. The library
+   is then built as for Cortex-M3 (ARM_MATH_CM3 is defined): the packed SIMD
+   instructions (__SMLAD, __QADD16, __PKHBT, ...) are the C functions of
+   arm_math.h the firmware uses too, only the instructions Cortex-M3 has in
+   hardware are given here in portable C, with the results of the instruction.
+   So q7/q15/q31 results of the host are bit-exact to the firmware.
+
+   Build with gcc or clang:
+     -DARM_MATH_HOST -fno-strict-aliasing -fwrapv
+   __SIMD32 reads q15/q7 arrays as int32_t, and the library relies on
+   two's complement wrap of int32_t like the Cortex-M core.
+ */
+
+#ifndef __CMSIS_HOST_H
+#define __CMSIS_HOST_H
+
+#include <stdint.h>
+
+#if !defined ( __GNUC__ )
+  #error "ARM_MATH_HOST is made for gcc and clang"
+#endif
+
+#ifndef __ASM
+  #define __ASM            __asm__
+#endif
+#ifndef __INLINE
+  #define __INLINE         inline
+#endif
+#ifndef __STATIC_INLINE
+  #define __STATIC_INLINE  static inline
+#endif
+
+/* no FPU instructions, sqrtf() of math.h is used */
+#define __FPU_PRESENT      0U
+#define __FPU_USED         0U
+
+
+/* ##########################  Core Instruction Access  ######################### */
+/** \defgroup CMSIS_Host_InstructionInterface CMSIS Host Instruction Interface
+  Portable C of the Cortex-M3 instructions used by CMSIS-DSP
+  @{
+ */
+
+/**
+  \brief   Signed Saturate
+  \details Saturates a signed value, like SSAT.
+  \param [in]  value  Value to be saturated
+  \param [in]    sat  Bit position to saturate to (1..32)
+  \return             Saturated value
+ */
+__attribute__((always_inline)) __STATIC_INLINE int32_t __SSAT(int32_t value, uint32_t sat)
+{
+  if((sat >= 1U) && (sat <= 32U))
+  {
+    const int32_t max = (int32_t)((1ULL << (sat - 1U)) - 1ULL);
+    const int32_t min = -1 - max;
+
+    if(value > max)
+    {
+      return max;
+    }
+    else if(value < min)
+    {
+      return min;
+    }
+  }
+  return value;
+}
+
+
+/**
+  \brief   Unsigned Saturate
+  \details Saturates a signed value to unsigned range, like USAT.
+  \param [in]  value  Value to be saturated
+  \param [in]    sat  Bit position to saturate to (0..31)
+  \return             Saturated value
+ */
+__attribute__((always_inline)) __STATIC_INLINE uint32_t __USAT(int32_t value, uint32_t sat)
+{
+  if(sat <= 31U)
+  {
+    const uint32_t max = ((1U << sat) - 1U);
+
+    if(value > (int32_t)max)
+    {
+      return max;
+    }
+    else if(value < 0)
+    {
+      return 0U;
+    }
+  }
+  return (uint32_t)value;
+}
+
+
+/**
+  \brief   Count leading zeros
+  \details Counts the number of leading zeros of a data value, 32 for 0 like CLZ.
+  \param [in]  value  Value to count the leading zeros
+  \return             number of leading zeros in value
+ */
+__attribute__((always_inline)) __STATIC_INLINE uint8_t __CLZ(uint32_t value)
+{
+  if(value == 0U)
+  {
+    return 32U;
+  }
+  return (uint8_t)__builtin_clz(value);
+}
+
+
+/**
+  \brief   Rotate Right in unsigned value (32 bit)
+  \details Rotate Right (immediate) provides the value of the contents of a register rotated by a variable number of bits.
+  \param [in]    op1  Value to rotate
+  \param [in]    op2  Number of Bits to rotate
+  \return               Rotated value
+ */
+__attribute__((always_inline)) __STATIC_INLINE uint32_t __ROR(uint32_t op1, uint32_t op2)
+{
+  op2 &= 31U;
+  if(op2 == 0U)
+  {
+    return op1;
+  }
+  return (op1 >> op2) | (op1 << (32U - op2));
+}
+
+
+/**
+  \brief   No Operation
+ */
+__attribute__((always_inline)) __STATIC_INLINE void __NOP(void)
+{
+}
+
+/*@}*/ /* end of group CMSIS_Host_InstructionInterface */
+
+#endif /* __CMSIS_HOST_H */
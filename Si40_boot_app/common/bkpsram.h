@@ -0,0 +1,41 @@
+/**
+  ******************************************************************************
+  * @file    bkpsram.h
+  * @author  AKabanov
+  * @brief   layout of backup SRAM shared by bootloader and application
+  ******************************************************************************
+  * Backup SRAM (4 KB at BKPSRAM_BASE) is kept through standby by the backup
+  * regulator (HAL_PWREx_EnableBkUpReg). Every area starts with its own magic
+  * word so bootloader and application can check it before use.
+  ******************************************************************************
+  */
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __BKPSRAM_H
+#define __BKPSRAM_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f2xx_hal.h"
+
+/* Exported types ------------------------------------------------------------*/
+/* Exported constants --------------------------------------------------------*/
+#define BKPSRAM_SIZE            0x1000UL
+#define BKPSRAM_TRACE_ADDR      (BKPSRAM_BASE + 0x000UL)  /* trace ring, 0x400 bytes */
+#define BKPSRAM_EVLOG_ADDR      (BKPSRAM_BASE + 0x400UL)  /* event log ring, 0x400 bytes */
+#define BKPSRAM_WDG_ADDR        (BKPSRAM_BASE + 0x800UL)  /* watchdog record, 16 bytes */
+
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions ------------------------------------------------------- */
+/**
+  * @brief  enable write access to backup SRAM
+  *         (PWR clock, backup domain access, BKPSRAM clock)
+  * @param  None
+  * @retval None
+  */
+__STATIC_INLINE void bkpsramEnable(void)
+{
+  __HAL_RCC_PWR_CLK_ENABLE();
+  HAL_PWR_EnableBkUpAccess();
+  __HAL_RCC_BKPSRAM_CLK_ENABLE();
+}
+
+#endif /* __BKPSRAM_H */
@@ -0,0 +1,159 @@
+/**
+  ******************************************************************************
+  * @file    evlog.c
+  * @author  AKabanov
+  * @brief   event log of the wakes in backup SRAM ring
+  ******************************************************************************
+  * The application adds one entry per ping, and one per wake of a sleep
+  * chain that starts after a reset, nothing is written to flash.
+  * Every entry has its own CRC, so an entry broken by reset during the
+  * write is found by the host (tools/evlogdec.c), the others stay valid.
+  * The bootloader sends the ring in binary ('e' command):
+  *   sync EVLOG_SYNC, count (16 bit), count entries, all LSB first
+  ******************************************************************************
+  */
+/* Includes ------------------------------------------------------------------*/
+#include "evlog.h"
+#include "bkpsram.h"
+#include "wdg.h"
+
+/** @addtogroup EVLOG
+  * @{
+  */
+
+/* Private typedef -----------------------------------------------------------*/
+typedef struct
+{
+  uint32_t magic;
+  uint16_t head;                      // next entry to write
+  uint16_t count;                     // number of valid entries
+  uint16_t seq;                       // number of the next wake
+  uint16_t reserved;
+  uint32_t reserved2;
+  evlogEntry_t entry[EVLOG_SIZE];
+} evlogRing_t;
+/* Private define ------------------------------------------------------------*/
+#define EVLOG_MAGIC     0x45564C31UL  // "EVL1"
+#define CRC8_POLY       0x07
+/* Private macro -------------------------------------------------------------*/
+#define EVLOG_RING      ((evlogRing_t*)BKPSRAM_EVLOG_ADDR)
+/* Private variables ---------------------------------------------------------*/
+/* reset flags of this start, go to the first entry only */
+static uint8_t evlogReset;
+/* Private function prototypes -----------------------------------------------*/
+static uint8_t evlogCrc(const uint8_t* data, uint32_t length);
+/* Public functions ----------------------------------------------------------*/
+
+/**
+  * @brief  enable backup SRAM, clear the ring if it is not valid,
+  *         take and clear the reset flags for the next entry
+  * @param  None
+  * @retval None
+  */
+void evlogInit(void)
+{
+  evlogRing_t* ring = EVLOG_RING;
+
+  bkpsramEnable();
+  if((ring->magic != EVLOG_MAGIC)||(ring->head >= EVLOG_SIZE)||(ring->count > EVLOG_SIZE))
+  {
+    ring->head = 0;
+    ring->count = 0;
+    ring->seq = 0;
+    ring->magic = EVLOG_MAGIC;
+  }
+  evlogReset = wdgTakeReset();      // flags are taken by bootloader wdgBoot()
+}
+
+/**
+  * @brief  add an entry of the wake to the ring
+  * @param  state - EVLOG_STATE_x
+  *         burst - burst length, ms
+  *         phase - ping schedule phase
+  * @retval None
+  */
+void evlogAdd(uint8_t state, uint16_t burst, uint8_t phase)
+{
+  evlogRing_t* ring = EVLOG_RING;
+  evlogEntry_t entry;
+
+  entry.seq = ring->seq++;
+  entry.burst = burst;
+  entry.state = state;
+  entry.reset = evlogReset;
+  entry.phase = phase;
+  entry.crc = evlogCrc((const uint8_t*)&entry, sizeof(entry) - 1);
+  ring->entry[ring->head] = entry;
+  if(++ring->head >= EVLOG_SIZE)ring->head = 0;
+  if(ring->count < EVLOG_SIZE)ring->count++;
+  evlogReset = 0;
+}
+
+/**
+  * @brief  wake without ping (sleep chain), an entry only if this start
+  *         has reset flags, so a reset between pings is not lost
+  * @param  phase - ping schedule phase
+  * @retval None
+  */
+void evlogWake(uint8_t phase)
+{
+  if(evlogReset != 0)evlogAdd(EVLOG_STATE_NO_PING, 0, phase);
+}
+
+/**
+  * @brief  number of entries stored in the ring
+  * @param  None
+  * @retval number of entries from 0 to EVLOG_SIZE
+  */
+uint32_t evlogCount(void)
+{
+  evlogRing_t* ring = EVLOG_RING;
+
+  if((ring->magic != EVLOG_MAGIC)||(ring->count > EVLOG_SIZE))return 0;
+  return ring->count;
+}
+
+/**
+  * @brief  read an entry from the ring, oldest first
+  * @param  index from 0 to evlogCount() - 1
+  *         entry - pointer to entry to fill
+  * @retval 0 - success
+  *         -1 - no entry with this index
+  */
+int evlogGet(uint32_t index, evlogEntry_t* entry)
+{
+  evlogRing_t* ring = EVLOG_RING;
+  uint32_t count = evlogCount();
+
+  if(index >= count)return -1;
+  index = (ring->head + EVLOG_SIZE - count + index) % EVLOG_SIZE;
+  *entry = ring->entry[index];
+  return 0;
+}
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  CRC-8, polynomial x^8 + x^2 + x + 1, initial value 0
+  * @param  data - bytes to protect
+  *         length - number of bytes
+  * @retval CRC
+  */
+static uint8_t evlogCrc(const uint8_t* data, uint32_t length)
+{
+  uint8_t crc = 0;
+
+  while(length-- > 0)
+  {
+    crc ^= *data++;
+    for(int i = 0; i < 8; i++)
+    {
+      crc = (crc & 0x80) ? (uint8_t)((crc << 1) ^ CRC8_POLY) : (uint8_t)(crc << 1);
+    }
+  }
+  return crc;
+}
+
+/**
+  * @}
+  */
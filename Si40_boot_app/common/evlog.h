@@ -0,0 +1,75 @@
+/**
+  ******************************************************************************
+  * @file    evlog.h
+  * @author  AKabanov
+  * @brief   Header for evlog.c module
+  ******************************************************************************
+  ******************************************************************************
+  */
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __EVLOG_H
+#define __EVLOG_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f2xx_hal.h"
+
+/* Exported types ------------------------------------------------------------*/
+/* one wake, 8 bytes, the order of the fields is the order on the wire */
+typedef struct
+{
+  uint16_t seq;          // wake number
+  uint16_t burst;        // burst length, ms
+  uint8_t state;         // EVLOG_STATE_x
+  uint8_t reset;         // RCC_CSR reset flags (bits 31 - 24), 0 - wake from sleep
+  uint8_t phase;         // ping schedule phase after the ping
+  uint8_t crc;           // CRC-8 of the bytes above
+} evlogEntry_t;
+
+/* Exported constants --------------------------------------------------------*/
+#define EVLOG_SIZE           126          // entries, ring fills 0x400 bytes
+#define EVLOG_STATE_SENS     0x01         // sensor full
+#define EVLOG_STATE_MODE_Pos 1            // mode 0 - 3, 2 bits
+#define EVLOG_STATE_MODE     (0x03 << EVLOG_STATE_MODE_Pos)
+#define EVLOG_STATE_NO_PING  0x08         // wake of a sleep chain, no ping
+#define EVLOG_SYNC           0xA55A       // first bytes of the dump, LSB first
+
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions ------------------------------------------------------- */
+/**
+  * @brief  enable backup SRAM, clear the ring if it is not valid,
+  *         take and clear the reset flags for the next entry
+  * @param  None
+  * @retval None
+  */
+void evlogInit(void);
+/**
+  * @brief  add an entry of the wake to the ring
+  * @param  state - EVLOG_STATE_x
+  *         burst - burst length, ms
+  *         phase - ping schedule phase
+  * @retval None
+  */
+void evlogAdd(uint8_t state, uint16_t burst, uint8_t phase);
+/**
+  * @brief  wake without ping (sleep chain), an entry only if this start
+  *         has reset flags, so a reset between pings is not lost
+  * @param  phase - ping schedule phase
+  * @retval None
+  */
+void evlogWake(uint8_t phase);
+/**
+  * @brief  number of entries stored in the ring
+  * @param  None
+  * @retval number of entries from 0 to EVLOG_SIZE
+  */
+uint32_t evlogCount(void);
+/**
+  * @brief  read an entry from the ring, oldest first
+  * @param  index from 0 to evlogCount() - 1
+  *         entry - pointer to entry to fill
+  * @retval 0 - success
+  *         -1 - no entry with this index
+  */
+int evlogGet(uint32_t index, evlogEntry_t* entry);
+
+#endif /* __EVLOG_H */
@@ -0,0 +1,71 @@
+/**
+  ******************************************************************************
+  * @file    freqplan.h
+  * @author  AKabanov
+  * @brief   frequency plan of the channels, the only place where the
+  *          frequencies are written
+  ******************************************************************************
+  * FREQ_PLAN(X) calls X(channel, Hz) for every channel. Users make their
+  * tables from it by compile time macros:
+  *   application tim1.c    PWMPeriods[], ARR of TIM1
+  *   bootloader eeprom.c   frequency strings and frequency of the timer
+  *   tools/freqplan.c      table of periods and errors
+  *   tools/tonedetect.c    Goertzel bins of arm_goertzel_init_*()
+  *   tools/pingmon.c       sliding DFT bins of arm_sdft_init_*()
+  *   tools/pingtoa.c       correlation templates of the ping bursts
+  *   tools/ddc.c           center and band of the down converter
+  * The counter runs at FREQ_CNT_CLK = TIM1CLK/(FREQ_PSC + 1), tim1Init()
+  * programs FREQ_PSC and the burst lengths divide by it, the period is
+  * rounded to whole counts, so the error is up to half of the step
+  * (about 8 Hz at 45 kHz). Build stops if the error of a channel is above
+  * FREQ_MAX_ERROR_MHZ. FREQ_PERIOD_FRAC() is the period with
+  * FREQ_FRAC_BITS of fraction for dithering between ARR and ARR + 1, its
+  * error is FREQ_DITHER_ERROR_MHZ().
+  ******************************************************************************
+  */
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __FREQPLAN_H
+#define __FREQPLAN_H
+
+/* Exported constants --------------------------------------------------------*/
+#define FREQ_TIM_CLK        120000000ULL   // TIM1CLK with PLL profile
+#define FREQ_PSC            0              // TIM1 prescaler, for ARR above 0xFFFF
+#define FREQ_CNT_CLK        (FREQ_TIM_CLK/(FREQ_PSC + 1))
+#define FREQ_FRAC_BITS      5              // fraction of the dithered period,
+                                           // pattern of 2^5 periods in tim1.c
+#define FREQ_MAX_ERROR_MHZ  10000          // 10 Hz
+#define FREQ_CHANNELS       35
+
+/* channels 1 - 30 PI-C, 200 Hz step, 31 - 35 Marport */
+#define FREQ_PLAN(X) \
+  X( 1, 43600) X( 2, 43800) X( 3, 44000) X( 4, 44200) X( 5, 44400) \
+  X( 6, 44600) X( 7, 44800) X( 8, 45000) X( 9, 45200) X(10, 45400) \
+  X(11, 45600) X(12, 45800) X(13, 46000) X(14, 46200) X(15, 46400) \
+  X(16, 46600) X(17, 46800) X(18, 47000) X(19, 47200) X(20, 47400) \
+  X(21, 47600) X(22, 47800) X(23, 48000) X(24, 48200) X(25, 48400) \
+  X(26, 48600) X(27, 48800) X(28, 49000) X(29, 49200) X(30, 49400) \
+  X(31, 43200) X(32, 43100) X(33, 43000) X(34, 43300) X(35, 43400)
+
+/* Exported macro ------------------------------------------------------------*/
+/* period in counts, rounded, and ARR */
+#define FREQ_PERIOD(hz)     ((FREQ_CNT_CLK + (hz)/2)/(hz))
+#define FREQ_ARR(hz)        (FREQ_PERIOD(hz) - 1)
+/* frequency of the timer in mHz for a period in counts */
+#define FREQ_ACTUAL_MHZ(period) ((FREQ_CNT_CLK*1000ULL + (period)/2)/(period))
+/* error of the integer period, mHz */
+#define FREQ_ERROR_MHZ(hz)  ((long long)FREQ_ACTUAL_MHZ(FREQ_PERIOD(hz)) - (hz)*1000LL)
+/* period in 1/2^FREQ_FRAC_BITS counts and its error */
+#define FREQ_PERIOD_FRAC(hz) (((FREQ_CNT_CLK << FREQ_FRAC_BITS) + (hz)/2)/(hz))
+#define FREQ_DITHER_ERROR_MHZ(hz) \
+  ((long long)(((FREQ_CNT_CLK*1000ULL << FREQ_FRAC_BITS) + FREQ_PERIOD_FRAC(hz)/2) \
+               /FREQ_PERIOD_FRAC(hz)) - (hz)*1000LL)
+/* display string, like "43600Hz" */
+#define FREQ_STRING(hz)     #hz "Hz"
+
+/* build time check of the plan */
+#define FREQ_ABS(x)         (((x) < 0) ? -(x) : (x))
+#define FREQ_CHECK(ch, hz)  typedef char freqPlanCheck##ch \
+  [((FREQ_ABS(FREQ_ERROR_MHZ(hz)) <= FREQ_MAX_ERROR_MHZ)&&(FREQ_ARR(hz) <= 0xFFFF)) ? 1 : -1];
+FREQ_PLAN(FREQ_CHECK)
+
+#endif /* __FREQPLAN_H */
@@ -0,0 +1,140 @@
+/**
+  ******************************************************************************
+  * @file    sched.c
+  * @author  AKabanov
+  * @brief   ping schedule interpreter, O(1) work per wake
+  ******************************************************************************
+  ******************************************************************************
+  */
+/* Includes ------------------------------------------------------------------*/
+#include "sched.h"
+
+/** @addtogroup SCHED
+  * @{
+  */
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+#define POS_VALID           0x80000000UL
+/* Private macro -------------------------------------------------------------*/
+#define SEC(x)              ((uint32_t)((x)*SCHED_TICKS))
+#define POS(phase, done, mode, sens) \
+  (POS_VALID | ((uint32_t)(sens) << 19) | ((uint32_t)(mode) << 16) | \
+   ((uint32_t)(done) << 8) | (uint32_t)(phase))
+#define POS_PHASE(pos)      SCHED_POS_PHASE(pos)
+#define POS_DONE(pos)       (((pos) >> 8) & 0xFF)
+#define POS_MODE(pos)       (((pos) >> 16) & 0x07)
+#define POS_SENS(pos)       (((pos) >> 19) & 0x01)
+/* Private variables ---------------------------------------------------------*/
+/* Public variables ----------------------------------------------------------*/
+/* intervals of application 2.8 build 82, 70 ticks are the wake up duration */
+const sched_t schedDefault =
+{
+  SCHED_MAGIC,
+  {{0, 1}, {2, 3}, {4, 5}, {6, 7}},
+  {
+    SCHED_PHASE(SEC(5) + 330, 0),  SCHED_PHASE(SEC(5) - 70, 0),    // FAST
+    SCHED_PHASE(SEC(34) - 70, 0),  SCHED_PHASE(SEC(32) - 70, 0),   // NORMAL
+    SCHED_PHASE(SEC(126) - 70, 0), SCHED_PHASE(SEC(123) - 70, 0),  // SLOW
+    SCHED_PHASE(SEC(30) - 70, 0),  SCHED_PHASE(SEC(20) - 70, 0),   // Marport
+  },
+  0                      // not checked, built in
+};
+/* Private function prototypes -----------------------------------------------*/
+/* Public functions ----------------------------------------------------------*/
+
+/**
+  * @brief  checksum of the table, to fill sched->check
+  * @param  sched - table
+  * @retval sum of all words before check
+  */
+uint32_t schedSum(const sched_t* sched)
+{
+  const uint32_t* word = (const uint32_t*)sched;
+  uint32_t sum = 0;
+
+  for(uint32_t i = 0; i < SCHED_WORDS - 1; i++)sum += word[i];
+  return sum;
+}
+
+/**
+  * @brief  check magic, checksum and that every program ends with a phase
+  *         repeated forever inside the table
+  * @param  sched - table to check
+  * @retval 0 - valid
+  *         -1 - not valid
+  */
+int schedCheck(const sched_t* sched)
+{
+  if(sched->magic != SCHED_MAGIC)return -1;
+  if((sched != &schedDefault)&&(schedSum(sched) != sched->check))return -1;
+  for(uint32_t mode = 0; mode < SCHED_MODES; mode++)
+  {
+    for(uint32_t sens = 0; sens < SCHED_STATES; sens++)
+    {
+      uint32_t phase = sched->first[mode][sens];
+      for(;;)
+      {
+        if(phase >= SCHED_PHASES)return -1;
+        if(SCHED_INTERVAL(sched->phase[phase]) == 0)return -1;
+        if(SCHED_COUNT(sched->phase[phase]) == 0)break;
+        phase++;
+      }
+    }
+  }
+  return 0;
+}
+
+/**
+  * @brief  called on every wake, takes the next part of the interval
+  * @param  state - program position
+  * @retval 0 - ping now
+  *         ticks to sleep, from 1 to SCHED_MAX_SLEEP
+  */
+uint32_t schedWake(schedState_t* state)
+{
+  uint32_t sleep = state->remaining;
+
+  if(sleep > SCHED_MAX_SLEEP)sleep = SCHED_MAX_SLEEP;
+  state->remaining -= sleep;
+  return sleep;
+}
+
+/**
+  * @brief  called after the ping, moves the program and starts the interval
+  *         to the next ping
+  * @param  sched - valid table
+  *         state - program position
+  *         mode - from 0 to SCHED_MODES - 1
+  *         sensState - from 0 to SCHED_STATES - 1
+  * @retval ticks to sleep, from 1 to SCHED_MAX_SLEEP
+  */
+uint32_t schedPing(const sched_t* sched, schedState_t* state, uint32_t mode, uint32_t sensState)
+{
+  uint32_t pos = state->position;
+  uint32_t phase = POS_PHASE(pos);
+  uint32_t done = POS_DONE(pos);
+  uint32_t word, count;
+
+  /* new program after power on, mode or sensor change, or new table */
+  if(((pos & POS_VALID) == 0)||(POS_MODE(pos) != mode)||(POS_SENS(pos) != sensState)||
+     (phase >= SCHED_PHASES)||(SCHED_INTERVAL(sched->phase[phase]) == 0))
+  {
+    phase = sched->first[mode][sensState];
+    done = 0;
+  }
+  word = sched->phase[phase];
+  count = SCHED_COUNT(word);
+  if((count != 0)&&(++done >= count))
+  {
+    phase++;
+    done = 0;
+  }
+  state->position = POS(phase, done, mode, sensState);
+  state->remaining = SCHED_INTERVAL(word);
+  return schedWake(state);
+}
+
+/**
+  * @}
+  */
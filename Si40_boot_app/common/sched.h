@@ -0,0 +1,95 @@
+/**
+  ******************************************************************************
+  * @file    sched.h
+  * @author  AKabanov
+  * @brief   Header for sched.c module
+  ******************************************************************************
+  * Ping schedule is a table of phases for every mode and sensor state.
+  * Phase word: bits 0-23 interval to the next ping in RTC wakeup ticks,
+  *             bits 24-31 number of pings in the phase, 0 - repeat forever.
+  * A program starts at first[mode][sensState] and runs phase by phase till
+  * the phase repeated forever. Change of mode or sensor state restarts the
+  * program, so "fast pings after a change, then slower" is a table entry.
+  * The table is compiled on host from text by tools/schedc and is stored in
+  * EEPROM after device parameters (bootloader 's' command).
+  * The module doesn't use HAL, it is built on host by tools/schedc too.
+  ******************************************************************************
+  */
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __SCHED_H
+#define __SCHED_H
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+
+/* Exported constants --------------------------------------------------------*/
+#define SCHED_MODES         4             // FAST, NORMAL, SLOW, Marport
+#define SCHED_STATES        2             // sensor empty, full
+#define SCHED_PHASES        16
+#define SCHED_MAGIC         0x53434831UL  // "SCH1"
+#define SCHED_TICKS         2048UL        // RTC wakeup ticks per second, LSE/16
+#define SCHED_MAX_SLEEP     (20UL*SCHED_TICKS) // IWDG runs in sleep, below
+                                          // WDG_TIMEOUT_MIN_S, 16 bit RTC counter
+#define SCHED_MAX_INTERVAL  0xFFFFFFUL
+#define SCHED_WORDS         (sizeof(sched_t)/sizeof(uint32_t))
+
+/* Exported types ------------------------------------------------------------*/
+typedef struct
+{
+  uint32_t magic;
+  uint8_t first[SCHED_MODES][SCHED_STATES];  // first phase of the program
+  uint32_t phase[SCHED_PHASES];
+  uint32_t check;                            // sum of all words before
+} sched_t;
+
+/* position of the running program, kept through standby in RTC backup registers */
+typedef struct
+{
+  uint32_t remaining;    // ticks left to the next ping
+  uint32_t position;     // phase, pings done in phase, mode and sensor state
+} schedState_t;
+
+/* Exported macro ------------------------------------------------------------*/
+#define SCHED_PHASE(interval, count)  (((uint32_t)(count) << 24) | ((interval) & SCHED_MAX_INTERVAL))
+#define SCHED_INTERVAL(phase)         ((phase) & SCHED_MAX_INTERVAL)
+#define SCHED_COUNT(phase)            ((phase) >> 24)
+/* phase number of the program position */
+#define SCHED_POS_PHASE(pos)          ((pos) & 0xFF)
+
+/* Exported variables --------------------------------------------------------*/
+extern const sched_t schedDefault;
+
+/* Exported functions ------------------------------------------------------- */
+/**
+  * @brief  check magic, checksum and that every program ends with a phase
+  *         repeated forever inside the table
+  * @param  sched - table to check
+  * @retval 0 - valid
+  *         -1 - not valid
+  */
+int schedCheck(const sched_t* sched);
+/**
+  * @brief  checksum of the table, to fill sched->check
+  * @param  sched - table
+  * @retval sum of all words before check
+  */
+uint32_t schedSum(const sched_t* sched);
+/**
+  * @brief  called on every wake, takes the next part of the interval
+  * @param  state - program position
+  * @retval 0 - ping now
+  *         ticks to sleep, from 1 to SCHED_MAX_SLEEP
+  */
+uint32_t schedWake(schedState_t* state);
+/**
+  * @brief  called after the ping, moves the program and starts the interval
+  *         to the next ping
+  * @param  sched - valid table
+  *         state - program position
+  *         mode - from 0 to SCHED_MODES - 1
+  *         sensState - from 0 to SCHED_STATES - 1
+  * @retval ticks to sleep, from 1 to SCHED_MAX_SLEEP
+  */
+uint32_t schedPing(const sched_t* sched, schedState_t* state, uint32_t mode, uint32_t sensState);
+
+#endif /* __SCHED_H */
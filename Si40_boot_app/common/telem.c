@@ -0,0 +1,84 @@
+/**
+  ******************************************************************************
+  * @file    telem.c
+  * @author  AKabanov
+  * @brief   telemetry data word of the ping, pack, unpack and CRC
+  ******************************************************************************
+  ******************************************************************************
+  */
+/* Includes ------------------------------------------------------------------*/
+#include "telem.h"
+
+/** @addtogroup TELEM
+  * @{
+  */
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+#define CRC_BITS        5
+#define CRC_POLY        0x05          // x^5 + x^2 + 1
+#define CRC_INIT        0x1F
+#define ID_MAX          0x3FFF
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+/* Private function prototypes -----------------------------------------------*/
+static uint32_t telemCrc(uint32_t data, uint32_t bits);
+/* Public functions ----------------------------------------------------------*/
+
+/**
+  * @brief  make data word of the frame
+  * @param  id - device ID from 0 to 9999
+  *         battery - from 0 to 15
+  *         sensState - 0 empty, 1 full
+  * @retval data word, 24 bits
+  */
+uint32_t telemPack(uint32_t id, uint32_t battery, uint32_t sensState)
+{
+  uint32_t data = ((id & ID_MAX) << 5) | ((battery & 0x0F) << 1) | (sensState & 0x01);
+
+  return (data << CRC_BITS) | telemCrc(data, TELEM_BITS - CRC_BITS);
+}
+
+/**
+  * @brief  check CRC and take fields out of the data word
+  * @param  data - 24 bits
+  *         id, battery, sensState - fields
+  * @retval 0 - CRC is correct
+  *         -1 - CRC error
+  */
+int telemUnpack(uint32_t data, uint32_t* id, uint32_t* battery, uint32_t* sensState)
+{
+  uint32_t payload = data >> CRC_BITS;
+
+  if(telemCrc(payload, TELEM_BITS - CRC_BITS) != (data & ((1 << CRC_BITS) - 1)))return -1;
+  *id = payload >> 5;
+  *battery = (payload >> 1) & 0x0F;
+  *sensState = payload & 0x01;
+  return 0;
+}
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  CRC-5, MSB first
+  * @param  data - bits to protect
+  *         bits - number of bits
+  * @retval CRC, 5 bits
+  */
+static uint32_t telemCrc(uint32_t data, uint32_t bits)
+{
+  uint32_t crc = CRC_INIT;
+
+  while(bits-- > 0)
+  {
+    uint32_t in = (data >> bits) & 0x01;
+    uint32_t top = (crc >> (CRC_BITS - 1)) & 0x01;
+    crc = (crc << 1) & ((1 << CRC_BITS) - 1);
+    if(in ^ top)crc ^= CRC_POLY;
+  }
+  return crc;
+}
+
+/**
+  * @}
+  */
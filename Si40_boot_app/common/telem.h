@@ -0,0 +1,58 @@
+/**
+  ******************************************************************************
+  * @file    telem.h
+  * @author  AKabanov
+  * @brief   Header for telem.c module
+  ******************************************************************************
+  * Telemetry frame inside the tone burst, pulse position modulation:
+  *   preamble   TELEM_PREAMBLE_PERIODS of tone
+  *   symbols    TELEM_SYMBOLS of TELEM_SLOTS slots, TELEM_SLOT_PERIODS each,
+  *              tone is off in one slot, its number is 2 bits of data
+  *   tail       tone till the end of the burst
+  * Data word, 24 bits MSB first: device ID 14, battery 4, sensor 1, CRC-5.
+  * Time is counted in periods of the channel, so the frame doesn't depend
+  * on the frequency. The module doesn't use HAL, the host decoder
+  * tools/telemdec uses it too.
+  ******************************************************************************
+  */
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __TELEM_H
+#define __TELEM_H
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+
+/* Exported types ------------------------------------------------------------*/
+/* Exported constants --------------------------------------------------------*/
+/* #define TELEM_ENABLE */                 //uncomment to send telemetry in the burst
+#define TELEM_BITS              24
+#define TELEM_SLOTS             4            // 2 bits per symbol
+#define TELEM_SYMBOLS           (TELEM_BITS/2)
+#define TELEM_SLOT_PERIODS      16
+#define TELEM_SYMBOL_PERIODS    (TELEM_SLOTS*TELEM_SLOT_PERIODS)
+#define TELEM_PREAMBLE_PERIODS  256
+#define TELEM_FRAME_PERIODS     (TELEM_PREAMBLE_PERIODS + TELEM_SYMBOLS*TELEM_SYMBOL_PERIODS)
+
+/* Exported macro ------------------------------------------------------------*/
+/* slot without tone in the symbol, from 0 to TELEM_SLOTS - 1 */
+#define TELEM_GAP(data, symbol) (((data) >> (TELEM_BITS - 2 - 2*(symbol))) & 0x03)
+
+/* Exported functions ------------------------------------------------------- */
+/**
+  * @brief  make data word of the frame
+  * @param  id - device ID from 0 to 9999
+  *         battery - from 0 to 15
+  *         sensState - 0 empty, 1 full
+  * @retval data word, 24 bits
+  */
+uint32_t telemPack(uint32_t id, uint32_t battery, uint32_t sensState);
+/**
+  * @brief  check CRC and take fields out of the data word
+  * @param  data - 24 bits
+  *         id, battery, sensState - fields
+  * @retval 0 - CRC is correct
+  *         -1 - CRC error
+  */
+int telemUnpack(uint32_t data, uint32_t* id, uint32_t* battery, uint32_t* sensState);
+
+#endif /* __TELEM_H */
@@ -0,0 +1,143 @@
+/**
+  ******************************************************************************
+  * @file    trace.c
+  * @author  AKabanov
+  * @brief   boot and wake timeline, checkpoints are stamped with DWT->CYCCNT
+  *          and kept in backup SRAM ring
+  ******************************************************************************
+  * The ring survives standby and reset, so the bootloader can print the
+  * checkpoints written by the application ('p' command). Cycles are counted
+  * from traceStart(), the clock of every mark is stored to convert cycles
+  * to time on the host (tools/tracedecode.c).
+  ******************************************************************************
+  */
+/* Includes ------------------------------------------------------------------*/
+#include "trace.h"
+#include "bkpsram.h"
+
+/** @addtogroup TRACE
+  * @{
+  */
+
+/* Private typedef -----------------------------------------------------------*/
+typedef struct
+{
+  uint32_t magic;
+  uint32_t head;                      // next entry to write
+  uint32_t count;                     // number of valid entries
+  traceEntry_t entry[TRACE_SIZE];
+} traceRing_t;
+/* Private define ------------------------------------------------------------*/
+#define TRACE_MAGIC     0x54524331UL  // "TRC1"
+/* Private macro -------------------------------------------------------------*/
+#define TRACE_RING      ((traceRing_t*)BKPSRAM_TRACE_ADDR)
+/* Private variables ---------------------------------------------------------*/
+/* Private function prototypes -----------------------------------------------*/
+#ifdef TRACE_ENABLE
+static void traceStore(uint16_t id, uint32_t mhz);
+#endif
+/* Public functions ----------------------------------------------------------*/
+#ifdef TRACE_ENABLE
+/**
+  * @brief  enable cycle counter and backup SRAM access,
+  *         clear the ring if it is not valid
+  * @param  None
+  * @retval None
+  */
+void traceInit(void)
+{
+  traceRing_t* ring = TRACE_RING;
+
+  bkpsramEnable();
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+  if((ring->magic != TRACE_MAGIC)||(ring->head >= TRACE_SIZE)||(ring->count > TRACE_SIZE))
+  {
+    ring->head = 0;
+    ring->count = 0;
+    ring->magic = TRACE_MAGIC;
+  }
+}
+
+/**
+  * @brief  restart cycle counter and mark the beginning of a new record
+  *         called once after reset, the clock is HSI. It may be called from
+  *         SystemInit() before C runtime init, so SystemCoreClock is not used
+  * @param  None
+  * @retval None
+  */
+void traceStart(void)
+{
+  DWT->CYCCNT = 0;
+  traceStore(TRACE_BOOT, HSI_VALUE/1000000UL);
+}
+
+/**
+  * @brief  store a checkpoint in the ring
+  * @param  id - traceId_t
+  * @retval None
+  */
+void traceMark(uint16_t id)
+{
+  traceStore(id, SystemCoreClock/1000000UL);
+}
+#endif
+
+/**
+  * @brief  number of entries stored in the ring
+  * @param  None
+  * @retval number of entries from 0 to TRACE_SIZE
+  */
+uint32_t traceCount(void)
+{
+#ifdef TRACE_ENABLE
+  traceRing_t* ring = TRACE_RING;
+
+  if(ring->magic != TRACE_MAGIC)return 0;
+  return ring->count;
+#else
+  return 0;
+#endif
+}
+
+/**
+  * @brief  read an entry from the ring, oldest first
+  * @param  index from 0 to traceCount() - 1
+  *         entry - pointer to entry to fill
+  * @retval 0 - success
+  *         -1 - no entry with this index
+  */
+int traceGet(uint32_t index, traceEntry_t* entry)
+{
+  traceRing_t* ring = TRACE_RING;
+  uint32_t count = traceCount();
+
+  if(index >= count)return -1;
+  index = (ring->head + TRACE_SIZE - count + index) % TRACE_SIZE;
+  *entry = ring->entry[index];
+  return 0;
+}
+/* Private functions ---------------------------------------------------------*/
+#ifdef TRACE_ENABLE
+/**
+  * @brief  write an entry to the ring
+  * @param  id - traceId_t
+  *         mhz - HCLK in MHz
+  * @retval None
+  */
+static void traceStore(uint16_t id, uint32_t mhz)
+{
+  traceRing_t* ring = TRACE_RING;
+  traceEntry_t* entry = &ring->entry[ring->head];
+
+  entry->cycles = DWT->CYCCNT;
+  entry->id = id;
+  entry->mhz = (uint16_t)mhz;
+  if(++ring->head >= TRACE_SIZE)ring->head = 0;
+  if(ring->count < TRACE_SIZE)ring->count++;
+}
+#endif
+
+/**
+  * @}
+  */
@@ -0,0 +1,92 @@
+/**
+  ******************************************************************************
+  * @file    trace.h
+  * @author  AKabanov
+  * @brief   Header for trace.c module
+  ******************************************************************************
+  ******************************************************************************
+  */
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __TRACE_H
+#define __TRACE_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f2xx_hal.h"
+
+/* Exported types ------------------------------------------------------------*/
+typedef enum
+{
+  TRACE_BOOT = 0,        // bootloader main() entry, start of a new record
+  TRACE_HAL_INIT,        // HAL_Init() done
+  TRACE_CLOCK,           // SystemClock_Config() done, system clock configured
+  TRACE_GPIO,            // gpioInit() done
+  TRACE_CRC,             // application CRC checked
+  TRACE_GO_APP,          // jump to application
+  TRACE_APP_MAIN = 16,   // application main() entry
+  TRACE_APP_HAL_INIT,    // HAL_Init() done
+  TRACE_APP_CLOCK,       // HSI clock profile set
+  TRACE_APP_RTC,         // RTCInit() done
+  TRACE_APP_TIM,         // gpioInit() and tim1Init() done
+  TRACE_APP_PERIOD,      // sensor read done
+  TRACE_APP_BURST,       // tone burst started
+  TRACE_APP_BURST_END,   // tone burst stopped
+  TRACE_APP_SLEEP,       // entering standby
+  TRACE_APP_PLL,         // PLL clock profile set, HSE + PLL locked
+  TRACE_APP_WAKE,        // wake up from Stop mode, start of a new record
+} traceId_t;
+
+typedef struct
+{
+  uint16_t id;           // traceId_t
+  uint16_t mhz;          // HCLK in MHz at the moment of the mark
+  uint32_t cycles;       // DWT->CYCCNT
+} traceEntry_t;
+
+/* Exported constants --------------------------------------------------------*/
+#define TRACE_ENABLE                 //comment to remove trace from the code
+#define TRACE_SIZE      64           //entries in the ring
+
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions ------------------------------------------------------- */
+#ifdef TRACE_ENABLE
+/**
+  * @brief  enable cycle counter and backup SRAM access,
+  *         clear the ring if it is not valid
+  * @param  None
+  * @retval None
+  */
+void traceInit(void);
+/**
+  * @brief  restart cycle counter and mark the beginning of a new record
+  *         called once after reset, the clock is HSI
+  * @param  None
+  * @retval None
+  */
+void traceStart(void);
+/**
+  * @brief  store a checkpoint in the ring
+  * @param  id - traceId_t
+  * @retval None
+  */
+void traceMark(uint16_t id);
+#else
+#define traceInit()
+#define traceStart()
+#define traceMark(id)
+#endif
+/**
+  * @brief  read an entry from the ring, oldest first
+  * @param  index from 0 to traceCount() - 1
+  *         entry - pointer to entry to fill
+  * @retval 0 - success
+  *         -1 - no entry with this index
+  */
+int traceGet(uint32_t index, traceEntry_t* entry);
+/**
+  * @brief  number of entries stored in the ring
+  * @param  None
+  * @retval number of entries from 0 to TRACE_SIZE
+  */
+uint32_t traceCount(void);
+
+#endif /* __TRACE_H */
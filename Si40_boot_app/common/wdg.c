@@ -0,0 +1,178 @@
+/**
+  ******************************************************************************
+  * @file    wdg.c
+  * @author  AKabanov
+  * @brief   IWDG supervision of bootloader and application, record of the
+  *          resets in backup SRAM
+  ******************************************************************************
+  * IWDG is started by the bootloader and again by the application on every
+  * wake, so it runs whatever path the wake takes. It is not stopped in Stop
+  * and Standby, every sleep is cut to SCHED_MAX_SLEEP, below the shortest
+  * timeout; the application doesn't wait for LSI synchronization and has no
+  * other reload in the wake cycle. The bootloader reloads it in the main
+  * loop and on every UART byte. Error handlers reset the MCU at once, the
+  * bootloader counts fault resets in a row and keeps the service window
+  * open after WDG_MAX_FAULTS of them.
+  ******************************************************************************
+  */
+/* Includes ------------------------------------------------------------------*/
+#include "wdg.h"
+#include "bkpsram.h"
+
+/** @addtogroup WDG
+  * @{
+  */
+
+/* Private typedef -----------------------------------------------------------*/
+typedef struct
+{
+  uint32_t magic;
+  uint8_t faults;                     // fault resets in a row
+  uint8_t reset;                      // reset flags for the event log
+  uint8_t lastFault;                  // reset flags of the last fault reset
+  uint8_t reserved;
+  uint32_t line;                      // line of the last error handler call
+} wdgRecord_t;
+/* Private define ------------------------------------------------------------*/
+#define WDG_MAGIC       0x57444731UL  // "WDG1"
+#define WDG_KEY_RELOAD  0xAAAAU
+#define WDG_KEY_ENABLE  0xCCCCU
+#define WDG_KEY_ACCESS  0x5555U
+#define WDG_PRESCALER   (IWDG_PR_PR_2 | IWDG_PR_PR_1)  // /256
+#define WDG_RELOAD      0x0FFFU
+/* Private macro -------------------------------------------------------------*/
+#define WDG_RECORD      ((wdgRecord_t*)BKPSRAM_WDG_ADDR)
+/* Private variables ---------------------------------------------------------*/
+/* Private function prototypes -----------------------------------------------*/
+static wdgRecord_t* wdgRecord(void);
+/* Public functions ----------------------------------------------------------*/
+
+/**
+  * @brief  start IWDG with the longest timeout, no waiting for LSI
+  *         synchronization, may be called again on every wake
+  *         Till PR and RLR are synchronized (~5 LSI periods) the counter runs
+  *         with the reset values, 512 ms.
+  * @param  None
+  * @retval None
+  */
+void wdgStart(void)
+{
+  IWDG->KR = WDG_KEY_ENABLE;
+  IWDG->KR = WDG_KEY_ACCESS;
+  IWDG->PR = WDG_PRESCALER;
+  IWDG->RLR = WDG_RELOAD;
+  IWDG->KR = WDG_KEY_RELOAD;
+}
+
+/**
+  * @brief  reload IWDG
+  * @param  None
+  * @retval None
+  */
+void wdgKick(void)
+{
+  IWDG->KR = WDG_KEY_RELOAD;
+}
+
+/**
+  * @brief  take reset flags of this start after reset into the record in
+  *         backup SRAM and clear them, count fault resets in a row
+  *         called by bootloader, before the application
+  * @param  None
+  * @retval number of fault resets in a row
+  */
+uint32_t wdgBoot(void)
+{
+  uint8_t reset = (uint8_t)(RCC->CSR >> 24);
+  wdgRecord_t* rec = wdgRecord();
+
+  __HAL_RCC_CLEAR_RESET_FLAGS();
+  rec->reset = reset;
+  if(reset & WDG_RESET_FAULT)
+  {
+    if(rec->faults < 0xFF)rec->faults++;
+    rec->lastFault = reset;
+  }
+  else rec->faults = 0;               // power on, brown out, reset button
+  return rec->faults;
+}
+
+/**
+  * @brief  reset flags taken by wdgBoot, once, for the event log
+  * @param  None
+  * @retval RCC_CSR reset flags, bits 31 - 24, 0 if already taken
+  */
+uint8_t wdgTakeReset(void)
+{
+  wdgRecord_t* rec = wdgRecord();
+  uint8_t reset = rec->reset;
+
+  rec->reset = 0;
+  return reset;
+}
+
+/**
+  * @brief  the wake is done without faults, clear the fault counter
+  * @param  None
+  * @retval None
+  */
+void wdgGood(void)
+{
+  wdgRecord_t* rec = wdgRecord();
+
+  if(rec->faults != 0)rec->faults = 0;
+}
+
+/**
+  * @brief  record of the faults, for the device info
+  * @param  faults - number of fault resets in a row
+  *         lastFault - reset flags of the last fault reset
+  *         line - line of the last error handler call, 0 - application
+  * @retval None
+  */
+void wdgGetRecord(uint32_t* faults, uint8_t* lastFault, uint32_t* line)
+{
+  wdgRecord_t* rec = wdgRecord();
+
+  *faults = rec->faults;
+  *lastFault = rec->lastFault;
+  *line = rec->line;
+}
+
+/**
+  * @brief  store the place of the fault and reset at once
+  * @param  line - line of the error handler call, 0 - application
+  * @retval None
+  */
+void wdgFault(uint32_t line)
+{
+  wdgRecord()->line = line;
+  NVIC_SystemReset();
+}
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  enable backup SRAM, clear the record if it is not valid
+  * @param  None
+  * @retval record
+  */
+static wdgRecord_t* wdgRecord(void)
+{
+  wdgRecord_t* rec = WDG_RECORD;
+
+  bkpsramEnable();
+  if(rec->magic != WDG_MAGIC)
+  {
+    rec->faults = 0;
+    rec->reset = 0;
+    rec->lastFault = 0;
+    rec->line = 0;
+    rec->magic = WDG_MAGIC;
+  }
+  return rec;
+}
+
+/**
+  * @}
+  */
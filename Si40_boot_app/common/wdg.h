@@ -0,0 +1,84 @@
+/**
+  ******************************************************************************
+  * @file    wdg.h
+  * @author  AKabanov
+  * @brief   Header for wdg.c module
+  ******************************************************************************
+  ******************************************************************************
+  */
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __WDG_H
+#define __WDG_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f2xx_hal.h"
+
+/* Exported types ------------------------------------------------------------*/
+/* Exported constants --------------------------------------------------------*/
+#define WDG_MAX_FAULTS       3            // fault resets in a row to stay in bootloader
+/* IWDG timeout is 4096*256/LSI: 32.8 s at 32 kHz, 22.3 s at LSI max 47 kHz.
+   IWDG runs in Stop and Standby, so one sleep must be shorter
+   (SCHED_MAX_SLEEP in sched.h) */
+#define WDG_TIMEOUT_MIN_S    22
+
+/* reset flags, RCC_CSR bits 31 - 24 */
+#define WDG_RESET_BOR        0x02
+#define WDG_RESET_PIN        0x04
+#define WDG_RESET_POR        0x08
+#define WDG_RESET_SFT        0x10
+#define WDG_RESET_IWDG       0x20
+#define WDG_RESET_WWDG       0x40
+#define WDG_RESET_LPWR       0x80
+#define WDG_RESET_FAULT      (WDG_RESET_SFT | WDG_RESET_IWDG | WDG_RESET_WWDG)
+
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions ------------------------------------------------------- */
+/**
+  * @brief  start IWDG with the longest timeout, no waiting for LSI
+  *         synchronization, may be called again on every wake
+  * @param  None
+  * @retval None
+  */
+void wdgStart(void);
+/**
+  * @brief  reload IWDG
+  * @param  None
+  * @retval None
+  */
+void wdgKick(void);
+/**
+  * @brief  take reset flags of this start after reset into the record in
+  *         backup SRAM and clear them, count fault resets in a row
+  *         called by bootloader, before the application
+  * @param  None
+  * @retval number of fault resets in a row
+  */
+uint32_t wdgBoot(void);
+/**
+  * @brief  reset flags taken by wdgBoot, once, for the event log
+  * @param  None
+  * @retval RCC_CSR reset flags, bits 31 - 24, 0 if already taken
+  */
+uint8_t wdgTakeReset(void);
+/**
+  * @brief  the wake is done without faults, clear the fault counter
+  * @param  None
+  * @retval None
+  */
+void wdgGood(void);
+/**
+  * @brief  record of the faults, for the device info
+  * @param  faults - number of fault resets in a row
+  *         lastFault - reset flags of the last fault reset
+  *         line - line of the last error handler call, 0 - application
+  * @retval None
+  */
+void wdgGetRecord(uint32_t* faults, uint8_t* lastFault, uint32_t* line);
+/**
+  * @brief  store the place of the fault and reset at once
+  * @param  line - line of the error handler call, 0 - application
+  * @retval None
+  */
+void wdgFault(uint32_t line);
+
+#endif /* __WDG_H */
@@ -0,0 +1,392 @@
+/**
+  ******************************************************************************
+  * @file    ddc.c
+  * @author  AKabanov
+  * @brief   host digital down converter of captures, the band of the
+  *          frequency plan or one channel to complex baseband at a tenth of
+  *          the rate (arm_ddc_q15)
+  ******************************************************************************
+  * build:  D=../common/Drivers/CMSIS/DSP_Lib/Source
+  *         gcc -O2 -DARM_MATH_HOST -fno-strict-aliasing -fwrapv -I../common
+  *             -I../common/Drivers/CMSIS/Include -o ddc ddc.c
+  *             $D/FilteringFunctions/arm_ddc_*.c
+  *             $D/FilteringFunctions/arm_fir_decimate_fast_q15.c
+  *             $D/FilteringFunctions/arm_fir_decimate_init_q15.c
+  *             $D/ControllerFunctions/arm_sin_cos_q31.c
+  *             $D/SupportFunctions/arm_copy_q15.c
+  *             $D/SupportFunctions/arm_arena.c
+  *             $D/CommonTables/arm_common_tables.c -lm
+  * usage:  ddc [-r rate] [-m M] [-n taps] [-c ch | -f hz] [-b block] in out
+  *         ddc -s [-r rate] [-m M] [-n taps] [-c ch | -f hz]      self test
+  *
+  * in is a capture of 16 bit little endian mono samples at rate Hz (200000
+  * default), out gets 16 bit little endian {re, im} pairs at rate/M (M 10
+  * default), "-" is stdin or stdout. The band around the center, the middle
+  * of FREQ_PLAN (common/freqplan.h) or channel ch or hz, comes out at 0 Hz,
+  * lower frequencies negative: the 35 channels of the plan are within 3.2
+  * kHz of the middle, so 20 kS/s complex hold them all instead of 200 kS/s
+  * real, and tonedetect, pingmon or pingtoa on the baseband have a tenth of
+  * the samples to do. A sine of amplitude A comes out with amplitude A/2.
+  *
+  * The lowpass is a windowed sinc (Blackman) cut at rate/(2 M), taps
+  * (96 default) in Q15 with a gain of 1. Its transition is about 5.5
+  * rate/taps wide, so the band must stay under rate/(2 M) minus half of
+  * that: the check below stops on a center or an M that leaves a channel
+  * out. The input goes through in blocks of -b samples (1000 default, a
+  * multiple of M) without allocation, as on the target; dspbench has the
+  * throughput of arm_ddc_q15 per block size.
+  *
+  * The buffers of the converter and of the blocks come from one arena
+  * (arm_arena.h) in the lengths of the settings. DDC_ARENA lists them at
+  * MAX_TAPS and MAX_BLOCK, the build stops if that is above RAM_BUDGET,
+  * what the SRAM of STM32F205RB leaves for the pipeline.
+  *
+  * The self test runs the stream in blocks of random size against one
+  * block, the output against the chain in double (the mixer on the same
+  * phase steps, the rounded coefficients), a sine on every channel for the
+  * gain in the band and sines that fold into the band at rate/M for the
+  * rejection of the lowpass. It ends with the arena: the list with its
+  * bytes and the peak of the runs. Exit code is the number of failed
+  * checks.
+  ******************************************************************************
+  */
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "arm_math.h"
+#include "arm_arena.h"
+#include "freqplan.h"
+
+/* Private define ------------------------------------------------------------*/
+#define MAX_TAPS        1024
+#define MAX_BLOCK       2000
+#define RAM_BUDGET      (48*1024)     // bytes, 64 KB SRAM less the application
+#define TEST_LENGTH     40000         // samples of a test signal
+#define MIN_REJECTION   60.0          // dB of the lowpass at the folds into the band
+#define MAX_RIPPLE      0.1           // dB of the gain over the channels
+
+/* buffers of the pipeline at the largest settings, in the order of the run */
+#define DDC_ARENA(X) \
+  X(coeffs,  q15_t, MAX_TAPS) \
+  X(state,   q15_t, ARM_DDC_STATE_LEN(MAX_TAPS, MAX_BLOCK)) \
+  X(scratch, q15_t, ARM_DDC_SCRATCH_LEN(MAX_BLOCK)) \
+  X(input,   q15_t, MAX_BLOCK) \
+  X(output,  q15_t, ARM_DDC_DST_LEN(1, MAX_BLOCK)) \
+  X(file,    uint8_t, 4*MAX_BLOCK)
+
+ARM_ARENA_CHECK(ddc, DDC_ARENA, RAM_BUDGET);
+
+/* Private variables ---------------------------------------------------------*/
+static const uint32_t planHz[FREQ_CHANNELS] =
+{
+#define PLAN_HZ(ch, hz)  [ch - 1] = hz,
+  FREQ_PLAN(PLAN_HZ)
+};
+
+static uint32_t sampleRate = 200000, centerHz, bandHz, taps = 96, blockSize = 1000;
+static uint8_t decimation = 10;
+static int channel = 0;               // 1 based, 0 for the band of the plan
+ARM_ARENA_DEFINE(arenaMem, DDC_ARENA);
+static const arm_arena_entry arenaList[] = ARM_ARENA_REPORT(DDC_ARENA);
+static arm_arena_instance arena;
+static q15_t* coeffs;
+static arm_ddc_instance_q15 ddc;
+static uint32_t seed = 1;
+static unsigned failed = 0;
+
+/* Private functions ---------------------------------------------------------*/
+static uint32_t rnd(void)
+{
+  seed ^= seed << 13;
+  seed ^= seed >> 17;
+  seed ^= seed << 5;
+  return seed;
+}
+
+static void check(const char* name, int i, int ok)
+{
+  if(!ok)
+  {
+    printf("FAIL %s %d\n", name, i);
+    failed++;
+  }
+}
+
+/* Blackman windowed sinc cut at rate/(2 M), gain 1 at 0 Hz; symmetric, so
+   the time reversed order of the decimator is the same */
+static void design(void)
+{
+  double h[MAX_TAPS], sum = 0, cut = 0.5/decimation;
+
+  for(uint32_t k = 0; k < taps; k++)
+  {
+    double t = k - (taps - 1)/2.0, w = 2.0*PI*k/(taps - 1);
+
+    h[k] = ((t == 0) ? 2.0*cut : sin(2.0*PI*cut*t)/(PI*t))*(0.42 - 0.5*cos(w) + 0.08*cos(2*w));
+    sum += h[k];
+  }
+  for(uint32_t k = 0; k < taps; k++)coeffs[k] = (q15_t)lrint(h[k]/sum*32768.0);
+}
+
+/* |gain| of the rounded lowpass at hz from the center */
+static double response(double hz)
+{
+  double re = 0, im = 0;
+
+  for(uint32_t k = 0; k < taps; k++)
+  {
+    re += coeffs[k]/32768.0*cos(2.0*PI*hz*k/sampleRate);
+    im -= coeffs[k]/32768.0*sin(2.0*PI*hz*k/sampleRate);
+  }
+  return hypot(re, im);
+}
+
+static void init(void)
+{
+  uint32_t lo = planHz[0], hi = planHz[0];
+
+  for(int i = 0; i < FREQ_CHANNELS; i++)
+  {
+    if(planHz[i] < lo)lo = planHz[i];
+    if(planHz[i] > hi)hi = planHz[i];
+  }
+  if(channel > 0)lo = hi = planHz[channel - 1];
+  if(centerHz == 0)centerHz = (lo + hi)/2;
+  bandHz = (hi - centerHz > centerHz - lo) ? hi - centerHz : centerHz - lo;
+
+  /* the buffers of the settings, again from the start of the arena */
+  arm_arena_release(&arena, 0);
+  coeffs = arm_arena_alloc_q15(&arena, taps);
+  if((taps < 2)||(taps > MAX_TAPS)||(blockSize > MAX_BLOCK)||
+     (arm_ddc_init_q15(&ddc, (uint16_t)taps, decimation, coeffs, centerHz, sampleRate,
+                       arm_arena_alloc_q15(&arena, ARM_DDC_STATE_LEN(taps, blockSize)),
+                       arm_arena_alloc_q15(&arena, ARM_DDC_SCRATCH_LEN(blockSize)), blockSize) != ARM_MATH_SUCCESS))
+  {
+    fprintf(stderr, "M %u, taps %u, block %u, center %u Hz not supported at %u Hz\n", (unsigned)decimation,
+            (unsigned)taps, (unsigned)blockSize, (unsigned)centerHz, (unsigned)sampleRate);
+    exit(1);
+  }
+  /* the channels inside the flat part of the lowpass */
+  if(bandHz + 2.75*sampleRate/taps > sampleRate/(2.0*decimation))
+  {
+    fprintf(stderr, "channels %u Hz from %u Hz, beyond the band of M %u and %u taps at %u Hz\n",
+            (unsigned)bandHz, (unsigned)centerHz, (unsigned)decimation, (unsigned)taps, (unsigned)sampleRate);
+    exit(1);
+  }
+  design();
+}
+
+/* the whole signal through in blocks of random size (or blockSize) */
+static uint32_t run(const q15_t* x, uint32_t length, q15_t* y, int randomBlocks)
+{
+  uint32_t done = 0, out = 0;
+
+  init();
+  while(done < length)
+  {
+    uint32_t n = randomBlocks ? decimation*(1 + rnd() % (blockSize/decimation)) : blockSize;
+
+    if(n > length - done)n = length - done;
+    arm_ddc_q15(&ddc, (q15_t*)x + done, y + 2*out, n);
+    done += n;
+    out += n/decimation;
+  }
+  return out;
+}
+
+/* sum of x e^(-j w m) over the output from skip on, |.|/count */
+static double amplitudeAt(const q15_t* y, uint32_t count, uint32_t skip, double hz)
+{
+  double re = 0, im = 0, w = 2.0*PI*hz*decimation/sampleRate;
+
+  for(uint32_t m = skip; m < count; m++)
+  {
+    re += (y[2*m]*cos(w*m) + y[2*m + 1]*sin(w*m))/32768.0;
+    im += (y[2*m + 1]*cos(w*m) - y[2*m]*sin(w*m))/32768.0;
+  }
+  return hypot(re, im)/(count - skip);
+}
+
+static void sine(q15_t* x, uint32_t length, double hz, double amplitude)
+{
+  for(uint32_t n = 0; n < length; n++)x[n] = (q15_t)lrint(32768.0*amplitude*sin(2.0*PI*hz*n/sampleRate + 0.3));
+}
+
+static void selfTest(void)
+{
+  static q15_t x[TEST_LENGTH], y[2*TEST_LENGTH], z[2*TEST_LENGTH];
+  uint32_t length = TEST_LENGTH - TEST_LENGTH % blockSize, count, skip = taps/decimation + 1;
+  uint32_t step, phase = 0;
+  double worst = 0, lo = 1e9, hi = -1e9, rejection = 1e9;
+  int i = 0;
+
+  /* noise and a channel near full scale */
+  for(uint32_t n = 0; n < length; n++)
+  {
+    x[n] = (q15_t)lrint(16384.0*sin(2.0*PI*planHz[7]*n/sampleRate) + ((int16_t)rnd() >> 2));
+  }
+  count = run(x, length, y, 0);
+  check("count", 0, count == length/decimation);
+  check("blocks", 0, (run(x, length, z, 1) == count)&&(memcmp(y, z, 2*count*sizeof(q15_t)) == 0));
+
+  /* the chain in double on the phase steps of the instance */
+  init();
+  step = ddc.phaseInc;
+  {
+    static double re[TEST_LENGTH], im[TEST_LENGTH];
+
+    for(uint32_t n = 0; n < length; n++, phase += step)
+    {
+      double a = 2.0*PI*phase/4294967296.0;
+
+      re[n] = x[n]/32768.0*cos(a);
+      im[n] = -x[n]/32768.0*sin(a);
+    }
+    for(uint32_t m = 0; m < count; m++)
+    {
+      double r = 0, q = 0;
+
+      for(uint32_t k = 0; k < taps; k++)
+      {
+        int64_t n = (int64_t)m*decimation - k;
+
+        if(n < 0)break;
+        r += coeffs[k]/32768.0*re[n];
+        q += coeffs[k]/32768.0*im[n];
+      }
+      if(fabs(r*32768.0 - y[2*m]) > worst)worst = fabs(r*32768.0 - y[2*m]);
+      if(fabs(q*32768.0 - y[2*m + 1]) > worst)worst = fabs(q*32768.0 - y[2*m + 1]);
+    }
+  }
+  /* rounding of the mixer and truncation of the 2.30 sums */
+  check("double", 0, worst < 2.0);
+  printf("%u Hz -> %u Hz complex, center %u Hz, M %u, %u taps: within %.2f LSB of double\n",
+         (unsigned)sampleRate, (unsigned)(sampleRate/decimation), (unsigned)centerHz, (unsigned)decimation,
+         (unsigned)taps, worst);
+
+  /* gain A/2 on every channel of the band */
+  for(int ch = 0; ch < FREQ_CHANNELS; ch++)
+  {
+    double dB;
+
+    if((channel > 0)&&(ch != channel - 1))continue;
+    sine(x, length, planHz[ch], 0.5);
+    count = run(x, length, y, 0);
+    dB = 20.0*log10(amplitudeAt(y, count, skip, (double)planHz[ch] - centerHz)/0.25);
+    if(dB < lo)lo = dB;
+    if(dB > hi)hi = dB;
+    check("gain", ch, fabs(dB) < MAX_RIPPLE);
+  }
+  /* sines rate/M off a channel fold onto it */
+  for(int side = -1; side <= 1; side += 2)
+  {
+    uint32_t ch = (channel > 0) ? (uint32_t)channel - 1 : rnd() % FREQ_CHANNELS;
+    double hz = planHz[ch] + side*(double)sampleRate/decimation, dB;
+
+    if((hz <= 0)||(hz >= sampleRate/2.0))continue;
+    sine(x, length, hz, 0.5);
+    count = run(x, length, y, 0);
+    dB = -20.0*log10(amplitudeAt(y, count, skip, (double)planHz[ch] - centerHz)/0.25 + 1e-12);
+    if(dB < rejection)rejection = dB;
+    check("rejection", i++, dB > MIN_REJECTION);
+  }
+  printf("gain %+.3f to %+.3f dB over the channels, folds %.1f dB down (lowpass %.1f dB)\n", lo, hi, rejection,
+         -20.0*log10(response(sampleRate/(double)decimation - bandHz)));
+  printf("%u checks failed\n", failed);
+}
+
+static void report(FILE* f)
+{
+  for(size_t i = 0; i < sizeof(arenaList)/sizeof(arenaList[0]); i++)
+  {
+    fprintf(f, "arena %-8s %s[%u] %u bytes\n", arenaList[i].name, arenaList[i].type, (unsigned)arenaList[i].len,
+            (unsigned)arenaList[i].bytes);
+  }
+  fprintf(f, "arena %u of %u bytes budget, peak %u\n", (unsigned)ARM_ARENA_SIZE(DDC_ARENA), (unsigned)RAM_BUDGET,
+          (unsigned)arena.peak);
+}
+
+static void usage(void)
+{
+  fprintf(stderr, "usage: ddc [-r rate] [-m M] [-n taps] [-c ch | -f hz] [-b block] in out\n"
+                  "       ddc -s [-r rate] [-m M] [-n taps] [-c ch | -f hz]\n");
+  exit(1);
+}
+
+int main(int argc, char* argv[])
+{
+  const char* name[2] = {NULL, NULL};
+  int test = 0, names = 0;
+  FILE* in;
+  FILE* out;
+  uint64_t total = 0;
+  uint8_t* raw;
+  q15_t* x;
+  q15_t* y;
+
+  arm_arena_init(&arena, arenaMem, sizeof(arenaMem));
+  for(int i = 1; i < argc; i++)
+  {
+    if(strcmp(argv[i], "-s") == 0)test = 1;
+    else if((strcmp(argv[i], "-r") == 0)&&(i + 1 < argc))sampleRate = strtoul(argv[++i], NULL, 0);
+    else if((strcmp(argv[i], "-m") == 0)&&(i + 1 < argc))decimation = (uint8_t)strtoul(argv[++i], NULL, 0);
+    else if((strcmp(argv[i], "-n") == 0)&&(i + 1 < argc))taps = strtoul(argv[++i], NULL, 0);
+    else if((strcmp(argv[i], "-f") == 0)&&(i + 1 < argc))centerHz = strtoul(argv[++i], NULL, 0);
+    else if((strcmp(argv[i], "-b") == 0)&&(i + 1 < argc))blockSize = strtoul(argv[++i], NULL, 0);
+    else if((strcmp(argv[i], "-c") == 0)&&(i + 1 < argc))
+    {
+      channel = atoi(argv[++i]);
+      if((channel < 1)||(channel > FREQ_CHANNELS))usage();
+    }
+    else if(names < 2)name[names++] = argv[i];
+    else usage();
+  }
+  if(test)
+  {
+    if(TEST_LENGTH < 4*blockSize)blockSize = TEST_LENGTH/4;
+    if(decimation > 0)blockSize -= blockSize % decimation;
+    init();
+    selfTest();
+    report(stdout);
+    return (int)failed;
+  }
+  if(names != 2)usage();
+  init();
+  x = arm_arena_alloc_q15(&arena, blockSize);
+  y = arm_arena_alloc_q15(&arena, ARM_DDC_DST_LEN(decimation, blockSize));
+  /* 16 bit little endian of a block in, of its output out */
+  raw = (uint8_t*)arm_arena_alloc(&arena, 4*blockSize);
+
+  in = (strcmp(name[0], "-") == 0) ? stdin : fopen(name[0], "rb");
+  out = (strcmp(name[1], "-") == 0) ? stdout : fopen(name[1], "wb");
+  if((in == NULL)||(out == NULL))
+  {
+    perror((in == NULL) ? name[0] : name[1]);
+    return 1;
+  }
+  for(;;)
+  {
+    uint32_t n = (uint32_t)fread(raw, 2, blockSize, in);
+
+    /* the last block cut to a multiple of M */
+    n -= n % decimation;
+    if(n == 0)break;
+    for(uint32_t i = 0; i < n; i++)x[i] = (q15_t)(raw[2*i] | (raw[2*i + 1] << 8));
+    arm_ddc_q15(&ddc, x, y, n);
+    for(uint32_t i = 0; i < 2*n/decimation; i++)
+    {
+      raw[2*i] = (uint8_t)y[i];
+      raw[2*i + 1] = (uint8_t)((uint16_t)y[i] >> 8);
+    }
+    fwrite(raw, 2, 2*n/decimation, out);
+    total += n;
+  }
+  if(in != stdin)fclose(in);
+  if(out != stdout)fclose(out);
+  fprintf(stderr, "%llu samples at %u Hz -> %llu complex at %u Hz, center %u Hz, arena %u bytes\n",
+          (unsigned long long)total, (unsigned)sampleRate, (unsigned long long)(total/decimation),
+          (unsigned)(sampleRate/decimation), (unsigned)centerHz, (unsigned)arena.peak);
+  return 0;
+}
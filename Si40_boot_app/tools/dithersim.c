@@ -0,0 +1,198 @@
+/**
+  ******************************************************************************
+  * @file    dithersim.c
+  * @author  AKabanov
+  * @brief   host simulation of ARR dithering of tim1.c (TIM1_DITHER),
+  *          frequency accuracy and spectral purity against integer periods
+  ******************************************************************************
+  * build:  D=../common/Drivers/CMSIS/DSP_Lib/Source
+  *         gcc -O2 -DARM_MATH_HOST -fno-strict-aliasing -fwrapv -I../common
+  *             -I../common/Drivers/CMSIS/Include
+  *             -o dithersim dithersim.c
+  *             $D/TransformFunctions/arm_rfft_fast_f32.c
+  *             $D/TransformFunctions/arm_rfft_fast_init_f32.c
+  *             $D/TransformFunctions/arm_cfft_f32.c
+  *             $D/TransformFunctions/arm_cfft_radix8_f32.c
+  *             $D/TransformFunctions/arm_bitreversal2.c
+  *             $D/CommonTables/arm_common_tables.c
+  *             $D/CommonTables/arm_const_structs.c
+  *             $D/ComplexMathFunctions/arm_cmplx_mag_squared_f32.c -lm
+  * usage:  dithersim [-b bits] [channel ...]     all channels by default
+  *
+  * For every channel of common/freqplan.h the output (CH1 - CH1N, +-1) is
+  * rendered at timer clock resolution and averaged to FS_DIV clocks per
+  * sample, once with the integer period of PWMPeriods[] and once with the
+  * dither pattern of 2^bits periods (bits is FREQ_FRAC_BITS by default).
+  * Frequency is the average of the pattern. Spectrum is Welch average of
+  * Blackman-Harris windowed arm_rfft_fast_f32 frames; the worst spur is the
+  * strongest bin within SPUR_SPAN of the carrier outside its main lobe, in
+  * dB to the carrier. The integer column shows the floor of the method
+  * (aliases of the square wave harmonics), the difference is the cost of
+  * dithering.
+  ******************************************************************************
+  */
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "arm_math.h"
+#include "freqplan.h"
+
+/* Private define ------------------------------------------------------------*/
+#define FS_DIV          96            // 1.25 MHz sample rate
+#define FFT_LEN         4096
+#define FRAMES          16            // Welch frames, half overlap
+#define SAMPLES         (FFT_LEN*(FRAMES + 1)/2)
+#define MAIN_LOBE       5             // bins of the carrier, Blackman-Harris
+#define SPUR_SPAN       20000.0       // Hz around the carrier
+#define MAX_BITS        8
+
+/* Private variables ---------------------------------------------------------*/
+static float32_t sample[SAMPLES];
+static float32_t power[FFT_LEN/2];
+static const uint32_t planHz[FREQ_CHANNELS + 1] =
+{
+#define PLAN_HZ(ch, hz)  [ch] = hz,
+  FREQ_PLAN(PLAN_HZ)
+};
+
+/* Private functions ---------------------------------------------------------*/
+/* dither pattern, same as tim1PrepDither() in application/Src/tim1.c,
+   returns number of periods, pattern holds ARR */
+static uint32_t makePattern(uint32_t hz, uint32_t bits, uint16_t* pattern)
+{
+  uint32_t len = 1 << bits;
+  uint64_t frac = ((FREQ_CNT_CLK << bits) + hz/2)/hz;
+  uint32_t base = frac/len, extra = frac%len, acc = 0;
+
+  for(uint32_t i = 0; i < len; i++)
+  {
+    acc += extra;
+    if(acc >= len)
+    {
+      acc -= len;
+      pattern[i] = base;
+    }
+    else pattern[i] = base - 1;
+  }
+  return len;
+}
+
+/* output level +1 while CNT < CCR1, -1 after, averaged over FS_DIV clocks */
+static void render(const uint16_t* arr, uint32_t len, uint32_t ccr1)
+{
+  uint32_t n = 0, fill = 0, i = 0;
+  double acc = 0;
+
+  while(n < SAMPLES)
+  {
+    uint32_t period = arr[i++ % len] + 1;
+    for(uint32_t cnt = 0; (cnt < period)&&(n < SAMPLES); cnt++)
+    {
+      acc += (cnt < ccr1) ? 1.0 : -1.0;
+      if(++fill == FS_DIV)
+      {
+        sample[n++] = (float32_t)(acc/FS_DIV);
+        acc = 0;
+        fill = 0;
+      }
+    }
+  }
+}
+
+/* Welch average power spectrum of sample[] */
+static void spectrum(void)
+{
+  static float32_t frame[FFT_LEN], out[FFT_LEN], mag[FFT_LEN/2];
+  arm_rfft_fast_instance_f32 fft;
+
+  if(arm_rfft_fast_init_f32(&fft, FFT_LEN) != ARM_MATH_SUCCESS)exit(1);
+  memset(power, 0, sizeof(power));
+  for(uint32_t start = 0; start + FFT_LEN <= SAMPLES; start += FFT_LEN/2)
+  {
+    for(uint32_t i = 0; i < FFT_LEN; i++)
+    {
+      double w = 2.0*PI*i/FFT_LEN;
+      double bh = 0.35875 - 0.48829*cos(w) + 0.14128*cos(2*w) - 0.01168*cos(3*w);
+      frame[i] = sample[start + i]*bh;
+    }
+    arm_rfft_fast_f32(&fft, frame, out, 0);
+    arm_cmplx_mag_squared_f32(out + 2, mag + 1, FFT_LEN/2 - 1);
+    for(uint32_t k = 1; k < FFT_LEN/2; k++)power[k] += mag[k];
+  }
+}
+
+/* worst spur near the carrier in dBc, offset of it in Hz */
+static double worstSpur(double f, double* offset)
+{
+  double bin = FREQ_TIM_CLK/(double)FS_DIV/FFT_LEN;
+  uint32_t carrier = (uint32_t)floor(f/bin + 0.5), spur = 0;
+  uint32_t span = (uint32_t)(SPUR_SPAN/bin);
+
+  for(uint32_t k = carrier - MAIN_LOBE; k <= carrier + MAIN_LOBE; k++)
+  {
+    if(power[k] > power[carrier])carrier = k;
+  }
+  for(uint32_t k = carrier - span; k <= carrier + span; k++)
+  {
+    if((k + MAIN_LOBE >= carrier)&&(k <= carrier + MAIN_LOBE))continue;
+    if((spur == 0)||(power[k] > power[spur]))spur = k;
+  }
+  *offset = ((double)spur - carrier)*bin;
+  return 10.0*log10(power[spur]/power[carrier]);
+}
+
+static void simulate(uint32_t ch, uint32_t bits)
+{
+  static uint16_t pattern[1 << MAX_BITS];
+  uint32_t hz = planHz[ch];
+  uint16_t arr = FREQ_ARR(hz);
+  uint32_t len = makePattern(hz, bits, pattern);
+  uint64_t counts = 0;
+  double fInt = FREQ_CNT_CLK/(double)(arr + 1), fDith, spurInt, spurDith, offInt, offDith;
+
+  for(uint32_t i = 0; i < len; i++)counts += pattern[i] + 1;
+  fDith = FREQ_CNT_CLK*(double)len/counts;
+  render(&arr, 1, (arr + 1)/2);
+  spectrum();
+  spurInt = worstSpur(fInt, &offInt);
+  render(pattern, len, (arr + 1)/2);
+  spectrum();
+  spurDith = worstSpur(fDith, &offDith);
+  printf("%3u %6u %+8.3f %+8.3f %8.1f %8.1f %+8.0f\n", (unsigned)ch, (unsigned)hz,
+         fInt - hz, fDith - hz, spurInt, spurDith, offDith);
+}
+
+static void usage(void)
+{
+  fprintf(stderr, "usage: dithersim [-b bits] [channel ...]\n");
+  exit(1);
+}
+
+int main(int argc, char* argv[])
+{
+  uint32_t bits = FREQ_FRAC_BITS;
+  int i = 1;
+
+  if((argc > 2)&&(strcmp(argv[1], "-b") == 0))
+  {
+    bits = atoi(argv[2]);
+    if((bits < 1)||(bits > MAX_BITS))usage();
+    i = 3;
+  }
+  printf("pattern %u periods, %.0f Hz bin, spurs within %.0f Hz\n",
+         1u << bits, FREQ_TIM_CLK/(double)FS_DIV/FFT_LEN, SPUR_SPAN);
+  printf(" ch nominal  int err dith err  int dBc dith dBc  spur Hz\n");
+  if(i == argc)
+  {
+    for(uint32_t ch = 1; ch <= FREQ_CHANNELS; ch++)simulate(ch, bits);
+  }
+  for(; i < argc; i++)
+  {
+    uint32_t ch = atoi(argv[i]);
+    if((ch < 1)||(ch > FREQ_CHANNELS))usage();
+    simulate(ch, bits);
+  }
+  return 0;
+}
@@ -0,0 +1,915 @@
+/**
+  ******************************************************************************
+  * @file    dspbench.c
+  * @author  AKabanov
+  * @brief   throughput of the vendored CMSIS-DSP kernels per block size,
+  *          samples/s on the host, cycles on Cortex-M3
+  ******************************************************************************
+  * build:  D=../common/Drivers/CMSIS/DSP_Lib/Source
+  *         gcc -O2 -DARM_MATH_HOST -DARM_MATH_HOST_SIMD -fno-strict-aliasing
+  *             -fwrapv -I../common -I../common/Drivers/CMSIS/Include
+  *             -o dspbench dspbench.c
+  *             $D/[A-Z]*[a-z]/arm_*.c -lm
+  * usage:  dspbench [-t seconds] [-c baseline.csv] [-r percent] [kernel ...]
+  *
+  * Every kernel of the table runs over its sizes, one CSV line per kernel,
+  * type and size on stdout:
+  *   kernel,type,size,simd,ns_per_call,msamples_per_s[,baseline_ns,change_pct]
+  * size is the block of the filters, dot products, Goertzel bins (35
+  * channels of freqplan.h at 200 kHz) and sliding DFT (the same bins over
+  * a window of 2000 samples), the down converter (ddc64_m8, 64 taps and
+  * decimation by 8 around the middle of the plan) and the length of the
+  * transforms,
+  * the *_bank35 filters run 35 filters over the block in one call, the
+  * *_x35 lines the same 35 filters as single instances,
+  * a sample is one input sample (one complex value of the
+  * complex FFTs). A measurement repeats the kernel for at least -t seconds
+  * (0.05 default), the best of 3 is taken. The transforms alternate forward
+  * and inverse, so the f32 data stays bounded. kernel arguments select the
+  * kernels by prefix, e.g. "dspbench fir cfft". simd is the level of the
+  * host kernels (arm_math_host.h), ARM_MATH_HOST_SIMD=none in the
+  * environment measures the portable C.
+  *
+  * With -c the lines of an earlier run are compared: change_pct is the
+  * change of the time per call, positive is slower. Exit code is the number
+  * of kernels slower by more than -r percent (10 default).
+  *
+  * Cortex-M3: built with ARM_MATH_CM3 and STM32F205xx (and without
+  * ARM_MATH_HOST, CMSIS/Device/ST/STM32F2xx/Include on the include path
+  * for DWT and CoreDebug) the same table is timed by the DWT cycle
+  * counter, the lines are
+  *   kernel,type,size,cycles_per_call,cycles_per_sample
+  * printf must go to semihosting or a UART. Run it on the board: QEMU has
+  * no cycle model of Cortex-M3, the DWT counter does not count there.
+  * BENCH_MAX_FFT and BENCH_MAX_BLOCK are smaller there to fit 64 KB SRAM.
+  ******************************************************************************
+  */
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "arm_math.h"
+#include "arm_const_structs.h"
+#include "freqplan.h"
+#if defined(ARM_MATH_HOST)
+#include <time.h>
+#if defined(ARM_MATH_HOST_SIMD)
+#include "arm_math_host.h"
+#endif
+#else
+#include "stm32f2xx.h"                /* DWT and CoreDebug, arm_math.h has only the generic core */
+#endif
+
+/* Private define ------------------------------------------------------------*/
+#if defined(ARM_MATH_HOST)
+#define BENCH_MAX_FFT   4096
+#define BENCH_MAX_BLOCK 1024
+#else
+#define BENCH_MAX_FFT   1024          // 2 buffers of 8 KB, f32 complex
+#define BENCH_MAX_BLOCK 512
+#define BENCH_CALLS     8             // calls per measurement
+#endif
+#define NUM_TAPS        32
+#define NUM_STAGES      3
+#define NUM_FILTERS     FREQ_CHANNELS // filters of the banks
+#define GOERTZEL_RATE   200000        // Hz, bins on the channels of freqplan.h
+#define SDFT_WINDOW     2000          // samples of the sliding DFT, 100 Hz bins
+#define DDC_TAPS        64
+#define DDC_DECIMATION  8             // divides the block sizes
+#define DDC_CENTER      46200         // Hz, middle of the plan
+#define REPEATS         3
+#define MAX_BASELINE    512
+
+/* Private typedef -----------------------------------------------------------*/
+typedef struct
+{
+  const char* kernel;
+  const char* type;
+  const uint32_t* sizes;              // 0 terminated
+  int (*setup)(uint32_t size);        // 0 if the size is not supported
+  void (*run)(uint32_t call);
+} Bench;
+
+typedef union
+{
+  q15_t q15[2*BENCH_MAX_FFT];
+  q31_t q31[2*BENCH_MAX_FFT];
+  float32_t f32[2*BENCH_MAX_FFT];
+} Buffer;
+
+/* Private variables ---------------------------------------------------------*/
+static const uint32_t blockSizes[] = {32, 64, 128, 256, 512, 1024, 0};
+static const uint32_t fftSizes[] = {64, 128, 256, 512, 1024, 2048, 4096, 0};
+static const uint32_t planHz[FREQ_CHANNELS] =
+{
+#define PLAN_HZ(ch, hz)  [ch - 1] = hz,
+  FREQ_PLAN(PLAN_HZ)
+};
+
+static Buffer bufA, bufB;
+static uint32_t size;
+static q15_t coeffs15[6*NUM_STAGES + NUM_TAPS], state15[NUM_TAPS + BENCH_MAX_BLOCK];
+static q31_t coeffs31[5*NUM_STAGES + NUM_TAPS], state31[NUM_TAPS + BENCH_MAX_BLOCK];
+static float32_t coeffsF[5*NUM_STAGES + NUM_TAPS], stateF[NUM_TAPS + BENCH_MAX_BLOCK];
+static q15_t bankCoeffs15[NUM_FILTERS*NUM_TAPS], filterCoeffs15[NUM_FILTERS*NUM_TAPS];
+static q31_t binCoeffs31[2*FREQ_CHANNELS];
+static float32_t binCoeffsF[2*FREQ_CHANNELS];
+static q31_t sdftCoeffs31[4*FREQ_CHANNELS];
+static float32_t sdftCoeffsF[4*FREQ_CHANNELS];
+static q15_t ddcCoeffs15[DDC_TAPS], ddcState15[2*(DDC_TAPS + BENCH_MAX_BLOCK - 1)], ddcScratch15[2*BENCH_MAX_BLOCK];
+static union
+{
+  q31_t q31[2*FREQ_CHANNELS + SDFT_WINDOW];
+  float32_t f32[2*FREQ_CHANNELS + SDFT_WINDOW];
+} sdftState;
+static union
+{
+  arm_fir_instance_q15 fir15;
+  arm_fir_instance_q31 fir31;
+  arm_fir_instance_f32 firF;
+  arm_biquad_casd_df1_inst_q15 iir15;
+  arm_biquad_casd_df1_inst_q31 iir31;
+  arm_biquad_casd_df1_inst_f32 iirF;
+  arm_fir_bank_instance_q15 firBank15;
+  arm_biquad_casd_df1_bank_inst_q15 iirBank15;
+  arm_cfft_radix2_instance_q15 r2q15[2];
+  arm_cfft_radix2_instance_q31 r2q31[2];
+  arm_cfft_radix2_instance_f32 r2f[2];
+  arm_cfft_radix4_instance_q15 r4q15[2];
+  arm_cfft_radix4_instance_q31 r4q31[2];
+  arm_cfft_radix4_instance_f32 r4f[2];
+  const arm_cfft_instance_q15* cq15;
+  const arm_cfft_instance_q31* cq31;
+  const arm_cfft_instance_f32* cf;
+  arm_rfft_instance_q15 rq15;
+  arm_rfft_instance_q31 rq31;
+  arm_rfft_fast_instance_f32 rf;
+  arm_goertzel_instance_q15 gq15;
+  arm_goertzel_instance_q31 gq31;
+  arm_goertzel_instance_f32 gf;
+  arm_sdft_instance_q31 sq31;
+  arm_sdft_instance_f32 sf;
+  arm_ddc_instance_q15 ddc15;
+} inst;
+
+static struct
+{
+  char key[48];
+  double ns;
+} baseline[MAX_BASELINE];
+static uint32_t baselines = 0;
+
+/* Private functions ---------------------------------------------------------*/
+/* test data, noise of about -6 dBFS, no denormals for f32 */
+static void fillData(void)
+{
+  uint32_t seed = 1;
+
+  for(uint32_t i = 0; i < 2*BENCH_MAX_FFT; i++)
+  {
+    seed = seed*1664525 + 1013904223;
+    bufA.q15[i] = (q15_t)((int32_t)seed >> 17);
+  }
+}
+
+static void fillQ31(void)
+{
+  for(int32_t i = 2*BENCH_MAX_FFT - 1; i >= 0; i--)bufA.q31[i] = (q31_t)bufA.q15[i] << 16;
+}
+
+static void fillF32(void)
+{
+  for(int32_t i = 2*BENCH_MAX_FFT - 1; i >= 0; i--)bufA.f32[i] = bufA.q15[i]/32768.0f;
+}
+
+/* lowpass taps and stable sections, for all types */
+static void fillCoeffs(void)
+{
+  for(int k = 0; k < NUM_TAPS; k++)
+  {
+    float32_t c = 0.5f*arm_sin_f32(PI*(k + 1)/(NUM_TAPS + 1))/NUM_TAPS;
+    coeffsF[k] = c;
+    coeffs15[k] = (q15_t)(c*32768);
+    coeffs31[k] = (q31_t)(c*2147483648.0f);
+  }
+}
+
+static void fillSections(void)
+{
+  /* b0 b1 b2 a1 a2, a1 a2 with the sign of arm_biquad_cascade_df1 */
+  static const float32_t section[5] = {0.0675f, 0.135f, 0.0675f, 1.143f, -0.4128f};
+
+  for(int s = 0; s < NUM_STAGES; s++)
+  {
+    for(int k = 0; k < 5; k++)
+    {
+      /* q formats with postShift 1, coefficients halved */
+      coeffsF[5*s + k] = section[k];
+      coeffs31[5*s + k] = (q31_t)(section[k]*0.5f*2147483648.0f);
+    }
+    coeffs15[6*s + 0] = (q15_t)(section[0]*0.5f*32768);
+    coeffs15[6*s + 1] = 0;
+    coeffs15[6*s + 2] = (q15_t)(section[1]*0.5f*32768);
+    coeffs15[6*s + 3] = (q15_t)(section[2]*0.5f*32768);
+    coeffs15[6*s + 4] = (q15_t)(section[3]*0.5f*32768);
+    coeffs15[6*s + 5] = (q15_t)(section[4]*0.5f*32768);
+  }
+}
+
+/* FIR -----------------------------------------------------------------------*/
+static int setupFirQ15(uint32_t n)
+{
+  fillData();
+  fillCoeffs();
+  return (n <= BENCH_MAX_BLOCK)&&
+         (arm_fir_init_q15(&inst.fir15, NUM_TAPS, coeffs15, state15, n) == ARM_MATH_SUCCESS);
+}
+
+static void runFirQ15(uint32_t call)
+{
+  (void)call;
+  arm_fir_q15(&inst.fir15, bufA.q15, bufB.q15, size);
+}
+
+static int setupFirQ31(uint32_t n)
+{
+  fillData();
+  fillQ31();
+  fillCoeffs();
+  arm_fir_init_q31(&inst.fir31, NUM_TAPS, coeffs31, state31, n);
+  return n <= BENCH_MAX_BLOCK;
+}
+
+static void runFirQ31(uint32_t call)
+{
+  (void)call;
+  arm_fir_q31(&inst.fir31, bufA.q31, bufB.q31, size);
+}
+
+static int setupFirF32(uint32_t n)
+{
+  fillData();
+  fillF32();
+  fillCoeffs();
+  arm_fir_init_f32(&inst.firF, NUM_TAPS, coeffsF, stateF, n);
+  return n <= BENCH_MAX_BLOCK;
+}
+
+static void runFirF32(uint32_t call)
+{
+  (void)call;
+  arm_fir_f32(&inst.firF, bufA.f32, bufB.f32, size);
+}
+
+/* biquad DF1 ----------------------------------------------------------------*/
+static int setupIirQ15(uint32_t n)
+{
+  fillData();
+  fillSections();
+  memset(state15, 0, sizeof(state15));
+  arm_biquad_cascade_df1_init_q15(&inst.iir15, NUM_STAGES, coeffs15, state15, 1);
+  return n <= BENCH_MAX_BLOCK;
+}
+
+static void runIirQ15(uint32_t call)
+{
+  (void)call;
+  arm_biquad_cascade_df1_q15(&inst.iir15, bufA.q15, bufB.q15, size);
+}
+
+static int setupIirQ31(uint32_t n)
+{
+  fillData();
+  fillQ31();
+  fillSections();
+  memset(state31, 0, sizeof(state31));
+  arm_biquad_cascade_df1_init_q31(&inst.iir31, NUM_STAGES, coeffs31, state31, 1);
+  return n <= BENCH_MAX_BLOCK;
+}
+
+static void runIirQ31(uint32_t call)
+{
+  (void)call;
+  arm_biquad_cascade_df1_q31(&inst.iir31, bufA.q31, bufB.q31, size);
+}
+
+static int setupIirF32(uint32_t n)
+{
+  fillData();
+  fillF32();
+  fillSections();
+  memset(stateF, 0, sizeof(stateF));
+  arm_biquad_cascade_df1_init_f32(&inst.iirF, NUM_STAGES, coeffsF, stateF);
+  return n <= BENCH_MAX_BLOCK;
+}
+
+static void runIirF32(uint32_t call)
+{
+  (void)call;
+  arm_biquad_cascade_df1_f32(&inst.iirF, bufA.f32, bufB.f32, size);
+}
+
+/* CFFT radix-2 and radix-4, an instance for each direction ------------------*/
+static int setupR2Q15(uint32_t n)
+{
+  fillData();
+  return (n <= BENCH_MAX_FFT)&&
+         (arm_cfft_radix2_init_q15(&inst.r2q15[0], n, 0, 1) == ARM_MATH_SUCCESS)&&
+         (arm_cfft_radix2_init_q15(&inst.r2q15[1], n, 1, 1) == ARM_MATH_SUCCESS);
+}
+
+static void runR2Q15(uint32_t call)
+{
+  arm_cfft_radix2_q15(&inst.r2q15[call & 1], bufA.q15);
+}
+
+static int setupR2Q31(uint32_t n)
+{
+  fillData();
+  fillQ31();
+  return (n <= BENCH_MAX_FFT)&&
+         (arm_cfft_radix2_init_q31(&inst.r2q31[0], n, 0, 1) == ARM_MATH_SUCCESS)&&
+         (arm_cfft_radix2_init_q31(&inst.r2q31[1], n, 1, 1) == ARM_MATH_SUCCESS);
+}
+
+static void runR2Q31(uint32_t call)
+{
+  arm_cfft_radix2_q31(&inst.r2q31[call & 1], bufA.q31);
+}
+
+static int setupR2F32(uint32_t n)
+{
+  fillData();
+  fillF32();
+  return (n <= BENCH_MAX_FFT)&&
+         (arm_cfft_radix2_init_f32(&inst.r2f[0], n, 0, 1) == ARM_MATH_SUCCESS)&&
+         (arm_cfft_radix2_init_f32(&inst.r2f[1], n, 1, 1) == ARM_MATH_SUCCESS);
+}
+
+static void runR2F32(uint32_t call)
+{
+  arm_cfft_radix2_f32(&inst.r2f[call & 1], bufA.f32);
+}
+
+static int setupR4Q15(uint32_t n)
+{
+  fillData();
+  return (n <= BENCH_MAX_FFT)&&
+         (arm_cfft_radix4_init_q15(&inst.r4q15[0], n, 0, 1) == ARM_MATH_SUCCESS)&&
+         (arm_cfft_radix4_init_q15(&inst.r4q15[1], n, 1, 1) == ARM_MATH_SUCCESS);
+}
+
+static void runR4Q15(uint32_t call)
+{
+  arm_cfft_radix4_q15(&inst.r4q15[call & 1], bufA.q15);
+}
+
+static int setupR4Q31(uint32_t n)
+{
+  fillData();
+  fillQ31();
+  return (n <= BENCH_MAX_FFT)&&
+         (arm_cfft_radix4_init_q31(&inst.r4q31[0], n, 0, 1) == ARM_MATH_SUCCESS)&&
+         (arm_cfft_radix4_init_q31(&inst.r4q31[1], n, 1, 1) == ARM_MATH_SUCCESS);
+}
+
+static void runR4Q31(uint32_t call)
+{
+  arm_cfft_radix4_q31(&inst.r4q31[call & 1], bufA.q31);
+}
+
+static int setupR4F32(uint32_t n)
+{
+  fillData();
+  fillF32();
+  return (n <= BENCH_MAX_FFT)&&
+         (arm_cfft_radix4_init_f32(&inst.r4f[0], n, 0, 1) == ARM_MATH_SUCCESS)&&
+         (arm_cfft_radix4_init_f32(&inst.r4f[1], n, 1, 1) == ARM_MATH_SUCCESS);
+}
+
+static void runR4F32(uint32_t call)
+{
+  arm_cfft_radix4_f32(&inst.r4f[call & 1], bufA.f32);
+}
+
+/* CFFT of arm_const_structs.h: radix-4 by 2 for q15/q31, radix-8 for f32 ----*/
+static int setupCfftQ15(uint32_t n)
+{
+  fillData();
+  switch(n)
+  {
+  case 64:   inst.cq15 = &arm_cfft_sR_q15_len64; break;
+  case 128:  inst.cq15 = &arm_cfft_sR_q15_len128; break;
+  case 256:  inst.cq15 = &arm_cfft_sR_q15_len256; break;
+  case 512:  inst.cq15 = &arm_cfft_sR_q15_len512; break;
+  case 1024: inst.cq15 = &arm_cfft_sR_q15_len1024; break;
+  case 2048: inst.cq15 = &arm_cfft_sR_q15_len2048; break;
+  case 4096: inst.cq15 = &arm_cfft_sR_q15_len4096; break;
+  default:   return 0;
+  }
+  return n <= BENCH_MAX_FFT;
+}
+
+static void runCfftQ15(uint32_t call)
+{
+  arm_cfft_q15(inst.cq15, bufA.q15, call & 1, 1);
+}
+
+static int setupCfftQ31(uint32_t n)
+{
+  fillData();
+  fillQ31();
+  switch(n)
+  {
+  case 64:   inst.cq31 = &arm_cfft_sR_q31_len64; break;
+  case 128:  inst.cq31 = &arm_cfft_sR_q31_len128; break;
+  case 256:  inst.cq31 = &arm_cfft_sR_q31_len256; break;
+  case 512:  inst.cq31 = &arm_cfft_sR_q31_len512; break;
+  case 1024: inst.cq31 = &arm_cfft_sR_q31_len1024; break;
+  case 2048: inst.cq31 = &arm_cfft_sR_q31_len2048; break;
+  case 4096: inst.cq31 = &arm_cfft_sR_q31_len4096; break;
+  default:   return 0;
+  }
+  return n <= BENCH_MAX_FFT;
+}
+
+static void runCfftQ31(uint32_t call)
+{
+  arm_cfft_q31(inst.cq31, bufA.q31, call & 1, 1);
+}
+
+static int setupCfftF32(uint32_t n)
+{
+  fillData();
+  fillF32();
+  switch(n)
+  {
+  case 64:   inst.cf = &arm_cfft_sR_f32_len64; break;
+  case 128:  inst.cf = &arm_cfft_sR_f32_len128; break;
+  case 256:  inst.cf = &arm_cfft_sR_f32_len256; break;
+  case 512:  inst.cf = &arm_cfft_sR_f32_len512; break;
+  case 1024: inst.cf = &arm_cfft_sR_f32_len1024; break;
+  case 2048: inst.cf = &arm_cfft_sR_f32_len2048; break;
+  case 4096: inst.cf = &arm_cfft_sR_f32_len4096; break;
+  default:   return 0;
+  }
+  return n <= BENCH_MAX_FFT;
+}
+
+static void runCfftF32(uint32_t call)
+{
+  arm_cfft_f32(inst.cf, bufA.f32, call & 1, 1);
+}
+
+/* RFFT, q formats scale down, so only forward -------------------------------*/
+static int setupRfftQ15(uint32_t n)
+{
+  fillData();
+  return (n <= BENCH_MAX_FFT)&&
+         (arm_rfft_init_q15(&inst.rq15, n, 0, 1) == ARM_MATH_SUCCESS);
+}
+
+static void runRfftQ15(uint32_t call)
+{
+  (void)call;
+  arm_rfft_q15(&inst.rq15, bufA.q15, bufB.q15);
+}
+
+static int setupRfftQ31(uint32_t n)
+{
+  fillData();
+  fillQ31();
+  return (n <= BENCH_MAX_FFT)&&
+         (arm_rfft_init_q31(&inst.rq31, n, 0, 1) == ARM_MATH_SUCCESS);
+}
+
+static void runRfftQ31(uint32_t call)
+{
+  (void)call;
+  arm_rfft_q31(&inst.rq31, bufA.q31, bufB.q31);
+}
+
+static int setupRfftF32(uint32_t n)
+{
+  fillData();
+  fillF32();
+  return (n <= BENCH_MAX_FFT)&&(arm_rfft_fast_init_f32(&inst.rf, n) == ARM_MATH_SUCCESS);
+}
+
+static void runRfftF32(uint32_t call)
+{
+  if(call & 1)arm_rfft_fast_f32(&inst.rf, bufB.f32, bufA.f32, 1);
+  else arm_rfft_fast_f32(&inst.rf, bufA.f32, bufB.f32, 0);
+}
+
+/* dot product ---------------------------------------------------------------*/
+static int setupDotQ15(uint32_t n)
+{
+  fillData();
+  memcpy(bufB.q15, bufA.q15 + 1, sizeof(bufB.q15) - sizeof(q15_t));
+  return n <= BENCH_MAX_BLOCK;
+}
+
+static void runDotQ15(uint32_t call)
+{
+  static volatile q63_t result;
+  q63_t r;
+
+  (void)call;
+  arm_dot_prod_q15(bufA.q15, bufB.q15, size, &r);
+  result = r;
+  (void)result;
+}
+
+static int setupDotQ31(uint32_t n)
+{
+  fillData();
+  fillQ31();
+  memcpy(bufB.q31, bufA.q31 + 1, sizeof(bufB.q31) - sizeof(q31_t));
+  return n <= BENCH_MAX_BLOCK;
+}
+
+static void runDotQ31(uint32_t call)
+{
+  static volatile q63_t result;
+  q63_t r;
+
+  (void)call;
+  arm_dot_prod_q31(bufA.q31, bufB.q31, size, &r);
+  result = r;
+  (void)result;
+}
+
+static int setupDotF32(uint32_t n)
+{
+  fillData();
+  fillF32();
+  memcpy(bufB.f32, bufA.f32 + 1, sizeof(bufB.f32) - sizeof(float32_t));
+  return n <= BENCH_MAX_BLOCK;
+}
+
+static void runDotF32(uint32_t call)
+{
+  static volatile float32_t result;
+  float32_t r;
+
+  (void)call;
+  arm_dot_prod_f32(bufA.f32, bufB.f32, size, &r);
+  result = r;
+  (void)result;
+}
+
+/* filter banks, the bank output of all the filters fits bufB --------------*/
+static int bankFits(uint32_t n)
+{
+  return n*NUM_FILTERS <= sizeof(bufB)/sizeof(q15_t);
+}
+
+static void fillFilters(uint32_t length)
+{
+  for(uint32_t f = 0; f < NUM_FILTERS; f++)memcpy(&filterCoeffs15[f*length], coeffs15, length*sizeof(q15_t));
+}
+
+static int setupFirBankQ15(uint32_t n)
+{
+  fillData();
+  fillCoeffs();
+  fillFilters(NUM_TAPS);
+  return bankFits(n)&&
+         (arm_fir_bank_init_q15(&inst.firBank15, NUM_FILTERS, NUM_TAPS, filterCoeffs15,
+                                bankCoeffs15, state15, n) == ARM_MATH_SUCCESS);
+}
+
+static void runFirBankQ15(uint32_t call)
+{
+  (void)call;
+  arm_fir_bank_q15(&inst.firBank15, bufA.q15, (q15_t*)&bufB, size);
+}
+
+static void runFirX35Q15(uint32_t call)
+{
+  (void)call;
+  for(uint32_t f = 0; f < NUM_FILTERS; f++)arm_fir_q15(&inst.fir15, bufA.q15, bufB.q15, size);
+}
+
+static int setupIirBankQ15(uint32_t n)
+{
+  fillData();
+  fillSections();
+  fillFilters(6*NUM_STAGES);
+  arm_biquad_cascade_df1_bank_init_q15(&inst.iirBank15, NUM_FILTERS, NUM_STAGES, filterCoeffs15,
+                                       bankCoeffs15, state15, 1);
+  return bankFits(n);
+}
+
+static void runIirBankQ15(uint32_t call)
+{
+  (void)call;
+  arm_biquad_cascade_df1_bank_q15(&inst.iirBank15, bufA.q15, (q15_t*)&bufB, size);
+}
+
+static void runIirX35Q15(uint32_t call)
+{
+  (void)call;
+  for(uint32_t f = 0; f < NUM_FILTERS; f++)arm_biquad_cascade_df1_q15(&inst.iir15, bufA.q15, bufB.q15, size);
+}
+
+/* Goertzel, all channels of the plan in one call ---------------------------*/
+static int setupGoertzelQ15(uint32_t n)
+{
+  fillData();
+  return (n <= BENCH_MAX_BLOCK)&&
+         (arm_goertzel_init_q15(&inst.gq15, FREQ_CHANNELS, binCoeffs31, planHz, GOERTZEL_RATE, n) == ARM_MATH_SUCCESS);
+}
+
+static void runGoertzelQ15(uint32_t call)
+{
+  (void)call;
+  arm_goertzel_multi_q15(&inst.gq15, bufA.q15, bufB.q31);
+}
+
+static int setupGoertzelQ31(uint32_t n)
+{
+  fillData();
+  fillQ31();
+  return (n <= BENCH_MAX_BLOCK)&&
+         (arm_goertzel_init_q31(&inst.gq31, FREQ_CHANNELS, binCoeffs31, planHz, GOERTZEL_RATE, n) == ARM_MATH_SUCCESS);
+}
+
+static void runGoertzelQ31(uint32_t call)
+{
+  (void)call;
+  arm_goertzel_multi_q31(&inst.gq31, bufA.q31, bufB.q31);
+}
+
+static int setupGoertzelF32(uint32_t n)
+{
+  fillData();
+  fillF32();
+  return (n <= BENCH_MAX_BLOCK)&&
+         (arm_goertzel_init_f32(&inst.gf, FREQ_CHANNELS, binCoeffsF, planHz, GOERTZEL_RATE, n) == ARM_MATH_SUCCESS);
+}
+
+static void runGoertzelF32(uint32_t call)
+{
+  (void)call;
+  arm_goertzel_multi_f32(&inst.gf, bufA.f32, bufB.f32);
+}
+
+static int setupSdftQ31(uint32_t n)
+{
+  fillData();
+  fillQ31();
+  return (n <= BENCH_MAX_BLOCK)&&
+         (arm_sdft_init_q31(&inst.sq31, FREQ_CHANNELS, sdftCoeffs31, planHz, GOERTZEL_RATE, SDFT_WINDOW,
+                            sdftState.q31) == ARM_MATH_SUCCESS);
+}
+
+static void runSdftQ31(uint32_t call)
+{
+  (void)call;
+  arm_sdft_q31(&inst.sq31, bufA.q31, bufB.q31, size);
+}
+
+static int setupSdftF32(uint32_t n)
+{
+  fillData();
+  fillF32();
+  return (n <= BENCH_MAX_BLOCK)&&
+         (arm_sdft_init_f32(&inst.sf, FREQ_CHANNELS, sdftCoeffsF, planHz, GOERTZEL_RATE, SDFT_WINDOW,
+                            sdftState.f32) == ARM_MATH_SUCCESS);
+}
+
+static void runSdftF32(uint32_t call)
+{
+  (void)call;
+  arm_sdft_f32(&inst.sf, bufA.f32, bufB.f32, size);
+}
+
+/* down converter, mixer and decimating lowpass -----------------------------*/
+static int setupDdcQ15(uint32_t n)
+{
+  fillData();
+  for(int k = 0; k < DDC_TAPS; k++)
+  {
+    ddcCoeffs15[k] = (q15_t)(0.5f*arm_sin_f32(PI*(k + 1)/(DDC_TAPS + 1))/DDC_TAPS*32768);
+  }
+  return (n <= BENCH_MAX_BLOCK)&&
+         (arm_ddc_init_q15(&inst.ddc15, DDC_TAPS, DDC_DECIMATION, ddcCoeffs15, DDC_CENTER, GOERTZEL_RATE,
+                           ddcState15, ddcScratch15, n) == ARM_MATH_SUCCESS);
+}
+
+static void runDdcQ15(uint32_t call)
+{
+  (void)call;
+  arm_ddc_q15(&inst.ddc15, bufA.q15, bufB.q15, size);
+}
+
+static const Bench bench[] =
+{
+  {"fir32",        "q15", blockSizes, setupFirQ15,  runFirQ15},
+  {"fir32",        "q31", blockSizes, setupFirQ31,  runFirQ31},
+  {"fir32",        "f32", blockSizes, setupFirF32,  runFirF32},
+  {"biquad3_df1",  "q15", blockSizes, setupIirQ15,  runIirQ15},
+  {"biquad3_df1",  "q31", blockSizes, setupIirQ31,  runIirQ31},
+  {"biquad3_df1",  "f32", blockSizes, setupIirF32,  runIirF32},
+  {"cfft_radix2",  "q15", fftSizes,   setupR2Q15,   runR2Q15},
+  {"cfft_radix2",  "q31", fftSizes,   setupR2Q31,   runR2Q31},
+  {"cfft_radix2",  "f32", fftSizes,   setupR2F32,   runR2F32},
+  {"cfft_radix4",  "q15", fftSizes,   setupR4Q15,   runR4Q15},
+  {"cfft_radix4",  "q31", fftSizes,   setupR4Q31,   runR4Q31},
+  {"cfft_radix4",  "f32", fftSizes,   setupR4F32,   runR4F32},
+  {"cfft_mixed",   "q15", fftSizes,   setupCfftQ15, runCfftQ15},
+  {"cfft_mixed",   "q31", fftSizes,   setupCfftQ31, runCfftQ31},
+  {"cfft_radix8",  "f32", fftSizes,   setupCfftF32, runCfftF32},
+  {"rfft",         "q15", fftSizes,   setupRfftQ15, runRfftQ15},
+  {"rfft",         "q31", fftSizes,   setupRfftQ31, runRfftQ31},
+  {"rfft_fast",    "f32", fftSizes,   setupRfftF32, runRfftF32},
+  {"dot_prod",     "q15", blockSizes, setupDotQ15,  runDotQ15},
+  {"dot_prod",     "q31", blockSizes, setupDotQ31,  runDotQ31},
+  {"dot_prod",     "f32", blockSizes, setupDotF32,  runDotF32},
+  {"fir32_bank35", "q15", blockSizes, setupFirBankQ15, runFirBankQ15},
+  {"fir32_x35",    "q15", blockSizes, setupFirQ15,  runFirX35Q15},
+  {"biquad3_bank35", "q15", blockSizes, setupIirBankQ15, runIirBankQ15},
+  {"biquad3_x35",  "q15", blockSizes, setupIirQ15,  runIirX35Q15},
+  {"goertzel35",   "q15", blockSizes, setupGoertzelQ15, runGoertzelQ15},
+  {"goertzel35",   "q31", blockSizes, setupGoertzelQ31, runGoertzelQ31},
+  {"goertzel35",   "f32", blockSizes, setupGoertzelF32, runGoertzelF32},
+  {"sdft35",       "q31", blockSizes, setupSdftQ31, runSdftQ31},
+  {"sdft35",       "f32", blockSizes, setupSdftF32, runSdftF32},
+  {"ddc64_m8",     "q15", blockSizes, setupDdcQ15,  runDdcQ15},
+};
+
+#if defined(ARM_MATH_HOST)
+
+static double now(void)
+{
+  struct timespec t;
+
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return t.tv_sec + t.tv_nsec*1e-9;
+}
+
+/* ns per call, best of REPEATS runs of at least minTime */
+static double measure(const Bench* b, double minTime)
+{
+  uint32_t calls = 1;
+  double best = 0;
+
+  /* calls of one run, also warms the caches */
+  for(;;)
+  {
+    double start = now(), t;
+
+    for(uint32_t i = 0; i < calls; i++)b->run(i);
+    t = now() - start;
+    if(t >= minTime)break;
+    calls = (t < minTime/64) ? calls*8 : (uint32_t)(calls*1.2*minTime/t) + 1;
+  }
+  for(int r = 0; r < REPEATS; r++)
+  {
+    double start = now(), t;
+
+    for(uint32_t i = 0; i < calls; i++)b->run(i);
+    t = (now() - start)/calls;
+    if((r == 0)||(t < best))best = t;
+  }
+  return best*1e9;
+}
+
+static void loadBaseline(const char* name)
+{
+  FILE* f = fopen(name, "r");
+  char line[256];
+
+  if(f == NULL)
+  {
+    perror(name);
+    exit(1);
+  }
+  while((fgets(line, sizeof(line), f) != NULL)&&(baselines < MAX_BASELINE))
+  {
+    char kernel[24], type[8], simd[16];
+    unsigned n;
+    double ns;
+
+    if(sscanf(line, "%23[^,],%7[^,],%u,%15[^,],%lf", kernel, type, &n, simd, &ns) != 5)continue;
+    snprintf(baseline[baselines].key, sizeof(baseline[0].key), "%s,%s,%u", kernel, type, n);
+    baseline[baselines++].ns = ns;
+  }
+  fclose(f);
+}
+
+static int findBaseline(const char* key)
+{
+  for(uint32_t i = 0; i < baselines; i++)
+  {
+    if(strcmp(baseline[i].key, key) == 0)return (int)i;
+  }
+  return -1;
+}
+
+static int selected(const Bench* b, int argc, char* argv[], int first)
+{
+  if(first == argc)return 1;
+  for(int i = first; i < argc; i++)
+  {
+    if(strncmp(b->kernel, argv[i], strlen(argv[i])) == 0)return 1;
+  }
+  return 0;
+}
+
+static void usage(void)
+{
+  fprintf(stderr, "usage: dspbench [-t seconds] [-c baseline.csv] [-r percent] [kernel ...]\n");
+  exit(1);
+}
+
+int main(int argc, char* argv[])
+{
+  double minTime = 0.05, limit = 10;
+  const char* simd = "none";
+  int i = 1, slower = 0;
+
+  for(; (i + 1 < argc)&&(argv[i][0] == '-'); i += 2)
+  {
+    if(strcmp(argv[i], "-t") == 0)minTime = atof(argv[i + 1]);
+    else if(strcmp(argv[i], "-c") == 0)loadBaseline(argv[i + 1]);
+    else if(strcmp(argv[i], "-r") == 0)limit = atof(argv[i + 1]);
+    else usage();
+  }
+  if((i < argc)&&(argv[i][0] == '-'))usage();
+#if defined(ARM_MATH_HOST_SIMD)
+  simd = arm_host_simd_name(arm_host_simd_get());
+#endif
+  printf("kernel,type,size,simd,ns_per_call,msamples_per_s%s\n",
+         baselines ? ",baseline_ns,change_pct" : "");
+  for(uint32_t k = 0; k < sizeof(bench)/sizeof(bench[0]); k++)
+  {
+    const Bench* b = &bench[k];
+
+    if(!selected(b, argc, argv, i))continue;
+    for(const uint32_t* n = b->sizes; *n != 0; n++)
+    {
+      char key[48];
+      double ns;
+      int base;
+
+      size = *n;
+      if(!b->setup(size))continue;
+      ns = measure(b, minTime);
+      snprintf(key, sizeof(key), "%s,%s,%u", b->kernel, b->type, (unsigned)size);
+      printf("%s,%s,%.1f,%.2f", key, simd, ns, size*1e3/ns);
+      base = findBaseline(key);
+      if(base >= 0)
+      {
+        double change = (ns/baseline[base].ns - 1)*100;
+
+        printf(",%.1f,%+.1f", baseline[base].ns, change);
+        if(change > limit)slower++;
+      }
+      else if(baselines)printf(",,");
+      printf("\n");
+      fflush(stdout);
+    }
+  }
+  if(baselines)fprintf(stderr, "%d kernels slower by more than %.0f%%\n", slower, limit);
+  return slower;
+}
+
+#else /* Cortex-M3 */
+
+/* DWT cycle counter of the core */
+static void startCycles(void)
+{
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CYCCNT = 0;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+int main(void)
+{
+  startCycles();
+  printf("kernel,type,size,cycles_per_call,cycles_per_sample\n");
+  for(uint32_t k = 0; k < sizeof(bench)/sizeof(bench[0]); k++)
+  {
+    const Bench* b = &bench[k];
+
+    for(const uint32_t* n = b->sizes; *n != 0; n++)
+    {
+      uint32_t start, cycles;
+
+      size = *n;
+      if(!b->setup(size))continue;
+      b->run(0);
+      start = DWT->CYCCNT;
+      for(uint32_t i = 0; i < BENCH_CALLS; i++)b->run(i);
+      cycles = (DWT->CYCCNT - start)/BENCH_CALLS;
+      printf("%s,%s,%u,%u,%u.%02u\n", b->kernel, b->type, (unsigned)size, (unsigned)cycles,
+             (unsigned)(cycles/size), (unsigned)(cycles*100/size % 100));
+    }
+  }
+  for(;;);
+}
+
+#endif /* ARM_MATH_HOST */
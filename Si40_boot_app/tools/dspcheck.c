@@ -0,0 +1,217 @@
+/**
+  ******************************************************************************
+  * @file    dspcheck.c
+  * @author  AKabanov
+  * @brief   host check of the ARM_MATH_HOST profile of CMSIS-DSP
+  *          (common/Drivers/CMSIS/Include/cmsis_host.h)
+  ******************************************************************************
+  * build:  D=../common/Drivers/CMSIS/DSP_Lib/Source
+  *         gcc -O2 -DARM_MATH_HOST -fno-strict-aliasing -fwrapv
+  *             -I../common/Drivers/CMSIS/Include -o dspcheck dspcheck.c
+  *             $D/FilteringFunctions/arm_fir_q15.c
+  *             $D/FilteringFunctions/arm_fir_init_q15.c
+  *             $D/FilteringFunctions/arm_biquad_cascade_df1_q15.c
+  *             $D/FilteringFunctions/arm_biquad_cascade_df1_init_q15.c
+  *             $D/BasicMathFunctions/arm_dot_prod_q31.c
+  * usage:  dspcheck [-n count]       count random operands, 1000000 default
+  *
+  * The host build differs from the Cortex-M3 build only in the core
+  * instructions of cmsis_host.h, the packed SIMD ones are C of arm_math.h
+  * in both. They are checked against the instruction definitions of the
+  * ARMv7-M Architecture Reference Manual (SSAT, USAT, CLZ, ROR) on all
+  * saturation positions, the edges and random operands. The kernels are
+  * checked against plain C models of the Cortex-M3 arithmetic (Q15 FIR with
+  * 64 bit accumulator, DF1 biquad with Q31 accumulator and post shift, Q31
+  * dot product in 16.48), so a broken intrinsic shows up in the result.
+  * Exit code is the number of failed checks.
+  ******************************************************************************
+  */
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "arm_math.h"
+
+/* Private define ------------------------------------------------------------*/
+#define NUM_TAPS        32
+#define BLOCK_SIZE      64
+#define BLOCKS          16
+#define STAGES          3
+#define POST_SHIFT      1
+#define DOT_LEN         1000
+
+/* Private variables ---------------------------------------------------------*/
+static uint32_t seed = 1;
+static unsigned failed = 0;
+
+/* Private functions ---------------------------------------------------------*/
+static uint32_t rnd(void)
+{
+  seed ^= seed << 13;
+  seed ^= seed >> 17;
+  seed ^= seed << 5;
+  return seed;
+}
+
+/* random operand with many edge values */
+static int32_t operand(void)
+{
+  static const int32_t edge[] = {0, 1, -1, 0x7FFFFFFF, (int32_t)0x80000000,
+                                 0x7FFF, -0x8000, 0x8000, -0x8001, 0xFFFF};
+  uint32_t r = rnd();
+
+  if((r & 7) == 0)return edge[rnd() % (sizeof(edge)/sizeof(edge[0]))];
+  return (int32_t)rnd() >> (r % 32);
+}
+
+static void check(const char* name, int ok)
+{
+  if(!ok)
+  {
+    printf("FAIL %s\n", name);
+    failed++;
+  }
+}
+
+/* ARMv7-M ARM SignedSatQ(), UnsignedSatQ() */
+static int64_t refSsat(int64_t x, unsigned n)
+{
+  int64_t max = (1LL << (n - 1)) - 1, min = -(1LL << (n - 1));
+
+  return (x > max) ? max : (x < min) ? min : x;
+}
+
+static int64_t refUsat(int64_t x, unsigned n)
+{
+  int64_t max = (1LL << n) - 1;
+
+  return (x > max) ? max : (x < 0) ? 0 : x;
+}
+
+static void checkInstructions(uint32_t count)
+{
+  int okSsat = 1, okUsat = 1, okClz = 1, okRor = 1;
+
+  for(uint32_t i = 0; i < count; i++)
+  {
+    int32_t x = operand();
+    uint32_t u = (uint32_t)x;
+    unsigned n = 1 + i % 32;
+
+    /* saturation position is a constant in the library, the C is the same */
+    if(__SSAT(x, n) != (int32_t)refSsat(x, n))okSsat = 0;
+    if(__USAT(x, n - 1) != (uint32_t)refUsat(x, n - 1))okUsat = 0;
+    if(__ROR(u, n - 1) != (uint32_t)(((uint64_t)u << 32 | u) >> (n - 1)))okRor = 0;
+  }
+  for(unsigned bit = 0; bit < 32; bit++)
+  {
+    uint32_t u = 1U << bit;
+
+    if((__CLZ(u) != 31 - bit)||(__CLZ(u | (u - 1)) != 31 - bit))okClz = 0;
+  }
+  if(__CLZ(0) != 32)okClz = 0;
+  check("__SSAT", okSsat);
+  check("__USAT", okUsat);
+  check("__CLZ", okClz);
+  check("__ROR", okRor);
+}
+
+static void checkFir(void)
+{
+  static q15_t coeffs[NUM_TAPS], state[NUM_TAPS + BLOCK_SIZE - 1];
+  static q15_t in[BLOCK_SIZE*BLOCKS], out[BLOCK_SIZE*BLOCKS];
+  arm_fir_instance_q15 fir;
+  int ok = 1;
+
+  /* arm_fir_q15 wants an even number of taps, coefficients time reversed */
+  for(int k = 0; k < NUM_TAPS; k++)coeffs[k] = (q15_t)operand();
+  for(int k = 0; k < BLOCK_SIZE*BLOCKS; k++)in[k] = (q15_t)operand();
+  arm_fir_init_q15(&fir, NUM_TAPS, coeffs, state, BLOCK_SIZE);
+  for(int b = 0; b < BLOCKS; b++)
+  {
+    arm_fir_q15(&fir, in + b*BLOCK_SIZE, out + b*BLOCK_SIZE, BLOCK_SIZE);
+  }
+  for(int n = 0; n < BLOCK_SIZE*BLOCKS; n++)
+  {
+    q63_t acc = 0;
+
+    for(int k = 0; k < NUM_TAPS; k++)
+    {
+      if(n - k >= 0)acc += (q31_t)coeffs[NUM_TAPS - 1 - k]*in[n - k];
+    }
+    if(out[n] != (q15_t)refSsat(acc >> 15, 16))ok = 0;
+  }
+  check("arm_fir_q15", ok);
+}
+
+static void checkBiquad(void)
+{
+  static q15_t coeffs[6*STAGES], state[4*STAGES], in[BLOCK_SIZE*BLOCKS];
+  static q15_t out[BLOCK_SIZE*BLOCKS], ref[BLOCK_SIZE*BLOCKS];
+  q15_t x1[STAGES] = {0}, x2[STAGES] = {0}, y1[STAGES] = {0}, y2[STAGES] = {0};
+  arm_biquad_casd_df1_inst_q15 iir;
+
+  /* b0 0 b1 b2 a1 a2, stable low gain sections */
+  for(int s = 0; s < STAGES; s++)
+  {
+    q15_t* c = &coeffs[6*s];
+    c[0] = 0x0800 + (rnd() & 0x3FF);
+    c[1] = 0;
+    c[2] = (q15_t)(rnd() & 0x0FFF);
+    c[3] = (q15_t)(rnd() & 0x07FF);
+    c[4] = 0x3000 + (rnd() & 0x0FFF);
+    c[5] = -0x1800 - (q15_t)(rnd() & 0x07FF);
+  }
+  for(int k = 0; k < BLOCK_SIZE*BLOCKS; k++)in[k] = (q15_t)operand();
+  arm_biquad_cascade_df1_init_q15(&iir, STAGES, coeffs, state, POST_SHIFT);
+  for(int b = 0; b < BLOCKS; b++)
+  {
+    arm_biquad_cascade_df1_q15(&iir, in + b*BLOCK_SIZE, out + b*BLOCK_SIZE, BLOCK_SIZE);
+  }
+  memcpy(ref, in, sizeof(ref));
+  for(int s = 0; s < STAGES; s++)
+  {
+    const q15_t* c = &coeffs[6*s];
+    for(int n = 0; n < BLOCK_SIZE*BLOCKS; n++)
+    {
+      q63_t acc = (q31_t)c[0]*ref[n] + (q31_t)c[2]*x1[s] + (q31_t)c[3]*x2[s] +
+                  (q31_t)c[4]*y1[s] + (q31_t)c[5]*y2[s];
+      q15_t y = (q15_t)refSsat((q31_t)(acc >> (15 - POST_SHIFT)), 16);
+
+      x2[s] = x1[s];
+      x1[s] = ref[n];
+      y2[s] = y1[s];
+      y1[s] = y;
+      ref[n] = y;
+    }
+  }
+  check("arm_biquad_cascade_df1_q15", memcmp(out, ref, sizeof(out)) == 0);
+}
+
+static void checkDot(void)
+{
+  static q31_t a[DOT_LEN], b[DOT_LEN];
+  q63_t result, acc = 0;
+
+  for(int k = 0; k < DOT_LEN; k++)
+  {
+    a[k] = operand();
+    b[k] = operand();
+  }
+  arm_dot_prod_q31(a, b, DOT_LEN, &result);
+  for(int k = 0; k < DOT_LEN; k++)acc += ((q63_t)a[k]*b[k]) >> 14;
+  check("arm_dot_prod_q31", result == acc);
+}
+
+int main(int argc, char* argv[])
+{
+  uint32_t count = 1000000;
+
+  if((argc > 2)&&(strcmp(argv[1], "-n") == 0))count = strtoul(argv[2], NULL, 0);
+  checkInstructions(count);
+  checkFir();
+  checkBiquad();
+  checkDot();
+  printf("%u checks failed\n", failed);
+  return (int)failed;
+}
@@ -0,0 +1,279 @@
+/**
+  ******************************************************************************
+  * @file    dsptables.c
+  * @author  AKabanov
+  * @brief   host report of the CMSIS-DSP FFT tables of a configuration and
+  *          generator of the RFFT coefficient tables of one length
+  ******************************************************************************
+  * build:  D=../common/Drivers/CMSIS/DSP_Lib/Source
+  *         gcc -O2 -DARM_MATH_HOST -fno-strict-aliasing -fwrapv
+  *             -I../common/Drivers/CMSIS/Include -I$D/TransformFunctions
+  *             -o dsptables dsptables.c
+  *             $D/TransformFunctions/arm_cfft_radix4_init_f32.c
+  *             $D/CommonTables/arm_common_tables.c
+  *             $D/CommonTables/arm_const_structs.c
+  *             $D/CommonTables/arm_rfft_tables.c
+  * usage:  dsptables                  tables of the configuration and bytes
+  *         dsptables -g               arm_rfft_tables.c to stdout
+  *
+  * The configuration is the defines of the build (arm_common_tables.h),
+  * e.g. add -DARM_DSP_CONFIG_TABLES -DARM_FFT_RFFT_Q15_512 to the build line
+  * for the tables of a 512 point Q15 RFFT. Without ARM_DSP_CONFIG_TABLES
+  * all the tables are built. The report lists the tables the configuration
+  * links (they are weak here, a table that is not built is NULL), their
+  * bytes (of the host, the arm_cfft_instance_* are 12 bytes on the target)
+  * and the bytes saved against all the tables. Counted are the tables
+  * of CommonTables and the A and B tables of arm_rfft_init_*(); the DCT4
+  * tables of arm_dct4_init_*() are per length as well but not counted.
+  *
+  * -g (a build without ARM_DSP_CONFIG_TABLES) writes the A and B tables of
+  * every length of arm_rfft_init_f32/q31/q15() as every (8192/N)-th entry
+  * of the tables of 8192 in those files, so they are the same numbers, and
+  * checks that the text reads back to the same values.
+  ******************************************************************************
+  */
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "arm_math.h"
+#include "arm_common_tables.h"
+#include "arm_const_structs.h"
+#if defined(ARM_ALL_FFT_TABLES)
+/* the static tables of 8192 */
+#include "arm_rfft_init_f32.c"
+#undef ARM_RFFT_COEF
+#include "arm_rfft_init_q31.c"
+#undef ARM_RFFT_COEF
+#include "arm_rfft_init_q15.c"
+#endif
+
+/* Private define ------------------------------------------------------------*/
+#define FULL_RFFT_BYTES (2u*8192u*(sizeof(float32_t) + sizeof(q31_t) + sizeof(q15_t)))
+
+#define COMMON_TABLES(X) \
+  X(armBitRevTable) \
+  X(twiddleCoef_16) X(twiddleCoef_32) X(twiddleCoef_64) X(twiddleCoef_128) X(twiddleCoef_256) \
+  X(twiddleCoef_512) X(twiddleCoef_1024) X(twiddleCoef_2048) X(twiddleCoef_4096) \
+  X(twiddleCoef_16_q31) X(twiddleCoef_32_q31) X(twiddleCoef_64_q31) X(twiddleCoef_128_q31) \
+  X(twiddleCoef_256_q31) X(twiddleCoef_512_q31) X(twiddleCoef_1024_q31) X(twiddleCoef_2048_q31) \
+  X(twiddleCoef_4096_q31) \
+  X(twiddleCoef_16_q15) X(twiddleCoef_32_q15) X(twiddleCoef_64_q15) X(twiddleCoef_128_q15) \
+  X(twiddleCoef_256_q15) X(twiddleCoef_512_q15) X(twiddleCoef_1024_q15) X(twiddleCoef_2048_q15) \
+  X(twiddleCoef_4096_q15) \
+  X(armBitRevIndexTable16) X(armBitRevIndexTable32) X(armBitRevIndexTable64) \
+  X(armBitRevIndexTable128) X(armBitRevIndexTable256) X(armBitRevIndexTable512) \
+  X(armBitRevIndexTable1024) X(armBitRevIndexTable2048) X(armBitRevIndexTable4096) \
+  X(armBitRevIndexTable_fixed_16) X(armBitRevIndexTable_fixed_32) X(armBitRevIndexTable_fixed_64) \
+  X(armBitRevIndexTable_fixed_128) X(armBitRevIndexTable_fixed_256) X(armBitRevIndexTable_fixed_512) \
+  X(armBitRevIndexTable_fixed_1024) X(armBitRevIndexTable_fixed_2048) X(armBitRevIndexTable_fixed_4096) \
+  X(twiddleCoef_rfft_32) X(twiddleCoef_rfft_64) X(twiddleCoef_rfft_128) X(twiddleCoef_rfft_256) \
+  X(twiddleCoef_rfft_512) X(twiddleCoef_rfft_1024) X(twiddleCoef_rfft_2048) X(twiddleCoef_rfft_4096) \
+  X(arm_cfft_sR_f32_len16) X(arm_cfft_sR_f32_len32) X(arm_cfft_sR_f32_len64) X(arm_cfft_sR_f32_len128) \
+  X(arm_cfft_sR_f32_len256) X(arm_cfft_sR_f32_len512) X(arm_cfft_sR_f32_len1024) \
+  X(arm_cfft_sR_f32_len2048) X(arm_cfft_sR_f32_len4096) \
+  X(arm_cfft_sR_q31_len16) X(arm_cfft_sR_q31_len32) X(arm_cfft_sR_q31_len64) X(arm_cfft_sR_q31_len128) \
+  X(arm_cfft_sR_q31_len256) X(arm_cfft_sR_q31_len512) X(arm_cfft_sR_q31_len1024) \
+  X(arm_cfft_sR_q31_len2048) X(arm_cfft_sR_q31_len4096) \
+  X(arm_cfft_sR_q15_len16) X(arm_cfft_sR_q15_len32) X(arm_cfft_sR_q15_len64) X(arm_cfft_sR_q15_len128) \
+  X(arm_cfft_sR_q15_len256) X(arm_cfft_sR_q15_len512) X(arm_cfft_sR_q15_len1024) \
+  X(arm_cfft_sR_q15_len2048) X(arm_cfft_sR_q15_len4096)
+
+/* tables of one length, instead of the static ones of 8192 */
+#define RFFT_TABLES(X) \
+  X(realCoefA_128) X(realCoefB_128) X(realCoefA_512) X(realCoefB_512) \
+  X(realCoefA_2048) X(realCoefB_2048) X(realCoefA_8192) X(realCoefB_8192) \
+  X(realCoefAQ31_32) X(realCoefBQ31_32) X(realCoefAQ31_64) X(realCoefBQ31_64) \
+  X(realCoefAQ31_128) X(realCoefBQ31_128) X(realCoefAQ31_256) X(realCoefBQ31_256) \
+  X(realCoefAQ31_512) X(realCoefBQ31_512) X(realCoefAQ31_1024) X(realCoefBQ31_1024) \
+  X(realCoefAQ31_2048) X(realCoefBQ31_2048) X(realCoefAQ31_4096) X(realCoefBQ31_4096) \
+  X(realCoefAQ31_8192) X(realCoefBQ31_8192) \
+  X(realCoefAQ15_32) X(realCoefBQ15_32) X(realCoefAQ15_64) X(realCoefBQ15_64) \
+  X(realCoefAQ15_128) X(realCoefBQ15_128) X(realCoefAQ15_256) X(realCoefBQ15_256) \
+  X(realCoefAQ15_512) X(realCoefBQ15_512) X(realCoefAQ15_1024) X(realCoefBQ15_1024) \
+  X(realCoefAQ15_2048) X(realCoefBQ15_2048) X(realCoefAQ15_4096) X(realCoefBQ15_4096) \
+  X(realCoefAQ15_8192) X(realCoefBQ15_8192)
+
+#define WEAK(name)      extern __typeof__(name) name __attribute__((weak));
+#define ENTRY(name)     {#name, (const void*)&name, sizeof(name)},
+
+/* Private typedef -----------------------------------------------------------*/
+typedef struct
+{
+  const char* name;
+  const void* table;                  // NULL if not built
+  uint32_t bytes;
+} Table;
+
+typedef enum
+{
+  TYPE_F32,
+  TYPE_Q31,
+  TYPE_Q15
+} Type;
+
+/* Private variables ---------------------------------------------------------*/
+COMMON_TABLES(WEAK)
+RFFT_TABLES(WEAK)
+
+static const Table common[] = {COMMON_TABLES(ENTRY)};
+#if !defined(ARM_ALL_FFT_TABLES)
+static const Table rfft[] = {RFFT_TABLES(ENTRY)};
+#endif
+
+/* Private functions ---------------------------------------------------------*/
+static uint32_t report(const Table* t, uint32_t num)
+{
+  uint32_t bytes = 0;
+
+  for(uint32_t i = 0; i < num; i++)
+  {
+    if(t[i].table == NULL)continue;
+    printf("  %-32s %7u\n", t[i].name, (unsigned)t[i].bytes);
+    bytes += t[i].bytes;
+  }
+  return bytes;
+}
+
+#if defined(ARM_ALL_FFT_TABLES)
+/* value i of the table of length n, entry i*(8192/n) of the full one */
+static int format(char* s, Type type, const void* full, uint32_t n, uint32_t i)
+{
+  uint32_t j = 2u*(i/2u)*(8192u/n) + (i & 1u);
+
+  switch(type)
+  {
+  case TYPE_F32:
+    {
+      float32_t v = ((const float32_t*)full)[j];
+      sprintf(s, "%.9g", v);
+      if(strpbrk(s, ".e") == NULL)strcat(s, ".0");   // 0f is no literal
+      int ok = (strtof(s, NULL) == v);
+      strcat(s, "f");
+      return ok;
+    }
+  case TYPE_Q31:
+    {
+      q31_t v = ((const q31_t*)full)[j];
+      sprintf(s, "0x%08x", (unsigned)v);
+      return (q31_t)strtoul(s, NULL, 16) == v;
+    }
+  default:
+    {
+      q15_t v = ((const q15_t*)full)[j];
+      sprintf(s, "0x%04x", (unsigned)(uint16_t)v);
+      return (q15_t)strtoul(s, NULL, 16) == v;
+    }
+  }
+}
+
+static int table(Type type, const char* name, const void* full, uint32_t n)
+{
+  static const char* const cType[] = {"float32_t", "q31_t", "q15_t ALIGN4"};
+  static const uint32_t perLine[] = {4, 4, 8};
+  char s[32];
+  int ok = 1;
+
+  printf("const %s %s_%u[%u] ARM_TABLE_SECTION(%s_%u) = {\n", cType[type], name, (unsigned)n, (unsigned)n,
+         name, (unsigned)n);
+  for(uint32_t i = 0; i < n; i++)
+  {
+    ok &= format(s, type, full, n, i);
+    printf("%s%s,%s", (i % perLine[type] == 0) ? "    " : " ", s,
+           ((i + 1) % perLine[type] == 0) ? "\n" : "");
+  }
+  printf("};\n");
+  return ok;
+}
+
+static int generate(void)
+{
+  static const struct
+  {
+    Type type;
+    const char* suffix;
+    const void* a;
+    const void* b;
+    uint32_t first;                   // shortest RFFT
+  } set[] =
+  {
+    {TYPE_F32, "F32", realCoefA, realCoefB, 128},
+    {TYPE_Q31, "Q31", realCoefAQ31, realCoefBQ31, 32},
+    {TYPE_Q15, "Q15", realCoefAQ15, realCoefBQ15, 32}
+  };
+  int ok = 1;
+
+  printf("/* ----------------------------------------------------------------------\n"
+         "* $Date:        19. October 2026\n"
+         "*\n"
+         "* Project:      CMSIS DSP Library\n"
+         "* Title:        arm_rfft_tables.c\n"
+         "*\n"
+         "* Description:  A and B coefficients of arm_rfft_init_f32/q31/q15() of\n"
+         "*               one RFFT length, made by tools/dsptables -g\n"
+         "*\n"
+         "* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0\n"
+         "* -------------------------------------------------------------------- */\n"
+         "\n"
+         "#include \"arm_math.h\"\n"
+         "#include \"arm_common_tables.h\"\n"
+         "\n"
+         "/* Table of length N holds the N/2 complex values of the RFFT of N, that\n"
+         "   is every (8192/N)-th value of the table of 8192 of arm_rfft_init_*.c,\n"
+         "   the one arm_rfft_init_*() uses when all the tables are built. These\n"
+         "   are built only for the lengths of ARM_DSP_CONFIG_TABLES. */\n");
+  for(uint32_t k = 0; k < sizeof(set)/sizeof(set[0]); k++)
+  {
+    const char* sfx = (set[k].type == TYPE_F32) ? "" : set[k].suffix;
+    char a[16], b[16];
+
+    sprintf(a, "realCoefA%s", sfx);
+    sprintf(b, "realCoefB%s", sfx);
+    for(uint32_t n = set[k].first; n <= 8192u; n *= (set[k].type == TYPE_F32) ? 4u : 2u)
+    {
+      printf("\n#if defined(ARM_TABLE_REALCOEF_%s_%u)\n", set[k].suffix, (unsigned)n);
+      ok &= table(set[k].type, a, set[k].a, n);
+      printf("\n");
+      ok &= table(set[k].type, b, set[k].b, n);
+      printf("#endif\n");
+    }
+  }
+  if(!ok)fprintf(stderr, "dsptables: values do not read back\n");
+  return ok ? 0 : 1;
+}
+#endif
+
+int main(int argc, char* argv[])
+{
+  uint32_t all = FULL_RFFT_BYTES, built;
+
+  if((argc > 1)&&(strcmp(argv[1], "-g") == 0))
+  {
+#if defined(ARM_ALL_FFT_TABLES)
+    return generate();
+#else
+    fprintf(stderr, "dsptables: -g needs a build without ARM_DSP_CONFIG_TABLES\n");
+    return 1;
+#endif
+  }
+  if(argc > 1)
+  {
+    fprintf(stderr, "usage: dsptables [-g]\n");
+    return 1;
+  }
+
+  for(uint32_t i = 0; i < sizeof(common)/sizeof(common[0]); i++)all += common[i].bytes;
+#if defined(ARM_ALL_FFT_TABLES)
+  printf("all FFT tables\n");
+  built = report(common, sizeof(common)/sizeof(common[0]));
+  printf("  %-32s %7u\n", "realCoef* of 8192, f32 q31 q15", (unsigned)FULL_RFFT_BYTES);
+  built += FULL_RFFT_BYTES;
+#else
+  printf("ARM_DSP_CONFIG_TABLES\n");
+  built = report(common, sizeof(common)/sizeof(common[0]));
+  built += report(rfft, sizeof(rfft)/sizeof(rfft[0]));
+#endif
+  printf("built %u of %u bytes, saved %u (%.1f %%)\n", (unsigned)built, (unsigned)all,
+         (unsigned)(all - built), 100.0*(all - built)/all);
+  return 0;
+}
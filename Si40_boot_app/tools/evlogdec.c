@@ -0,0 +1,124 @@
+/**
+  ******************************************************************************
+  * @file    evlogdec.c
+  * @author  AKabanov
+  * @brief   host decoder of the event log sent by bootloader 'e' command
+  ******************************************************************************
+  * build:  gcc -O2 -o evlogdec evlogdec.c
+  * usage:  evlogdec capture.bin > log.csv
+  *         evlogdec < capture.bin
+  *
+  * Capture is the raw byte stream of the terminal (binary capture, not
+  * text log). The first dump is found by its sync word, so echo and text
+  * before it are skipped. One CSV line per entry, oldest first; the
+  * entries with wrong CRC are kept with crc_ok = 0 (see common/evlog.h).
+  * A wake of a sleep chain without ping (logged only after a reset) has
+  * sensor and mode "-".
+  ******************************************************************************
+  */
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+
+/* Private define ------------------------------------------------------------*/
+#define EVLOG_SYNC      0xA55A
+#define EVLOG_SIZE      126
+#define ENTRY_BYTES     8
+#define CRC8_POLY       0x07
+#define STATE_NO_PING   0x08          // EVLOG_STATE_NO_PING
+#define MAX_CAPTURE     (64*1024)
+
+/* Private variables ---------------------------------------------------------*/
+static uint8_t capture[MAX_CAPTURE];
+static const char* modeName[4] = {"fast", "normal", "slow", "marport"};
+/* RCC_CSR bits 31 - 24 */
+static const char* resetName[8] = {"", "BOR", "PIN", "POR", "SFT", "IWDG", "WWDG", "LPWR"};
+
+/* Private functions ---------------------------------------------------------*/
+/* same as evlogCrc() in common/evlog.c */
+static uint8_t crc8(const uint8_t* data, uint32_t length)
+{
+  uint8_t crc = 0;
+
+  while(length-- > 0)
+  {
+    crc ^= *data++;
+    for(int i = 0; i < 8; i++)
+    {
+      crc = (crc & 0x80) ? (uint8_t)((crc << 1) ^ CRC8_POLY) : (uint8_t)(crc << 1);
+    }
+  }
+  return crc;
+}
+
+static void printReset(uint8_t reset)
+{
+  int first = 1;
+
+  if(reset == 0)
+  {
+    printf("wake");
+    return;
+  }
+  for(int bit = 7; bit > 0; bit--)
+  {
+    if((reset & (1 << bit)) == 0)continue;
+    printf("%s%s", first ? "" : "|", resetName[bit]);
+    first = 0;
+  }
+}
+
+int main(int argc, char* argv[])
+{
+  FILE* in = stdin;
+  size_t size, pos;
+  uint32_t count, bad = 0;
+
+  if(argc > 1)
+  {
+    in = fopen(argv[1], "rb");
+    if(in == NULL)
+    {
+      perror(argv[1]);
+      return 1;
+    }
+  }
+  size = fread(capture, 1, sizeof(capture), in);
+  /* the first dump in the capture, 0xA5 is not in the text before it */
+  for(pos = 0; pos + 4 <= size; pos++)
+  {
+    if((capture[pos] == (EVLOG_SYNC & 0xFF))&&(capture[pos + 1] == (EVLOG_SYNC >> 8))&&
+       ((uint32_t)(capture[pos + 2] | (capture[pos + 3] << 8)) <= EVLOG_SIZE))break;
+  }
+  if(pos + 4 > size)
+  {
+    fprintf(stderr, "no event log in the capture\n");
+    return 1;
+  }
+  count = capture[pos + 2] | (capture[pos + 3] << 8);
+  pos += 4;
+  if(pos + count*ENTRY_BYTES > size)
+  {
+    fprintf(stderr, "capture is cut, %u of %u entries\n",
+            (unsigned)((size - pos)/ENTRY_BYTES), (unsigned)count);
+    count = (size - pos)/ENTRY_BYTES;
+  }
+  printf("seq,burst_ms,sensor,mode,reset,reset_flags,phase,crc_ok\n");
+  for(uint32_t i = 0; i < count; i++, pos += ENTRY_BYTES)
+  {
+    const uint8_t* e = &capture[pos];
+    uint8_t state = e[4];
+    int ok = (crc8(e, ENTRY_BYTES - 1) == e[7]);
+
+    if(!ok)bad++;
+    printf("%u,%u,%s,%s,0x%02X,", (unsigned)(e[0] | (e[1] << 8)),
+           (unsigned)(e[2] | (e[3] << 8)),
+           (state & STATE_NO_PING) ? "-" : (state & 0x01) ? "full" : "empty",
+           (state & STATE_NO_PING) ? "-" : modeName[(state >> 1) & 0x03], e[5]);
+    printReset(e[5]);
+    printf(",%u,%d\n", e[6], ok);
+  }
+  fprintf(stderr, "%u entries, %u with CRC error\n", (unsigned)count, (unsigned)bad);
+  return 0;
+}
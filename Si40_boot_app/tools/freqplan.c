@@ -0,0 +1,71 @@
+/**
+  ******************************************************************************
+  * @file    freqplan.c
+  * @author  AKabanov
+  * @brief   host listing of the frequency plan (common/freqplan.h)
+  ******************************************************************************
+  * build:  gcc -O2 -I../common -o freqplan freqplan.c
+  * usage:  freqplan               table of the channels
+  *         freqplan -c            CSV for a spreadsheet
+  *
+  * For every channel: nominal frequency, ARR and frequency of the timer with
+  * integer period, its error, dithered period (ARR + 1 with fraction, see
+  * FREQ_FRAC_BITS) and its error. The same macros make PWMPeriods[] of the
+  * application and the strings of the bootloader, so the listing is what
+  * the firmware sends.
+  ******************************************************************************
+  */
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <string.h>
+#include "freqplan.h"
+
+/* Private define ------------------------------------------------------------*/
+#define ROW(ch, hz)  printRow(csv, ch, hz, FREQ_STRING(hz), FREQ_ARR(hz), \
+                              FREQ_ERROR_MHZ(hz), FREQ_PERIOD_FRAC(hz), \
+                              FREQ_DITHER_ERROR_MHZ(hz));
+
+/* Private variables ---------------------------------------------------------*/
+static long long maxError = 0, maxDitherError = 0;
+
+/* Private functions ---------------------------------------------------------*/
+static void printRow(int csv, int ch, unsigned hz, const char* name,
+                     unsigned long long arr, long long error,
+                     unsigned long long frac, long long ditherError)
+{
+  double timer = (FREQ_ACTUAL_MHZ(arr + 1))/1000.0;
+  double period = (double)frac/(1 << FREQ_FRAC_BITS);
+
+  if(csv)
+  {
+    printf("%d,%u,%s,%llu,%.3f,%.3f,%.4f,%.3f\n", ch, hz, name, arr, timer,
+           error/1000.0, period, ditherError/1000.0);
+  }
+  else
+  {
+    printf("%3d %6u %-8s %5llu %10.3f %+8.3f %11.4f %+8.3f\n", ch, hz, name,
+           arr, timer, error/1000.0, period, ditherError/1000.0);
+  }
+  if(FREQ_ABS(error) > maxError)maxError = FREQ_ABS(error);
+  if(FREQ_ABS(ditherError) > maxDitherError)maxDitherError = FREQ_ABS(ditherError);
+}
+
+int main(int argc, char* argv[])
+{
+  int csv = (argc > 1)&&(strcmp(argv[1], "-c") == 0);
+
+  if(csv)printf("channel,nominal_hz,string,arr,timer_hz,error_hz,dither_period,dither_error_hz\n");
+  else
+  {
+    printf("counter clock %llu Hz, prescaler %d, dither fraction %d bits\n",
+           FREQ_CNT_CLK, FREQ_PSC, FREQ_FRAC_BITS);
+    printf(" ch nominal string     ARR   timer Hz   err Hz  dith period  err Hz\n");
+  }
+  FREQ_PLAN(ROW)
+  if(!csv)
+  {
+    printf("max error %.3f Hz (limit %.3f Hz), with dithering %.3f Hz\n",
+           maxError/1000.0, FREQ_MAX_ERROR_MHZ/1000.0, maxDitherError/1000.0);
+  }
+  return 0;
+}
@@ -0,0 +1,149 @@
+/**
+  ******************************************************************************
+  * @file    pingcharge.c
+  * @author  AKabanov
+  * @brief   host estimate of time and MCU charge per wake, Standby vs Stop
+  ******************************************************************************
+  * build:  gcc -O2 -o pingcharge pingcharge.c
+  * usage:  pingcharge [sleep seconds] < terminal_log.txt
+  *
+  * Input is the trace printed by bootloader 'p' command (" T id MHz cycles"),
+  * captured once with STANDBY_RTC_BKPSRAM_MODE and once with STOP_MODE
+  * (application/Inc/stm32f2xx_lp_modes.h), both logs may be in one file.
+  * A record starting with TRACE_BOOT is a Standby wake, a record starting
+  * with TRACE_APP_WAKE is a Stop wake. The cycle counter does not run during
+  * the wake up itself, so datasheet wake up time is added to every record.
+  *
+  * Currents are typical STM32F205 datasheet values at 25 C, 3.3 V, MCU only
+  * (the transmitter is not counted), change them to the board measurement.
+  * Output is CSV, one line per record, and '#' summary lines per mode.
+  ******************************************************************************
+  */
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+/* Private define ------------------------------------------------------------*/
+#define TRACE_BOOT          0
+#define TRACE_APP_BURST     22
+#define TRACE_APP_SLEEP     24
+#define TRACE_APP_WAKE      26
+
+#define RUN_MA_BASE         2.0     // run from flash, peripherals off:
+#define RUN_MA_PER_MHZ      0.30    //   I = base + k * HCLK
+#define STANDBY_MA          0.0035  // Standby, RTC on LSE, backup SRAM on
+#define STOP_MA             0.55    // Stop, low power regulator
+#define STANDBY_WAKE_US     260.0   // reset and option bytes load, not traced
+#define STOP_WAKE_US        20.0    // regulator wake up, not traced
+#define WAKE_MA             (RUN_MA_BASE + RUN_MA_PER_MHZ * 16)
+
+#define DEFAULT_SLEEP_S     30.0
+
+/* Private typedef -----------------------------------------------------------*/
+typedef enum
+{
+  MODE_STANDBY = 0,
+  MODE_STOP,
+  MODE_NUM
+} sleepMode_t;
+
+typedef struct
+{
+  sleepMode_t mode;
+  int ping;               // record has a tone burst
+  double activeUs;        // traced time from wake to sleep
+  double chargeUc;        // charge of the traced time
+} record_t;
+
+typedef struct
+{
+  unsigned num;
+  double activeUs;
+  double totalUc;
+} summary_t;
+
+/* Private variables ---------------------------------------------------------*/
+static const char* modeName[MODE_NUM] = {"standby", "stop"};
+static summary_t summary[MODE_NUM][2];    // [mode][ping]
+static double sleepS = DEFAULT_SLEEP_S;
+static unsigned records = 0;
+
+/* Private functions ---------------------------------------------------------*/
+static double runMa(unsigned mhz)
+{
+  return RUN_MA_BASE + RUN_MA_PER_MHZ * mhz;
+}
+
+static void recordEnd(const record_t* rec)
+{
+  double wakeUs = (rec->mode == MODE_STOP) ? STOP_WAKE_US : STANDBY_WAKE_US;
+  double sleepMa = (rec->mode == MODE_STOP) ? STOP_MA : STANDBY_MA;
+  /* mA * us = nC */
+  double wakeUc = wakeUs * WAKE_MA / 1000.0;
+  double sleepUc = sleepS * sleepMa * 1000.0;
+  double totalUc = rec->chargeUc + wakeUc + sleepUc;
+  summary_t* sum = &summary[rec->mode][rec->ping];
+
+  printf("%u,%s,%d,%.1f,%.3f,%.3f,%.3f,%.3f\n", ++records, modeName[rec->mode],
+         rec->ping, rec->activeUs + wakeUs, rec->chargeUc, wakeUc, sleepUc, totalUc);
+  sum->num++;
+  sum->activeUs += rec->activeUs + wakeUs;
+  sum->totalUc += totalUc;
+}
+
+int main(int argc, char* argv[])
+{
+  char line[256];
+  unsigned id, mhz, prevMhz = 0;
+  uint32_t cycles, prevCycles = 0;
+  int inRecord = 0, awake = 0;
+  record_t rec = {MODE_STANDBY, 0, 0, 0};
+
+  if(argc > 1)sleepS = atof(argv[1]);
+  printf("record,mode,ping,active_us,active_uC,wake_uC,sleep_uC,total_uC\n");
+  while(fgets(line, sizeof(line), stdin) != NULL)
+  {
+    if(sscanf(line, " T %u %u %u", &id, &mhz, &cycles) != 3)continue;
+    if((id == TRACE_BOOT)||(id == TRACE_APP_WAKE))
+    {
+      if(inRecord)recordEnd(&rec);
+      rec.mode = (id == TRACE_APP_WAKE) ? MODE_STOP : MODE_STANDBY;
+      rec.ping = 0;
+      rec.activeUs = 0;
+      rec.chargeUc = 0;
+      inRecord = 1;
+      awake = 1;
+    }
+    else if(inRecord && awake)
+    {
+      double us = (double)(uint32_t)(cycles - prevCycles)/(prevMhz ? prevMhz : 1);
+      rec.activeUs += us;
+      rec.chargeUc += us * runMa(prevMhz) / 1000.0;
+      if(id == TRACE_APP_BURST)rec.ping = 1;
+      if(id == TRACE_APP_SLEEP)awake = 0;
+    }
+    prevMhz = mhz;
+    prevCycles = cycles;
+  }
+  if(inRecord)recordEnd(&rec);
+  if(records == 0)
+  {
+    fprintf(stderr, "no trace records found\n");
+    return 1;
+  }
+
+  printf("# sleep %.1f s, per wake average\n", sleepS);
+  for(int mode = 0; mode < MODE_NUM; mode++)
+  {
+    for(int ping = 1; ping >= 0; ping--)
+    {
+      summary_t* sum = &summary[mode][ping];
+      if(sum->num == 0)continue;
+      printf("# %-8s %-8s %4u wakes, active %10.1f us, charge %10.3f uC\n",
+             modeName[mode], ping ? "ping" : "schedule", sum->num,
+             sum->activeUs/sum->num, sum->totalUc/sum->num);
+    }
+  }
+  return 0;
+}
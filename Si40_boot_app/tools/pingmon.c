@@ -0,0 +1,564 @@
+/**
+  ******************************************************************************
+  * @file    pingmon.c
+  * @author  AKabanov
+  * @brief   host streaming monitor of the channels of the frequency plan,
+  *          sliding DFT bins (common/freqplan.h) and ping events with their
+  *          arrival times
+  ******************************************************************************
+  * build:  D=../common/Drivers/CMSIS/DSP_Lib/Source
+  *         gcc -O2 -DARM_MATH_HOST -fno-strict-aliasing -fwrapv -I../common
+  *             -I../common/Drivers/CMSIS/Include -o pingmon pingmon.c
+  *             $D/TransformFunctions/arm_sdft_*.c
+  *             $D/ControllerFunctions/arm_sin_cos_q31.c
+  *             $D/SupportFunctions/arm_q15_to_q31.c
+  *             $D/SupportFunctions/arm_q15_to_float.c
+  *             $D/SupportFunctions/arm_q31_to_float.c
+  *             $D/CommonTables/arm_common_tables.c -lm
+  * usage:  pingmon [-r rate] [-n window] [-h hop] [-t q31|f32] [-m dB] file
+  *         pingmon -s [-r rate] [-n window] [-h hop]       self test
+  *
+  * file is a stream of 16 bit little endian mono samples at rate Hz (200000
+  * default, "-" is stdin, a pipe from the recorder works). arm_sdft_<t>
+  * keeps a bin on every channel of FREQ_PLAN over the last n samples (2000
+  * default, 100 Hz bins, the Marport channels are 100 Hz apart) and the
+  * bins are read every h samples (20 default, 0.1 ms). The work per sample
+  * is one complex multiply per channel, whatever the hop.
+  *
+  * A channel triggers when it is m dB (10 default) above the median of the
+  * channels and the strongest channel within 300 Hz. One window later the
+  * window holds only the ping: the line "ping" shows the arrival, the level
+  * in dBFS (0 dBFS is a full scale sine) and the offset of the pinger from
+  * the channel, taken from the turn of the bin phase between two hops. The
+  * arrival is the first sample of the ping: the amplitude of the bin rises
+  * over one window from the first sample, the hop where it crosses half of
+  * the settled amplitude is interpolated and moved back by the length of
+  * the ping in the window at half amplitude, for the damping of the sliding
+  * DFT and the offset. The line "end" at half amplitude on the way down
+  * gives the last sample the same way and the duration (29 or 47 ms for a
+  * Si40). Times are ms from the start of the stream. Pings must be longer
+  * than 1.25 windows, the window a multiple of rate/100 samples to put
+  * every channel on a bin and the rate 2.2 times the top channel or more. Exit code 0 if there was a ping, 1 if not.
+  *
+  * The self test checks both types: the bins against a double DFT of the
+  * window with the damping of the sliding DFT, blocks of every size, and a
+  * stream of pings with white noise, random channels, durations of 29 and
+  * 47 ms, offsets up to 8 Hz and onsets, that must give every ping on its
+  * channel with its arrival and duration. Exit code is the number of failed
+  * checks.
+  ******************************************************************************
+  */
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "arm_math.h"
+#include "freqplan.h"
+
+/* Private define ------------------------------------------------------------*/
+#define MAX_WINDOW      16384
+#define MAX_HOP         1024
+#define MAX_HISTORY     4096          // hops of amplitude per channel
+#define MAX_EVENTS      256
+#define NEIGHBOUR_HZ    300           // a ping is the strongest channel this near
+#define HYSTERESIS_DB   3.0
+#define TEST_PINGS      12
+
+/* Private typedef -----------------------------------------------------------*/
+typedef enum
+{
+  TYPE_Q31,
+  TYPE_F32
+} Type;
+
+typedef enum
+{
+  STATE_IDLE,
+  STATE_RISING,                       // triggered, the window fills
+  STATE_ACTIVE,                       // settled, waits for the end
+  STATE_QUIET                         // ended, waits for the margin to drop
+} State;
+
+typedef struct
+{
+  State state;
+  uint32_t hops;                      // since the trigger
+  double re, im;                      // bin when the window filled
+  double peak;                        // settled |S|
+  double delta;                       // offset of the ping, rad/sample
+  int event;                          // index in events[]
+} Detector;
+
+typedef struct
+{
+  int ch;                             // 0 based
+  double arrival;                     // first sample
+  double duration;                    // samples, 0 until the end
+  double dBFS;
+  double offsetHz;
+} Event;
+
+/* Private variables ---------------------------------------------------------*/
+static const uint32_t planHz[FREQ_CHANNELS] =
+{
+#define PLAN_HZ(ch, hz)  [ch - 1] = hz,
+  FREQ_PLAN(PLAN_HZ)
+};
+static const char* const typeName[] = {"q31", "f32"};
+
+static uint32_t sampleRate = 200000, window = 2000, hopSize = 20;
+static Type type = TYPE_Q31;
+static double minMargin = 10;
+static int verbose = 1;
+static arm_sdft_instance_q31 inst31;
+static arm_sdft_instance_f32 instF;
+static q31_t coeffs31[4*FREQ_CHANNELS], state31[2*FREQ_CHANNELS + MAX_WINDOW];
+static float32_t coeffsF[4*FREQ_CHANNELS], stateF[2*FREQ_CHANNELS + MAX_WINDOW];
+static double size;                   // 2^ceil(log2(window)), scale of the bins
+static double gain;                   // |S| of a unit phasor over the window
+static float history[FREQ_CHANNELS][MAX_HISTORY];
+static uint32_t historyLen;
+static uint32_t fillHops, lagHops;    // window, phase lag
+static uint64_t hops;                 // hops so far
+static Detector det[FREQ_CHANNELS];
+static Event events[MAX_EVENTS];
+static int numEvents;
+static uint32_t seed = 1;
+static unsigned failed = 0;
+
+/* Private functions ---------------------------------------------------------*/
+static uint32_t rnd(void)
+{
+  seed ^= seed << 13;
+  seed ^= seed >> 17;
+  seed ^= seed << 5;
+  return seed;
+}
+
+static void check(const char* name, int i, int ok)
+{
+  if(!ok)
+  {
+    printf("FAIL %s %d\n", name, i);
+    failed++;
+  }
+}
+
+/* |sum(z^k)|, k from a to b (real), z = r exp(j delta) */
+static double zsum(double delta, double a, double b)
+{
+  double r = ARM_SDFT_DAMPING_Q31/2147483648.0;
+  double ra = pow(r, a), rb = pow(r, b);
+  double re = ra*cos(delta*a) - rb*cos(delta*b), im = ra*sin(delta*a) - rb*sin(delta*b);
+
+  return hypot(re, im)/hypot(1.0 - r*cos(delta), r*sin(delta));
+}
+
+/* samples of the ping in the window at the amplitude ratio of the settled
+   one: the newest ones on the way up, on the way down the samples after
+   the ping instead */
+static double fillCount(double delta, double ratio, int falling)
+{
+  double level = ratio*zsum(delta, 0, window), lo = 0, hi = window;
+
+  for(int i = 0; i < 60; i++)
+  {
+    double c = (lo + hi)/2;
+    double a = falling ? zsum(delta, c, window) : zsum(delta, 0, c);
+
+    if((a < level) != falling)lo = c;
+    else hi = c;
+  }
+  return (lo + hi)/2;
+}
+
+static void init(void)
+{
+  if((window == 0)||(window > MAX_WINDOW)||(hopSize == 0)||(hopSize > MAX_HOP)||(hopSize > window)||
+     (2*window/hopSize + 4 > MAX_HISTORY)||
+     (arm_sdft_init_q31(&inst31, FREQ_CHANNELS, coeffs31, planHz, sampleRate, window, state31) != ARM_MATH_SUCCESS)||
+     (arm_sdft_init_f32(&instF, FREQ_CHANNELS, coeffsF, planHz, sampleRate, window, stateF) != ARM_MATH_SUCCESS))
+  {
+    fprintf(stderr, "window %u, hop %u not supported at %u Hz\n", (unsigned)window, (unsigned)hopSize,
+            (unsigned)sampleRate);
+    exit(1);
+  }
+  /* a channel between the bins of the window leaks into the others, the
+     sidelobes of a strong ping trigger them; the image of a real ping at
+     rate - f leaks the same way, keep it a tenth of the rate away */
+  for(int ch = 0; ch < FREQ_CHANNELS; ch++)
+  {
+    if((uint64_t)planHz[ch]*22 > (uint64_t)sampleRate*10)
+    {
+      fprintf(stderr, "%u Hz too near half of %u Hz\n", (unsigned)planHz[ch], (unsigned)sampleRate);
+      exit(1);
+    }
+    if((uint64_t)planHz[ch]*window % sampleRate != 0)
+    {
+      fprintf(stderr, "window %u puts %u Hz between the bins, use a multiple of %u\n", (unsigned)window,
+              (unsigned)planHz[ch], (unsigned)(sampleRate/100));
+      exit(1);
+    }
+  }
+  for(size = 1; size < window; size *= 2);
+  gain = zsum(0, 0, window);
+  historyLen = 2*window/hopSize + 4;
+  fillHops = window/hopSize + 1;
+  lagHops = (window/4 + hopSize - 1)/hopSize;
+  hops = 0;
+  numEvents = 0;
+  memset(det, 0, sizeof(det));
+  memset(history, 0, sizeof(history));
+}
+
+/* newest sample of hop k */
+static double timeOf(uint64_t k)
+{
+  return (double)k*hopSize + hopSize - 1;
+}
+
+static double amplitude(int ch, uint64_t k)
+{
+  return history[ch][k % historyLen];
+}
+
+/* first sample of the ping from the two hops around half of the settled
+   amplitude peak, the newest hop k */
+static double arrivalOf(int ch, uint64_t k, double peak, double delta)
+{
+  uint64_t oldest = (k + 1 >= historyLen) ? k + 1 - historyLen : 0;
+  uint64_t j = k;
+
+  while((j > oldest + 1)&&(amplitude(ch, j - 1) >= peak/2))j--;
+  return (timeOf(j - 1) - fillCount(delta, amplitude(ch, j - 1)/peak, 0) +
+          timeOf(j) - fillCount(delta, amplitude(ch, j)/peak, 0))/2 + 1;
+}
+
+static double toMs(double samples)
+{
+  return 1e3*samples/sampleRate;
+}
+
+static int cmpDouble(const void* a, const void* b)
+{
+  double x = *(const double*)a, y = *(const double*)b;
+  return (x > y) - (x < y);
+}
+
+static int strongestNear(const double* dB, int ch)
+{
+  for(int i = 0; i < FREQ_CHANNELS; i++)
+  {
+    if((labs((long)planHz[i] - (long)planHz[ch]) <= NEIGHBOUR_HZ)&&(dB[i] > dB[ch]))return 0;
+  }
+  return 1;
+}
+
+static void detect(int ch, double margin, const double* dB, double re, double im)
+{
+  Detector* d = &det[ch];
+  uint64_t k = hops;
+  double mag = amplitude(ch, k);
+
+  switch(d->state)
+  {
+  case STATE_IDLE:
+    if((margin >= minMargin)&&strongestNear(dB, ch))
+    {
+      d->state = STATE_RISING;
+      d->hops = 0;
+    }
+    break;
+
+  case STATE_RISING:
+    /* shorter than the window, or a neighbour of a ping */
+    if((margin < minMargin - HYSTERESIS_DB)||!strongestNear(dB, ch))
+    {
+      d->state = STATE_IDLE;
+      break;
+    }
+    if(++d->hops == fillHops)
+    {
+      d->re = re;
+      d->im = im;
+    }
+    if(d->hops < fillHops + lagHops)break;
+
+    /* the window holds only the ping: the bin turns by w + delta a sample,
+       delta from a quarter of a window */
+    {
+      double w = 2.0*PI*planHz[ch]/sampleRate, wl = w*lagHops*hopSize;
+      double tr = re*d->re + im*d->im, ti = im*d->re - re*d->im;
+      double turn = atan2(ti*cos(wl) - tr*sin(wl), tr*cos(wl) + ti*sin(wl));
+      Event* e;
+
+      d->delta = turn/(lagHops*hopSize);
+      d->peak = mag;
+      d->state = STATE_ACTIVE;
+      d->event = -1;
+      if(numEvents >= MAX_EVENTS)break;
+      d->event = numEvents++;
+      e = &events[d->event];
+      e->ch = ch;
+      e->arrival = arrivalOf(ch, k, mag, d->delta);
+      e->duration = 0;
+      e->dBFS = 20.0*log10(2.0*mag/zsum(d->delta, 0, window));
+      e->offsetHz = d->delta*sampleRate/(2.0*PI);
+      if(verbose)printf("%12.4f ms  ch %2d %6u Hz  ping  %6.1f dBFS  +%.1f dB  %+.1f Hz\n",
+                        toMs(e->arrival), ch + 1, (unsigned)planHz[ch], e->dBFS, margin, e->offsetHz);
+    }
+    break;
+
+  case STATE_ACTIVE:
+    if(mag < d->peak/2)
+    {
+      /* last sample of the ping from the two hops around half */
+      double end = (timeOf(k - 1) - fillCount(d->delta, amplitude(ch, k - 1)/d->peak, 1) +
+                    timeOf(k) - fillCount(d->delta, mag/d->peak, 1))/2;
+
+      d->state = STATE_QUIET;
+      if(d->event < 0)break;
+      events[d->event].duration = end - events[d->event].arrival + 1;
+      if(verbose)printf("%12.4f ms  ch %2d %6u Hz  end   %8.3f ms\n", toMs(end), ch + 1,
+                        (unsigned)planHz[ch], toMs(events[d->event].duration));
+    }
+    break;
+
+  default:
+    if(margin < minMargin - HYSTERESIS_DB)d->state = STATE_IDLE;
+    break;
+  }
+}
+
+/* one hop of samples through the bins and the detectors */
+static void hop(const q15_t* x)
+{
+  static q31_t in31[MAX_HOP], out31[2*FREQ_CHANNELS];
+  static float32_t inF[MAX_HOP];
+  float32_t out[2*FREQ_CHANNELS];
+  double dB[FREQ_CHANNELS], sorted[FREQ_CHANNELS];
+
+  if(type == TYPE_Q31)
+  {
+    arm_q15_to_q31((q15_t*)x, in31, hopSize);
+    arm_sdft_q31(&inst31, in31, out31, hopSize);
+    arm_q31_to_float(out31, out, 2*FREQ_CHANNELS);
+  }
+  else
+  {
+    arm_q15_to_float((q15_t*)x, inF, hopSize);
+    arm_sdft_f32(&instF, inF, out, hopSize);
+  }
+
+  for(int ch = 0; ch < FREQ_CHANNELS; ch++)
+  {
+    double mag = hypot(out[2*ch], out[2*ch + 1])*size;
+
+    history[ch][hops % historyLen] = (float)mag;
+    dB[ch] = 20.0*log10(2.0*mag/gain + 1e-10);
+  }
+  memcpy(sorted, dB, sizeof(sorted));
+  qsort(sorted, FREQ_CHANNELS, sizeof(double), cmpDouble);
+
+  for(int ch = 0; ch < FREQ_CHANNELS; ch++)
+  {
+    double re = out[2*ch]*size, im = out[2*ch + 1]*size;
+
+    detect(ch, dB[ch] - sorted[FREQ_CHANNELS/2], dB, re, im);
+  }
+  hops++;
+}
+
+/* bins against the double DFT of the window with z = r exp(jw) of the
+   coefficients, after blocks of random size */
+static void checkBins(void)
+{
+  uint32_t length = 3*window + rnd() % window, done = 0;
+  q15_t* x = malloc(length*sizeof(q15_t));
+  q31_t* x31 = malloc(length*sizeof(q31_t));
+  float32_t* xF = malloc(length*sizeof(float32_t));
+  q31_t out31[2*FREQ_CHANNELS];
+  float32_t out[2*FREQ_CHANNELS];
+  double worst = 0;
+
+  for(uint32_t n = 0; n < length; n++)
+  {
+    double v = 0.3*sin(2.0*PI*planHz[7]*n/sampleRate) + 0.2*sin(2.0*PI*planHz[30]*n/sampleRate + 1.0) +
+               ((int32_t)rnd() >> 8)*(0.05/8388608.0);
+    x[n] = (q15_t)lrint(v*32768.0);
+  }
+  arm_q15_to_q31(x, x31, length);
+  arm_q15_to_float(x, xF, length);
+  while(done < length)
+  {
+    uint32_t block = 1 + rnd() % (window + 7);
+
+    if(block > length - done)block = length - done;
+    if(type == TYPE_Q31)arm_sdft_q31(&inst31, x31 + done, out31, block);
+    else arm_sdft_f32(&instF, xF + done, out, block);
+    done += block;
+  }
+  if(type == TYPE_Q31)arm_q31_to_float(out31, out, 2*FREQ_CHANNELS);
+
+  for(int ch = 0; ch < FREQ_CHANNELS; ch++)
+  {
+    double c = (type == TYPE_Q31) ? coeffs31[4*ch]/2147483648.0 : coeffsF[4*ch];
+    double s = (type == TYPE_Q31) ? coeffs31[4*ch + 1]/2147483648.0 : coeffsF[4*ch + 1];
+    double re = 0, im = 0, zr = 1, zi = 0, t;
+
+    for(uint32_t k = 0; k < window; k++)
+    {
+      re += x[length - 1 - k]/32768.0*zr;
+      im += x[length - 1 - k]/32768.0*zi;
+      t = zr*c - zi*s;
+      zi = zr*s + zi*c;
+      zr = t;
+    }
+    if(fabs(re/size - out[2*ch]) > worst)worst = fabs(re/size - out[2*ch]);
+    if(fabs(im/size - out[2*ch + 1]) > worst)worst = fabs(im/size - out[2*ch + 1]);
+  }
+  /* -80 dB of a full scale bin, |S| = 1/2 */
+  check("bins", (int)type, worst < 0.5e-4);
+  printf("%s: error to DFT %.2e, %.1f dB below full scale\n", typeName[type], worst, 20.0*log10(0.5/worst));
+  free(x);
+  free(x31);
+  free(xF);
+}
+
+/* pings one after another, each longer than the window, gaps of 2 windows
+   and more; every one must come back on its channel */
+static void checkPings(void)
+{
+  static const uint32_t durationMs[] = {29, 47};
+  uint32_t onset[TEST_PINGS], length[TEST_PINGS], total = 2*window;
+  int ch[TEST_PINGS];
+  double worstArrival = 0, worstDuration = 0, scale = 100.0*window/sampleRate;
+  uint32_t shortest = (fillHops + lagHops + 2)*hopSize;
+  q15_t* x;
+
+  if(durationMs[1]*sampleRate/1000 < shortest)
+  {
+    printf("%s: window %u too long for the pings of a Si40, not tested\n", typeName[type], (unsigned)window);
+    return;
+  }
+  for(int i = 0; i < TEST_PINGS; i++)
+  {
+    ch[i] = (int)(rnd() % FREQ_CHANNELS);
+    length[i] = durationMs[rnd() & 1]*sampleRate/1000;
+    if(length[i] < shortest)length[i] = durationMs[1]*sampleRate/1000;
+    onset[i] = total;
+    total += length[i] + 2*window + rnd() % (4*window);
+  }
+  total -= total % hopSize;
+  x = malloc(total*sizeof(q15_t));
+  for(uint32_t n = 0; n < total; n++)
+  {
+    double v = ((int32_t)rnd() >> 8)*(0.003/8388608.0);
+    x[n] = (q15_t)lrint(v*32768.0);
+  }
+  for(int i = 0; i < TEST_PINGS; i++)
+  {
+    /* -20 dBFS, up to 8 Hz off the channel, random phase */
+    double hz = planHz[ch[i]] + ((int)(rnd() % 1601) - 800)/100.0, phase = rnd()*(2.0*PI/4294967296.0);
+
+    for(uint32_t n = 0; n < length[i]; n++)
+    {
+      x[onset[i] + n] += (q15_t)lrint(0.1*32768.0*sin(2.0*PI*hz*n/sampleRate + phase));
+    }
+  }
+
+  init();
+  verbose = 0;
+  for(uint32_t n = 0; n < total; n += hopSize)hop(x + n);
+  verbose = 1;
+  check("pings", numEvents, numEvents == TEST_PINGS);
+  for(int i = 0; (i < TEST_PINGS)&&(i < numEvents); i++)
+  {
+    double da = fabs(events[i].arrival - onset[i]), dd = fabs(events[i].duration - length[i]);
+
+    if(da > worstArrival)worstArrival = da;
+    if(dd > worstDuration)worstDuration = dd;
+    /* no bias, the noise moves the crossings by 10 us or so for a window of
+       10 ms, more with a longer one as the bin rises slower */
+    check("channel", i, events[i].ch == ch[i]);
+    check("arrival", i, da < 30e-6*sampleRate*scale);
+    check("duration", i, dd < 40e-6*sampleRate*scale);
+    check("level", i, fabs(events[i].dBFS + 20.0) < 0.5);
+  }
+  printf("%s: %d of %d pings, arrival within %.2f us, duration within %.2f us\n", typeName[type],
+         numEvents, TEST_PINGS, 1e6*worstArrival/sampleRate, 1e6*worstDuration/sampleRate);
+  free(x);
+}
+
+static void selfTest(void)
+{
+  for(type = TYPE_Q31; type <= TYPE_F32; type++)
+  {
+    init();
+    checkBins();
+    checkPings();
+  }
+  printf("%u checks failed\n", failed);
+}
+
+static void usage(void)
+{
+  fprintf(stderr, "usage: pingmon [-r rate] [-n window] [-h hop] [-t q31|f32] [-m dB] file\n"
+                  "       pingmon -s [-r rate] [-n window] [-h hop]\n");
+  exit(1);
+}
+
+int main(int argc, char* argv[])
+{
+  const char* name = NULL;
+  int test = 0;
+  FILE* f;
+
+  for(int i = 1; i < argc; i++)
+  {
+    if(strcmp(argv[i], "-s") == 0)test = 1;
+    else if((strcmp(argv[i], "-r") == 0)&&(i + 1 < argc))sampleRate = strtoul(argv[++i], NULL, 0);
+    else if((strcmp(argv[i], "-n") == 0)&&(i + 1 < argc))window = strtoul(argv[++i], NULL, 0);
+    else if((strcmp(argv[i], "-h") == 0)&&(i + 1 < argc))hopSize = strtoul(argv[++i], NULL, 0);
+    else if((strcmp(argv[i], "-m") == 0)&&(i + 1 < argc))minMargin = atof(argv[++i]);
+    else if((strcmp(argv[i], "-t") == 0)&&(i + 1 < argc))
+    {
+      i++;
+      for(type = TYPE_Q31; (type <= TYPE_F32)&&(strcmp(argv[i], typeName[type]) != 0); type++);
+      if(type > TYPE_F32)usage();
+    }
+    else if(name == NULL)name = argv[i];
+    else usage();
+  }
+  init();
+  if(test)
+  {
+    selfTest();
+    return (int)failed;
+  }
+  if(name == NULL)usage();
+  f = (strcmp(name, "-") == 0) ? stdin : fopen(name, "rb");
+  if(f == NULL)
+  {
+    perror(name);
+    return 1;
+  }
+
+  printf("%d channels, %u Hz, window %u (%.2f ms, %.1f Hz), hop %u (%.3f ms), %s\n", FREQ_CHANNELS,
+         (unsigned)sampleRate, (unsigned)window, toMs(window), (double)sampleRate/window,
+         (unsigned)hopSize, toMs(hopSize), typeName[type]);
+  for(;;)
+  {
+    uint8_t raw[2*MAX_HOP];
+    q15_t x[MAX_HOP];
+
+    if(fread(raw, 2, hopSize, f) != hopSize)break;
+    for(uint32_t n = 0; n < hopSize; n++)x[n] = (q15_t)(raw[2*n] | (raw[2*n + 1] << 8));
+    hop(x);
+  }
+  if(f != stdin)fclose(f);
+
+  printf("%d pings\n", numEvents);
+  return (numEvents > 0) ? 0 : 1;
+}
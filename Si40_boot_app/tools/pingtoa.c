@@ -0,0 +1,587 @@
+/**
+  ******************************************************************************
+  * @file    pingtoa.c
+  * @author  AKabanov
+  * @brief   host estimator of the arrival of a ping in a capture, cross
+  *          correlation with the burst of the channel and interpolation of
+  *          the peak between samples
+  ******************************************************************************
+  * build:  D=../common/Drivers/CMSIS/DSP_Lib/Source
+  *         gcc -O2 -DARM_MATH_HOST -DARM_MATH_HOST_SIMD -fno-strict-aliasing
+  *             -fwrapv -I../common -I../common/Drivers/CMSIS/Include
+  *             -o pingtoa pingtoa.c
+  *             $D/[A-Z]*[a-z]/arm_*.c -lm
+  * usage:  pingtoa [-r rate] [-d 29|47] [-m corr|partial|fft] [-n fft] -c ch file
+  *         pingtoa -s [-r rate] [-n fft]                   self test
+  *         pingtoa -b [-r rate] [-n fft] [-t seconds]      benchmark
+  *
+  * file is a capture of 16 bit little endian mono samples at rate Hz
+  * (200000 default, "-" is stdin) that holds a ping of channel ch of
+  * FREQ_PLAN (common/freqplan.h), the rate 3 times the top channel or
+  * more. The template is the burst of the Si40, a sine on the channel from
+  * phase 0 for d ms (29 default, 47 in the Marport mode,
+  * application/Src/main.c). Its correlation with the capture over the lags
+  * where the template is inside the capture is
+  *   corr     arm_correlate_fast_opt_q15(), every lag of the two sequences
+  *   partial  arm_conv_partial_fast_opt_q15() with the template reversed,
+  *            only the lags inside the capture
+  *   fft      overlap-save of the template in partitions of n/2 samples,
+  *            arm_rfft_fast_f32() of n points (twice the template up to
+  *            2048 default), the work per sample grows with the partitions
+  *            instead of the template
+  * The default is partial for templates up to FFT_TEMPLATE samples and fft
+  * for longer ones, 100 times faster for a Si40 ping at 200 kHz. The q15
+  * template is scaled to the largest sample of the capture, as far as the
+  * 2.30 accumulators of the fast kernels take it without a wrap.
+  *
+  * The correlation of the ping is a cosine on the channel under the
+  * triangle of the overlap, the crest at the arrival is the highest. The
+  * parabola through a local maximum and its neighbours gives the crest
+  * between samples: on a cosine the vertex p of the parabola is off by a
+  * known function of the offset d, tan(w d) = 2 p tan(w/2) for the channel
+  * w rad/sample, the estimate takes d from it. The line shows the arrival
+  * (the first sample of the ping, ms from the start of the capture) and
+  * the level in dBFS. The arrival holds as far as the ping is a burst of
+  * the template: an offset of the pinger of h Hz moves it by about
+  * h*d/(2*channel) (1 us for 2 Hz at 47 ms), and in the noise the crest of
+  * a neighbour cycle wins now and then, a few pings in a hundred at 5 to
+  * 8 dB of SNR over the band of the capture.
+  *
+  * The self test compares the kernels with the correlation in double and
+  * estimates pings of both lengths at random offsets between samples with
+  * all three methods. The benchmark prints CSV lines
+  *   template_ms,capture_ms,method,fft,ms_per_call,msamples_per_s
+  * for captures of 50 to 1000 ms, best of 3 over at least -t seconds (0.05
+  * default), a sample is one sample of the capture. Exit code is the number
+  * of failed checks, 1 for no peak in a capture.
+  ******************************************************************************
+  */
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include "arm_math.h"
+#include "freqplan.h"
+
+/* Private define ------------------------------------------------------------*/
+#define MAX_FFT         4096          // arm_rfft_fast_f32()
+#define MAX_AUTO_FFT    2048          // partitions of 1024 for the long templates
+#define FFT_TEMPLATE    64            // longer templates go through the FFT
+#define SCRATCH_PAD     2
+#define TEST_PINGS      16
+
+/* Private typedef -----------------------------------------------------------*/
+typedef enum
+{
+  METHOD_CORR,
+  METHOD_PARTIAL,
+  METHOD_FFT,
+  METHOD_AUTO
+} Method;
+
+typedef struct
+{
+  uint32_t length;
+  double w;                           // channel, rad/sample
+  float32_t* sine;                    // template, unit amplitude
+  q15_t* q15;                         // template of the q15 kernels, scaled to the capture
+  q15_t* reversed;                    // the same backwards for the convolution
+  double gainQ15;                     // correlation of a unit sine with q15[]
+  uint32_t fft;                       // points of the FFT, partitions of fft/2 samples
+  arm_rfft_fast_instance_f32 rfft;
+  float32_t* spectra;                 // partitions of the reversed template, fft values each
+  uint32_t parts;
+  double gainF32;                     // correlation of a unit sine with the float template
+} Template;
+
+/* Private variables ---------------------------------------------------------*/
+static const uint32_t planHz[FREQ_CHANNELS] =
+{
+#define PLAN_HZ(ch, hz)  [ch - 1] = hz,
+  FREQ_PLAN(PLAN_HZ)
+};
+static const char* const methodName[] = {"corr", "partial", "fft", "auto"};
+
+static uint32_t sampleRate = 200000, fftLen = 0;
+static uint32_t seed = 1;
+static unsigned failed = 0;
+
+/* Private functions ---------------------------------------------------------*/
+static uint32_t rnd(void)
+{
+  seed ^= seed << 13;
+  seed ^= seed >> 17;
+  seed ^= seed << 5;
+  return seed;
+}
+
+static void check(const char* name, int i, int ok)
+{
+  if(!ok)
+  {
+    printf("FAIL %s %d\n", name, i);
+    failed++;
+  }
+}
+
+static double now(void)
+{
+  struct timespec t;
+
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return t.tv_sec + t.tv_nsec*1e-9;
+}
+
+static double toMs(double samples)
+{
+  return 1e3*samples/sampleRate;
+}
+
+/* sine of hz from phase 0 over length samples and the spectra of its
+   partitions, fft of -n or twice the template up to MAX_AUTO_FFT */
+static void makeTemplate(Template* t, double hz, uint32_t length)
+{
+  uint32_t half;
+  float32_t frame[MAX_FFT];
+
+  for(t->fft = 32; (t->fft < 2*length)&&(t->fft < MAX_AUTO_FFT); t->fft *= 2);
+  if(fftLen != 0)t->fft = fftLen;
+  arm_rfft_fast_init_f32(&t->rfft, (uint16_t)t->fft);
+  half = t->fft/2;
+  t->length = length;
+  t->w = 2.0*PI*hz/sampleRate;
+  t->parts = (length + half - 1)/half;
+  t->sine = malloc(length*sizeof(float32_t));
+  t->q15 = malloc(length*sizeof(q15_t));
+  t->reversed = malloc(length*sizeof(q15_t));
+  t->spectra = malloc((size_t)t->parts*t->fft*sizeof(float32_t));
+  t->gainF32 = 0;
+  for(uint32_t n = 0; n < length; n++)
+  {
+    t->sine[n] = (float32_t)sin(t->w*n);
+    t->gainF32 += (double)t->sine[n]*t->sine[n];
+  }
+  /* partition p holds the reversed template from p*fft/2, zero padded */
+  for(uint32_t p = 0; p < t->parts; p++)
+  {
+    memset(frame, 0, sizeof(frame));
+    for(uint32_t j = 0; (j < half)&&(p*half + j < length); j++)
+    {
+      frame[j] = t->sine[length - 1 - (p*half + j)];
+    }
+    arm_rfft_fast_f32(&t->rfft, frame, t->spectra + p*t->fft, 0);
+  }
+}
+
+static void freeTemplate(Template* t)
+{
+  free(t->sine);
+  free(t->q15);
+  free(t->reversed);
+  free(t->spectra);
+}
+
+static Method methodOf(const Template* t, Method m)
+{
+  if(m != METHOD_AUTO)return m;
+  return (t->length <= FFT_TEMPLATE) ? METHOD_PARTIAL : METHOD_FFT;
+}
+
+/* r[k] = sum x[k + n] t[n] / gain, the amplitude of the template at lag k,
+   for the length - template + 1 lags inside the capture */
+static void correlateQ15(Template* t, Method m, q15_t* x, uint32_t length, float* r)
+{
+  uint32_t lags = length - t->length + 1;
+  q15_t hi, lo;
+  uint32_t index;
+  double amplitude;
+  /* the kernels read the pair past the end of the scratch */
+  q15_t* out = malloc((2*(size_t)length - 1)*sizeof(q15_t));
+  q15_t* scratch1 = calloc((size_t)length + 2*t->length - 2 + SCRATCH_PAD, sizeof(q15_t));
+  q15_t* scratch2 = calloc(t->length + SCRATCH_PAD, sizeof(q15_t));
+  const q15_t* first;
+
+  /* the largest template the 2.30 accumulators take on this capture, a
+     weak capture keeps the bits of the correlation */
+  arm_max_q15(x, length, &hi, &index);
+  arm_min_q15(x, length, &lo, &index);
+  amplitude = floor(1073741823.0/((double)t->length*((hi > -lo) ? hi : -lo) + 1));
+  if(amplitude > 32767)amplitude = 32767;
+  t->gainQ15 = 0;
+  for(uint32_t n = 0; n < t->length; n++)
+  {
+    t->q15[n] = (q15_t)lrint(amplitude*t->sine[n]);
+    t->reversed[t->length - 1 - n] = t->q15[n];
+    t->gainQ15 += t->q15[n]*(double)t->sine[n];
+  }
+
+  if(m == METHOD_CORR)
+  {
+    /* 2 length - 1 lags, the template starts at x[0] at length - 1 */
+    arm_correlate_fast_opt_q15(x, length, t->q15, t->length, out, scratch1);
+    first = out + length - 1;
+  }
+  else
+  {
+    /* x * reversed at template - 1 is the template at x[0] */
+    arm_conv_partial_fast_opt_q15(x, length, t->reversed, t->length, out, t->length - 1, lags, scratch1,
+                                  scratch2);
+    first = out + t->length - 1;
+  }
+  for(uint32_t k = 0; k < lags; k++)r[k] = (float)(first[k]/t->gainQ15);
+  free(out);
+  free(scratch1);
+  free(scratch2);
+}
+
+/* the same by overlap-save: frame k is x from (k - 1) fft/2 for fft
+   samples, the newest fft/2 outputs of the sum of the spectra of frame
+   k - p times partition p are the convolution at k fft/2 */
+static void correlateFft(Template* t, q15_t* x, uint32_t length, float* r)
+{
+  uint32_t fft = t->fft, half = fft/2, blocks = (length + half - 1)/half, first = t->length - 1;
+  float32_t* ring = calloc((size_t)t->parts*fft, sizeof(float32_t));
+  float32_t frame[MAX_FFT], sum[MAX_FFT], product[MAX_FFT], out[MAX_FFT];
+
+  for(uint32_t k = 0; k < blocks; k++)
+  {
+    int64_t start = (int64_t)k*half - half;
+
+    for(uint32_t n = 0; n < fft; n++)
+    {
+      int64_t i = start + n;
+      frame[n] = ((i >= 0)&&(i < length)) ? x[i]*(1.0f/32768.0f) : 0.0f;
+    }
+    arm_rfft_fast_f32(&t->rfft, frame, ring + (k % t->parts)*fft, 0);
+
+    memset(sum, 0, sizeof(sum));
+    for(uint32_t p = 0; (p < t->parts)&&(p <= k); p++)
+    {
+      float32_t* a = ring + ((k - p) % t->parts)*fft;
+      float32_t* b = t->spectra + p*fft;
+
+      /* the first pair holds the real values at 0 and fft/2 */
+      product[0] = a[0]*b[0];
+      product[1] = a[1]*b[1];
+      arm_cmplx_mult_cmplx_f32(a + 2, b + 2, product + 2, half - 1);
+      arm_add_f32(sum, product, sum, fft);
+    }
+    arm_rfft_fast_f32(&t->rfft, sum, out, 1);
+
+    for(uint32_t i = 0; i < half; i++)
+    {
+      uint32_t m = k*half + i;
+      if((m >= first)&&(m < length))r[m - first] = (float)(out[half + i]/t->gainF32);
+    }
+  }
+  free(ring);
+}
+
+static void correlate(Template* t, Method m, q15_t* x, uint32_t length, float* r)
+{
+  if(methodOf(t, m) == METHOD_FFT)correlateFft(t, x, length, r);
+  else correlateQ15(t, methodOf(t, m), x, length, r);
+}
+
+/* crest of the cosine at the local maximum k: the vertex p of the parabola
+   through it and its neighbours, corrected to the cosine of the channel,
+   and the height of the cosine there */
+static double crest(const Template* t, const float* r, uint32_t lags, uint32_t k, double* height)
+{
+  double d = 0;
+
+  if((k > 0)&&(k + 1 < lags))
+  {
+    double curve = r[k - 1] - 2.0*r[k] + r[k + 1];
+
+    if(curve < 0)
+    {
+      double p = (r[k - 1] - r[k + 1])/(2.0*curve);
+      d = atan(2.0*p*tan(t->w/2))/t->w;
+    }
+  }
+  *height = r[k]/cos(t->w*d);
+  return k + d;
+}
+
+/* arrival at the highest crest: the samples hit the crests of the carrier
+   at different phases, down to cos(w/2) of the crest, so the largest
+   sample may be many cycles off on the flat top of the triangle; every
+   local maximum that could be under a higher crest is compared */
+static double estimate(const Template* t, const float* r, uint32_t lags, double* amplitude)
+{
+  uint32_t k = 0;
+  double arrival, floorLevel;
+
+  for(uint32_t i = 1; i < lags; i++)
+  {
+    if(r[i] > r[k])k = i;
+  }
+  arrival = crest(t, r, lags, k, amplitude);
+  floorLevel = r[k]*cos(t->w/2);
+  for(uint32_t i = 1; i + 1 < lags; i++)
+  {
+    double height, a;
+
+    if((i == k)||(r[i] < floorLevel)||(r[i] < r[i - 1])||(r[i] < r[i + 1]))continue;
+    a = crest(t, r, lags, i, &height);
+    if(height > *amplitude)
+    {
+      *amplitude = height;
+      arrival = a;
+    }
+  }
+  return arrival;
+}
+
+/* the kernels against the correlation in double for random templates and
+   captures: the q15 ones exactly (the fast kernels truncate), the FFT
+   within the rounding of float */
+static void checkKernels(void)
+{
+  for(int i = 0; i < 8; i++)
+  {
+    Template t;
+    uint32_t tl = 16 + rnd() % 3000, length = tl + rnd() % 5000, lags = length - tl + 1;
+    q15_t* x = malloc(length*sizeof(q15_t));
+    float* r = malloc(lags*sizeof(float));
+    float* ref = malloc(lags*sizeof(float));
+    double worst[3] = {0, 0, 0};
+
+    makeTemplate(&t, planHz[rnd() % FREQ_CHANNELS], tl);
+    int shift = i % 8;
+
+    for(uint32_t n = 0; n < length; n++)x[n] = (q15_t)((int16_t)rnd() >> shift);
+    for(Method m = METHOD_CORR; m <= METHOD_FFT; m++)
+    {
+      correlate(&t, m, x, length, r);
+      for(uint32_t k = 0; k < lags; k++)
+      {
+        double sum = 0;
+
+        for(uint32_t n = 0; n < tl; n++)
+        {
+          sum += (m == METHOD_FFT) ? x[k + n]/32768.0*t.sine[n] : (double)x[k + n]*t.q15[n];
+        }
+        ref[k] = (m == METHOD_FFT) ? (float)(sum/t.gainF32) : (float)(floor(sum/32768.0)/t.gainQ15);
+        if(fabs(r[k] - ref[k]) > worst[m])worst[m] = fabs(r[k] - ref[k]);
+      }
+    }
+    /* a full scale capture correlates to sqrt(template/2) or so */
+    check("corr", i, worst[METHOD_CORR] == 0);
+    check("partial", i, worst[METHOD_PARTIAL] == 0);
+    check("fft", i, worst[METHOD_FFT] < 1e-5);
+    if(i == 0)printf("template %u, capture %u: fft within %.1e of double\n", (unsigned)tl, (unsigned)length,
+                     worst[METHOD_FFT]);
+    freeTemplate(&t);
+    free(x);
+    free(r);
+    free(ref);
+  }
+}
+
+/* pings of -20 dBFS from phase 0 at a random arrival between samples, up
+   to 2 Hz off the channel, white noise 40 dB under the ping */
+static void checkPings(void)
+{
+  static const uint32_t durationMs[] = {29, 47};
+  double worst[3] = {0, 0, 0};
+
+  for(int i = 0; i < TEST_PINGS; i++)
+  {
+    Template t;
+    int ch = (int)(rnd() % FREQ_CHANNELS);
+    uint32_t ms = durationMs[i & 1], tl = ms*sampleRate/1000;
+    uint32_t length = tl + tl/2 + rnd() % tl, lags = length - tl + 1;
+    double arrival = 100.0 + (rnd() % (lags - 200)) + (rnd() % 1000)/1000.0;
+    double hz = planHz[ch] + ((int)(rnd() % 401) - 200)/100.0;
+    q15_t* x = malloc(length*sizeof(q15_t));
+    float* r = malloc(lags*sizeof(float));
+
+    makeTemplate(&t, planHz[ch], tl);
+    for(uint32_t n = 0; n < length; n++)
+    {
+      double v = ((int32_t)rnd() >> 8)*(0.0017/8388608.0);
+
+      if((n >= arrival)&&(n < arrival + tl))v += 0.1*sin(2.0*PI*hz*(n - arrival)/sampleRate);
+      x[n] = (q15_t)lrint(v*32768.0);
+    }
+    for(Method m = METHOD_CORR; m <= METHOD_FFT; m++)
+    {
+      double amplitude, e;
+
+      correlate(&t, m, x, length, r);
+      e = fabs(estimate(&t, r, lags, &amplitude) - arrival);
+      if(e > worst[m])worst[m] = e;
+      /* the offset moves the arrival by up to 1 us, the noise by a tenth */
+      check(methodName[m], i, e < 1.5e-6*sampleRate);
+      check("level", i, fabs(20.0*log10(amplitude) + 20.0) < 0.5);
+    }
+    freeTemplate(&t);
+    free(x);
+    free(r);
+  }
+  printf("%d pings: arrival within %.3f us corr, %.3f us partial, %.3f us fft\n", TEST_PINGS,
+         1e6*worst[METHOD_CORR]/sampleRate, 1e6*worst[METHOD_PARTIAL]/sampleRate,
+         1e6*worst[METHOD_FFT]/sampleRate);
+}
+
+static void benchmark(double minTime)
+{
+  static const uint32_t durationMs[] = {29, 47};
+  static const uint32_t captureMs[] = {50, 100, 200, 500, 1000};
+
+  printf("template_ms,capture_ms,method,fft,ms_per_call,msamples_per_s\n");
+  for(int d = 0; d < 2; d++)
+  {
+    Template t;
+    uint32_t tl = durationMs[d]*sampleRate/1000;
+
+    makeTemplate(&t, planHz[0], tl);
+    for(uint32_t c = 0; c < sizeof(captureMs)/sizeof(captureMs[0]); c++)
+    {
+      uint32_t length = captureMs[c]*sampleRate/1000, lags = length - tl + 1;
+      q15_t* x = malloc(length*sizeof(q15_t));
+      float* r = malloc(lags*sizeof(float));
+
+      for(uint32_t n = 0; n < length; n++)x[n] = (q15_t)((int16_t)rnd() >> 2);
+      for(Method m = METHOD_CORR; m <= METHOD_FFT; m++)
+      {
+        double best = 1e30;
+
+        for(int run = 0; run < 3; run++)
+        {
+          double start = now(), elapsed;
+          uint32_t calls = 0;
+
+          do
+          {
+            correlate(&t, m, x, length, r);
+            calls++;
+            elapsed = now() - start;
+          } while(elapsed < minTime);
+          if(elapsed/calls < best)best = elapsed/calls;
+        }
+        printf("%u,%u,%s,%u,%.3f,%.2f\n", (unsigned)durationMs[d], (unsigned)captureMs[c], methodName[m],
+               (m == METHOD_FFT) ? (unsigned)t.fft : 0u, best*1e3, length*1e-6/best);
+        fflush(stdout);
+      }
+      free(x);
+      free(r);
+    }
+    freeTemplate(&t);
+  }
+}
+
+static q15_t* readCapture(FILE* f, uint32_t* length)
+{
+  uint32_t size = 65536, n = 0;
+  q15_t* x = malloc(size*sizeof(q15_t));
+  uint8_t raw[2];
+
+  while(fread(raw, 2, 1, f) == 1)
+  {
+    if(n == size)x = realloc(x, (size *= 2)*sizeof(q15_t));
+    x[n++] = (q15_t)(raw[0] | (raw[1] << 8));
+  }
+  *length = n;
+  return x;
+}
+
+static void usage(void)
+{
+  fprintf(stderr, "usage: pingtoa [-r rate] [-d 29|47] [-m corr|partial|fft] [-n fft] -c ch file\n"
+                  "       pingtoa -s [-r rate] [-n fft]\n"
+                  "       pingtoa -b [-r rate] [-n fft] [-t seconds]\n");
+  exit(1);
+}
+
+int main(int argc, char* argv[])
+{
+  const char* name = NULL;
+  int test = 0, bench = 0, ch = 0;
+  uint32_t durationMs = 29, length, topHz = 0;
+  Method method = METHOD_AUTO;
+  double minTime = 0.05, amplitude, arrival;
+  Template t;
+  q15_t* x;
+  float* r;
+  FILE* f;
+
+  for(int i = 1; i < argc; i++)
+  {
+    if(strcmp(argv[i], "-s") == 0)test = 1;
+    else if(strcmp(argv[i], "-b") == 0)bench = 1;
+    else if((strcmp(argv[i], "-r") == 0)&&(i + 1 < argc))sampleRate = strtoul(argv[++i], NULL, 0);
+    else if((strcmp(argv[i], "-n") == 0)&&(i + 1 < argc))fftLen = strtoul(argv[++i], NULL, 0);
+    else if((strcmp(argv[i], "-d") == 0)&&(i + 1 < argc))durationMs = strtoul(argv[++i], NULL, 0);
+    else if((strcmp(argv[i], "-c") == 0)&&(i + 1 < argc))ch = atoi(argv[++i]);
+    else if((strcmp(argv[i], "-t") == 0)&&(i + 1 < argc))minTime = atof(argv[++i]);
+    else if((strcmp(argv[i], "-m") == 0)&&(i + 1 < argc))
+    {
+      i++;
+      for(method = METHOD_CORR; (method < METHOD_AUTO)&&(strcmp(argv[i], methodName[method]) != 0); method++);
+      if(method == METHOD_AUTO)usage();
+    }
+    else if(name == NULL)name = argv[i];
+    else usage();
+  }
+  if((fftLen != 0)&&((fftLen > MAX_FFT)||(arm_rfft_fast_init_f32(&t.rfft, (uint16_t)fftLen) != ARM_MATH_SUCCESS)))
+  {
+    fprintf(stderr, "fft %u not supported, 32 to %u\n", (unsigned)fftLen, MAX_FFT);
+    return 1;
+  }
+  /* the q15 template of 47 ms keeps an amplitude of 2 or more on a full
+     scale capture; the sum at twice the channel ripples the crests by
+     about 1/(length sin w) of the peak, at 3 times the channel it is
+     under half of the step of the triangle from one cycle to the next */
+  for(int i = 0; i < FREQ_CHANNELS; i++)
+  {
+    if(planHz[i] > topHz)topHz = planHz[i];
+  }
+  if(((uint64_t)topHz*3 > sampleRate)||(sampleRate > 320000))
+  {
+    fprintf(stderr, "rate %u not supported, %u to 320000\n", (unsigned)sampleRate, (unsigned)(topHz*3));
+    return 1;
+  }
+  if(test)
+  {
+    checkKernels();
+    checkPings();
+    printf("%u checks failed\n", failed);
+    return (int)failed;
+  }
+  if(bench)
+  {
+    benchmark(minTime);
+    return 0;
+  }
+  if((name == NULL)||(ch < 1)||(ch > FREQ_CHANNELS)||(durationMs == 0)||(durationMs > 1000))usage();
+  f = (strcmp(name, "-") == 0) ? stdin : fopen(name, "rb");
+  if(f == NULL)
+  {
+    perror(name);
+    return 1;
+  }
+  x = readCapture(f, &length);
+  if(f != stdin)fclose(f);
+
+  makeTemplate(&t, planHz[ch - 1], durationMs*sampleRate/1000);
+  if(length < t.length + 2)
+  {
+    fprintf(stderr, "capture of %u samples shorter than the template of %u\n", (unsigned)length,
+            (unsigned)t.length);
+    return 1;
+  }
+  r = malloc((length - t.length + 1)*sizeof(float));
+  correlate(&t, method, x, length, r);
+  arrival = estimate(&t, r, length - t.length + 1, &amplitude);
+  printf("%12.4f ms  ch %2d %6u Hz  %u ms  %6.1f dBFS  %s\n", toMs(arrival), ch, (unsigned)planHz[ch - 1],
+         (unsigned)durationMs, 20.0*log10(fabs(amplitude) + 1e-10), methodName[methodOf(&t, method)]);
+  freeTemplate(&t);
+  free(x);
+  free(r);
+  return (amplitude > 0) ? 0 : 1;
+}
@@ -0,0 +1,225 @@
+/**
+  ******************************************************************************
+  * @file    schedc.c
+  * @author  AKabanov
+  * @brief   host compiler and simulator of the ping schedule (common/sched.h)
+  ******************************************************************************
+  * build:  gcc -O2 -I../common -o schedc schedc.c
+  * usage:  schedc schedule.txt              hex line for bootloader 's' command
+  *         schedc -c schedule.txt           C initializer of sched_t
+  *         schedc -s mode states schedule.txt
+  *                                          run the interpreter of the
+  *                                          application for the sensor states
+  *                                          of consecutive pings, like 0001111
+  *
+  * Description, one program per line, '#' starts a comment:
+  *   trim -70                   ticks added to every interval (wake duration)
+  *   normal full 5x10 15x10 30  10 pings every 5 s after a change,
+  *                              then 10 every 15 s, then every 30 s
+  * Mode is fast, normal, slow or marport, sensor state is empty or full.
+  * Interval is in seconds, or in RTC wakeup ticks with 't' suffix (1/2048 s).
+  * The hex line is 8 digits per word, send it with character delay
+  * (the bootloader receives one character at a time), then return.
+  ******************************************************************************
+  */
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "sched.c"
+
+/* Private variables ---------------------------------------------------------*/
+static const char* modeName[SCHED_MODES] = {"fast", "normal", "slow", "marport"};
+static const char* stateName[SCHED_STATES] = {"empty", "full"};
+
+/* Private functions ---------------------------------------------------------*/
+static int findName(const char* name, const char** names, int num)
+{
+  for(int i = 0; i < num; i++)if(strcmp(name, names[i]) == 0)return i;
+  return -1;
+}
+
+static int parsePhase(const char* text, long trim, uint32_t* phase)
+{
+  char* end;
+  double value = strtod(text, &end);
+  long ticks, count = 0;
+
+  if(end == text)return -1;
+  if(*end == 't')
+  {
+    ticks = (long)value;
+    end++;
+  }
+  else ticks = (long)(value*SCHED_TICKS + 0.5);
+  if(*end == 'x')
+  {
+    count = strtol(end + 1, &end, 10);
+    if((count < 1)||(count > 255))return -1;
+  }
+  if(*end != 0)return -1;
+  ticks += trim;
+  if((ticks < 1)||(ticks > (long)SCHED_MAX_INTERVAL))return -1;
+  *phase = SCHED_PHASE((uint32_t)ticks, (uint32_t)count);
+  return 0;
+}
+
+static int compile(FILE* file, sched_t* sched)
+{
+  char line[256];
+  int lineNum = 0, phases = 0;
+  long trim = 0;
+  uint8_t defined[SCHED_MODES][SCHED_STATES] = {{0}};
+
+  memset(sched, 0, sizeof(*sched));
+  sched->magic = SCHED_MAGIC;
+  while(fgets(line, sizeof(line), file) != NULL)
+  {
+    char* word[2 + SCHED_PHASES];
+    int words = 0;
+
+    lineNum++;
+    if(strchr(line, '#') != NULL)*strchr(line, '#') = 0;
+    for(char* tok = strtok(line, " \t\r\n"); tok != NULL; tok = strtok(NULL, " \t\r\n"))
+    {
+      if(words == 2 + SCHED_PHASES)
+      {
+        fprintf(stderr, "line %d: too many phases\n", lineNum);
+        return -1;
+      }
+      word[words++] = tok;
+    }
+    if(words == 0)continue;
+    if(strcmp(word[0], "trim") == 0)
+    {
+      if(words != 2)
+      {
+        fprintf(stderr, "line %d: trim <ticks>\n", lineNum);
+        return -1;
+      }
+      trim = strtol(word[1], NULL, 10);
+      continue;
+    }
+    int mode = findName(word[0], modeName, SCHED_MODES);
+    int state = (words > 1) ? findName(word[1], stateName, SCHED_STATES) : -1;
+    if((mode < 0)||(state < 0)||(words < 3))
+    {
+      fprintf(stderr, "line %d: <mode> <state> <interval>[x<count>] ...\n", lineNum);
+      return -1;
+    }
+    if(phases + words - 2 > SCHED_PHASES)
+    {
+      fprintf(stderr, "line %d: more than %d phases in the table\n", lineNum, SCHED_PHASES);
+      return -1;
+    }
+    sched->first[mode][state] = (uint8_t)phases;
+    defined[mode][state] = 1;
+    for(int i = 2; i < words; i++)
+    {
+      uint32_t phase;
+      if(parsePhase(word[i], trim, &phase) != 0)
+      {
+        fprintf(stderr, "line %d: bad interval '%s'\n", lineNum, word[i]);
+        return -1;
+      }
+      /* the last phase of a program is repeated forever */
+      if(i == words - 1)phase = SCHED_PHASE(SCHED_INTERVAL(phase), 0);
+      sched->phase[phases++] = phase;
+    }
+  }
+  for(int mode = 0; mode < SCHED_MODES; mode++)
+  {
+    for(int state = 0; state < SCHED_STATES; state++)
+    {
+      if(defined[mode][state])continue;
+      fprintf(stderr, "no program for %s %s\n", modeName[mode], stateName[state]);
+      return -1;
+    }
+  }
+  sched->check = schedSum(sched);
+  return schedCheck(sched);
+}
+
+static void printC(const sched_t* sched)
+{
+  printf("{\n  0x%08XUL,\n  {", (unsigned)sched->magic);
+  for(int mode = 0; mode < SCHED_MODES; mode++)
+  {
+    printf("{%u, %u}%s", sched->first[mode][0], sched->first[mode][1],
+           (mode < SCHED_MODES - 1) ? ", " : "},\n  {\n");
+  }
+  for(int i = 0; i < SCHED_PHASES; i++)
+  {
+    printf("    SCHED_PHASE(%uUL, %u),\n", (unsigned)SCHED_INTERVAL(sched->phase[i]),
+           (unsigned)SCHED_COUNT(sched->phase[i]));
+  }
+  printf("  },\n  0x%08XUL\n}\n", (unsigned)sched->check);
+}
+
+static void printHex(const sched_t* sched)
+{
+  const uint32_t* word = (const uint32_t*)sched;
+  for(uint32_t i = 0; i < SCHED_WORDS; i++)printf("%08X", (unsigned)word[i]);
+  printf("\n");
+}
+
+static int simulate(const sched_t* sched, const char* modeText, const char* states)
+{
+  schedState_t state = {0, 0};
+  int mode = findName(modeText, modeName, SCHED_MODES);
+  double time = 0;
+
+  if(mode < 0)
+  {
+    fprintf(stderr, "unknown mode '%s'\n", modeText);
+    return 1;
+  }
+  printf("ping,time_s,sensor,interval_s,wakes\n");
+  for(int ping = 0; states[ping] != 0; ping++)
+  {
+    uint32_t sens = (states[ping] == '1') ? 1 : 0;
+    uint32_t ticks = schedPing(sched, &state, (uint32_t)mode, sens);
+    unsigned wakes = 1;
+    uint32_t sleep;
+
+    while((sleep = schedWake(&state)) != 0)
+    {
+      ticks += sleep;
+      wakes++;
+    }
+    printf("%d,%.3f,%s,%.3f,%u\n", ping + 1, time, stateName[sens],
+           (double)ticks/SCHED_TICKS, wakes);
+    time += (double)ticks/SCHED_TICKS;
+  }
+  return 0;
+}
+
+int main(int argc, char* argv[])
+{
+  sched_t sched;
+  FILE* file;
+  const char* name = argv[argc - 1];
+
+  if((argc < 2)||((strcmp(argv[1], "-s") == 0)&&(argc != 5)))
+  {
+    fprintf(stderr, "usage: schedc [-c | -s mode states] schedule.txt\n");
+    return 1;
+  }
+  file = fopen(name, "r");
+  if(file == NULL)
+  {
+    perror(name);
+    return 1;
+  }
+  if(compile(file, &sched) != 0)
+  {
+    fprintf(stderr, "%s: schedule is not valid\n", name);
+    return 1;
+  }
+  fclose(file);
+  if(strcmp(argv[1], "-c") == 0)printC(&sched);
+  else if(strcmp(argv[1], "-s") == 0)return simulate(&sched, argv[2], argv[3]);
+  else printHex(&sched);
+  return 0;
+}
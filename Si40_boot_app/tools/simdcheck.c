@@ -0,0 +1,349 @@
+/**
+  ******************************************************************************
+  * @file    simdcheck.c
+  * @author  AKabanov
+  * @brief   differential test of the SSE4.1/AVX2 host kernels of CMSIS-DSP
+  *          against the portable C (common/Drivers/CMSIS/Include/arm_math_host.h)
+  ******************************************************************************
+  * build:  D=../common/Drivers/CMSIS/DSP_Lib/Source
+  *         gcc -O2 -DARM_MATH_HOST -DARM_MATH_HOST_SIMD -fno-strict-aliasing
+  *             -fwrapv -I../common/Drivers/CMSIS/Include -o simdcheck simdcheck.c
+  *             $D/HostFunctions/arm_host_simd.c
+  *             $D/HostFunctions/arm_host_sse41.c
+  *             $D/HostFunctions/arm_host_avx2.c
+  *             $D/FilteringFunctions/arm_fir_q15.c
+  *             $D/FilteringFunctions/arm_fir_init_q15.c
+  *             $D/FilteringFunctions/arm_fir_bank_q15.c
+  *             $D/FilteringFunctions/arm_fir_bank_init_q15.c
+  *             $D/FilteringFunctions/arm_biquad_cascade_df1_q15.c
+  *             $D/FilteringFunctions/arm_biquad_cascade_df1_init_q15.c
+  *             $D/FilteringFunctions/arm_biquad_cascade_df1_bank_q15.c
+  *             $D/FilteringFunctions/arm_biquad_cascade_df1_bank_init_q15.c
+  *             $D/BasicMathFunctions/arm_dot_prod_q31.c
+  *             $D/TransformFunctions/arm_cfft_q15.c
+  *             $D/TransformFunctions/arm_cfft_radix4_q15.c
+  *             $D/TransformFunctions/arm_bitreversal.c
+  *             $D/TransformFunctions/arm_bitreversal2.c
+  *             $D/CommonTables/arm_common_tables.c
+  *             $D/CommonTables/arm_const_structs.c -lm
+  * usage:  simdcheck [-n rounds]     rounds of random cases, 20 default
+  *
+  * Every kernel level the CPU has is run on the same operands as the
+  * portable C (<function>_portable) and the outputs and the states must be
+  * equal bit for bit. The operands are random with many edge values and
+  * runs of -32768 and 32767, so the 32 bit wrap of the dual multiplies and
+  * the saturation of the butterflies are hit:
+  *   arm_fir_q15                 4 - 130 taps, blocks 1 - 300, in place too
+  *   arm_cfft_q15                16 - 4096 points, forward and inverse,
+  *                               with and without bit reversal
+  *   arm_biquad_cascade_df1_q15  1 - 5 stages, post shift 0 - 3, random and
+  *                               stable sections, blocks across the chunk
+  *   arm_dot_prod_q31            0 - 4100 samples
+  *   arm_fir_bank_q15 and        1 - 35 filters, the portable bank against
+  *   arm_biquad_cascade_df1_bank_q15  the single filter C of every filter too,
+  *                               FIR with small coefficients too
+  * Exit code is the number of failed checks.
+  ******************************************************************************
+  */
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "arm_math_host.h"
+#include "arm_const_structs.h"
+
+/* Private define ------------------------------------------------------------*/
+#define MAX_TAPS        130
+#define MAX_BLOCK       600
+#define MAX_STAGES      5
+#define MAX_FFT         4096
+#define MAX_DOT         4100
+#define MAX_FILTERS     35
+#define CALLS           4             // blocks through one instance
+
+/* Private variables ---------------------------------------------------------*/
+static uint32_t seed = 1;
+static unsigned failed = 0, cases = 0;
+static const uint16_t taps[] = {4, 6, 8, 10, 14, 16, 18, 30, 32, 34, 46, 62, 64, 66, 100, 130};
+static const uint32_t blocks[] = {1, 2, 3, 4, 5, 7, 8, 15, 16, 17, 33, 64, 100, 255, 256, 257, 300, 513, 600};
+static const uint16_t filters[] = {1, 3, 4, 5, 7, 8, 9, 13, 16, 35};
+static const arm_cfft_instance_q15* const ffts[] =
+{
+  &arm_cfft_sR_q15_len16, &arm_cfft_sR_q15_len32, &arm_cfft_sR_q15_len64,
+  &arm_cfft_sR_q15_len128, &arm_cfft_sR_q15_len256, &arm_cfft_sR_q15_len512,
+  &arm_cfft_sR_q15_len1024, &arm_cfft_sR_q15_len2048, &arm_cfft_sR_q15_len4096
+};
+
+/* Private functions ---------------------------------------------------------*/
+static uint32_t rnd(void)
+{
+  seed ^= seed << 13;
+  seed ^= seed >> 17;
+  seed ^= seed << 5;
+  return seed;
+}
+
+/* q15 operands of a kind: 0 random, 1 with edges, 2 runs of full scale */
+static void fill15(q15_t* x, uint32_t length, uint32_t kind)
+{
+  static const q15_t edge[] = {0, 1, -1, 0x7FFF, -0x8000, 0x4000, -0x4000};
+
+  for(uint32_t i = 0; i < length; i++)
+  {
+    uint32_t r = rnd();
+
+    if((kind == 2)&&(r & 1))x[i] = (r & 2) ? 0x7FFF : -0x8000;
+    else if((kind >= 1)&&((r & 7) == 0))x[i] = edge[rnd() % (sizeof(edge)/sizeof(edge[0]))];
+    else x[i] = (q15_t)rnd();
+  }
+}
+
+static void fill31(q31_t* x, uint32_t length)
+{
+  static const q31_t edge[] = {0, 1, -1, 0x7FFFFFFF, (q31_t)0x80000000};
+
+  for(uint32_t i = 0; i < length; i++)
+  {
+    uint32_t r = rnd();
+
+    if((r & 7) == 0)x[i] = edge[rnd() % (sizeof(edge)/sizeof(edge[0]))];
+    else x[i] = (q31_t)rnd() >> (r % 24);
+  }
+}
+
+static void check(const char* name, uint32_t a, uint32_t b, int ok)
+{
+  cases++;
+  if(!ok)
+  {
+    printf("FAIL %s %u %u\n", name, (unsigned)a, (unsigned)b);
+    failed++;
+  }
+}
+
+static void checkFir(uint32_t numTaps, uint32_t blockSize, int inPlace)
+{
+  static q15_t coeffs[MAX_TAPS], stateRef[MAX_TAPS + MAX_BLOCK], stateSimd[MAX_TAPS + MAX_BLOCK];
+  static q15_t in[MAX_BLOCK], outRef[MAX_BLOCK], outSimd[MAX_BLOCK];
+  arm_fir_instance_q15 ref, simd;
+  int ok = 1;
+
+  fill15(coeffs, numTaps, rnd() % 3);
+  arm_fir_init_q15(&ref, numTaps, coeffs, stateRef, blockSize);
+  arm_fir_init_q15(&simd, numTaps, coeffs, stateSimd, blockSize);
+  for(int call = 0; call < CALLS; call++)
+  {
+    /* the last call is shorter, the block size may change */
+    uint32_t length = (call == CALLS - 1) ? 1 + rnd() % blockSize : blockSize;
+
+    fill15(in, length, rnd() % 3);
+    arm_fir_q15_portable(&ref, in, outRef, length);
+    if(inPlace)
+    {
+      memcpy(outSimd, in, length*sizeof(q15_t));
+      arm_fir_q15(&simd, outSimd, outSimd, length);
+    }
+    else arm_fir_q15(&simd, in, outSimd, length);
+    if(memcmp(outRef, outSimd, length*sizeof(q15_t)) != 0)ok = 0;
+    if(memcmp(stateRef, stateSimd, (numTaps - 1)*sizeof(q15_t)) != 0)ok = 0;
+  }
+  check(inPlace ? "arm_fir_q15 in place" : "arm_fir_q15", numTaps, blockSize, ok);
+}
+
+static void checkCfft(const arm_cfft_instance_q15* fft, uint8_t ifftFlag, uint8_t bitReverseFlag)
+{
+  static q15_t ref[2*MAX_FFT], simd[2*MAX_FFT];
+
+  fill15(ref, 2*fft->fftLen, rnd() % 3);
+  memcpy(simd, ref, 2*fft->fftLen*sizeof(q15_t));
+  arm_cfft_q15_portable(fft, ref, ifftFlag, bitReverseFlag);
+  arm_cfft_q15(fft, simd, ifftFlag, bitReverseFlag);
+  check(ifftFlag ? "arm_cfft_q15 inverse" : "arm_cfft_q15", fft->fftLen, bitReverseFlag,
+        memcmp(ref, simd, 2*fft->fftLen*sizeof(q15_t)) == 0);
+}
+
+static void checkBiquad(uint32_t stages, int8_t postShift, uint32_t blockSize, int stable)
+{
+  static q15_t coeffs[6*MAX_STAGES], stateRef[4*MAX_STAGES], stateSimd[4*MAX_STAGES];
+  static q15_t in[MAX_BLOCK], outRef[MAX_BLOCK], outSimd[MAX_BLOCK];
+  arm_biquad_casd_df1_inst_q15 ref, simd;
+  int ok = 1;
+
+  /* b0 0 b1 b2 a1 a2, random sections saturate and wrap */
+  fill15(coeffs, 6*stages, rnd() % 3);
+  for(uint32_t s = 0; s < stages; s++)
+  {
+    q15_t* c = &coeffs[6*s];
+    c[1] = 0;
+    if(stable)
+    {
+      c[0] = 0x0800 + (rnd() & 0x3FF);
+      c[4] = 0x3000 + (rnd() & 0x0FFF);
+      c[5] = -0x1800 - (q15_t)(rnd() & 0x07FF);
+    }
+  }
+  arm_biquad_cascade_df1_init_q15(&ref, stages, coeffs, stateRef, postShift);
+  arm_biquad_cascade_df1_init_q15(&simd, stages, coeffs, stateSimd, postShift);
+  for(int call = 0; call < CALLS; call++)
+  {
+    uint32_t length = (call == CALLS - 1) ? 1 + rnd() % blockSize : blockSize;
+
+    fill15(in, length, rnd() % 3);
+    arm_biquad_cascade_df1_q15_portable(&ref, in, outRef, length);
+    if(call & 1)
+    {
+      memcpy(outSimd, in, length*sizeof(q15_t));
+      arm_biquad_cascade_df1_q15(&simd, outSimd, outSimd, length);
+    }
+    else arm_biquad_cascade_df1_q15(&simd, in, outSimd, length);
+    if(memcmp(outRef, outSimd, length*sizeof(q15_t)) != 0)ok = 0;
+    if(memcmp(stateRef, stateSimd, 4*stages*sizeof(q15_t)) != 0)ok = 0;
+  }
+  check(stable ? "arm_biquad_cascade_df1_q15 stable" : "arm_biquad_cascade_df1_q15",
+        stages*10 + postShift, blockSize, ok);
+}
+
+/* the bank against the single filters of the portable C and the kernels
+   against the portable bank */
+static void checkFirBank(uint32_t numFilters, uint32_t numTaps, uint32_t blockSize)
+{
+  static q15_t coeffs[MAX_FILTERS*MAX_TAPS], bankRef[MAX_FILTERS*MAX_TAPS], bankSimd[MAX_FILTERS*MAX_TAPS];
+  static q15_t state[MAX_FILTERS][MAX_TAPS + MAX_BLOCK];
+  static q15_t stateRef[MAX_TAPS + MAX_BLOCK], stateSimd[MAX_TAPS + MAX_BLOCK];
+  static q15_t in[MAX_BLOCK], out[MAX_BLOCK];
+  static q15_t outRef[MAX_FILTERS*MAX_BLOCK], outSimd[MAX_FILTERS*MAX_BLOCK];
+  arm_fir_instance_q15 single[MAX_FILTERS];
+  arm_fir_bank_instance_q15 ref, simd;
+  int ok = 1;
+
+  /* small coefficients too, the kernels add them up in 32 bit */
+  fill15(coeffs, numFilters*numTaps, rnd() % 3);
+  if(rnd() & 1)for(uint32_t k = 0; k < numFilters*numTaps; k++)coeffs[k] >>= 7;
+  for(uint32_t f = 0; f < numFilters; f++)
+  {
+    arm_fir_init_q15(&single[f], numTaps, &coeffs[f*numTaps], state[f], blockSize);
+  }
+  arm_fir_bank_init_q15(&ref, numFilters, numTaps, coeffs, bankRef, stateRef, blockSize);
+  arm_fir_bank_init_q15(&simd, numFilters, numTaps, coeffs, bankSimd, stateSimd, blockSize);
+  for(int call = 0; call < CALLS; call++)
+  {
+    uint32_t length = (call == CALLS - 1) ? 1 + rnd() % blockSize : blockSize;
+
+    fill15(in, length, rnd() % 3);
+    arm_fir_bank_q15_portable(&ref, in, outRef, length);
+    arm_fir_bank_q15(&simd, in, outSimd, length);
+    for(uint32_t f = 0; f < numFilters; f++)
+    {
+      arm_fir_q15_portable(&single[f], in, out, length);
+      for(uint32_t n = 0; n < length; n++)if(out[n] != outRef[n*numFilters + f])ok = 0;
+    }
+    if(memcmp(outRef, outSimd, numFilters*length*sizeof(q15_t)) != 0)ok = 0;
+    if(memcmp(stateRef, stateSimd, (numTaps - 1)*sizeof(q15_t)) != 0)ok = 0;
+  }
+  check("arm_fir_bank_q15", numFilters*1000 + numTaps, blockSize, ok);
+}
+
+static void checkBiquadBank(uint32_t numFilters, uint32_t stages, int8_t postShift, uint32_t blockSize)
+{
+  static q15_t coeffs[MAX_FILTERS*6*MAX_STAGES], bankRef[MAX_FILTERS*6*MAX_STAGES], bankSimd[MAX_FILTERS*6*MAX_STAGES];
+  static q15_t state[MAX_FILTERS][4*MAX_STAGES];
+  static q15_t stateRef[MAX_FILTERS*4*MAX_STAGES], stateSimd[MAX_FILTERS*4*MAX_STAGES];
+  static q15_t in[MAX_BLOCK], out[MAX_BLOCK];
+  static q15_t outRef[MAX_FILTERS*MAX_BLOCK], outSimd[MAX_FILTERS*MAX_BLOCK];
+  arm_biquad_casd_df1_inst_q15 single[MAX_FILTERS];
+  arm_biquad_casd_df1_bank_inst_q15 ref, simd;
+  int ok = 1;
+
+  /* random sections, the saturation and the wrap in every filter */
+  fill15(coeffs, numFilters*6*stages, rnd() % 3);
+  for(uint32_t f = 0; f < numFilters; f++)
+  {
+    for(uint32_t s = 0; s < stages; s++)coeffs[(f*stages + s)*6 + 1] = 0;
+    arm_biquad_cascade_df1_init_q15(&single[f], stages, &coeffs[f*6*stages], state[f], postShift);
+  }
+  arm_biquad_cascade_df1_bank_init_q15(&ref, numFilters, stages, coeffs, bankRef, stateRef, postShift);
+  arm_biquad_cascade_df1_bank_init_q15(&simd, numFilters, stages, coeffs, bankSimd, stateSimd, postShift);
+  for(int call = 0; call < CALLS; call++)
+  {
+    uint32_t length = (call == CALLS - 1) ? 1 + rnd() % blockSize : blockSize;
+
+    fill15(in, length, rnd() % 3);
+    arm_biquad_cascade_df1_bank_q15_portable(&ref, in, outRef, length);
+    arm_biquad_cascade_df1_bank_q15(&simd, in, outSimd, length);
+    for(uint32_t f = 0; f < numFilters; f++)
+    {
+      arm_biquad_cascade_df1_q15_portable(&single[f], in, out, length);
+      for(uint32_t n = 0; n < length; n++)if(out[n] != outRef[n*numFilters + f])ok = 0;
+    }
+    if(memcmp(outRef, outSimd, numFilters*length*sizeof(q15_t)) != 0)ok = 0;
+    if(memcmp(stateRef, stateSimd, numFilters*4*stages*sizeof(q15_t)) != 0)ok = 0;
+  }
+  check("arm_biquad_cascade_df1_bank_q15", numFilters*100 + stages*10 + postShift, blockSize, ok);
+}
+
+static void checkDot(uint32_t length)
+{
+  static q31_t a[MAX_DOT], b[MAX_DOT];
+  q63_t ref, simd;
+
+  fill31(a, length);
+  fill31(b, length);
+  arm_dot_prod_q31_portable(a, b, length, &ref);
+  arm_dot_prod_q31(a, b, length, &simd);
+  check("arm_dot_prod_q31", length, 0, ref == simd);
+}
+
+static void checkLevel(uint32_t rounds)
+{
+  for(uint32_t round = 0; round < rounds; round++)
+  {
+    for(uint32_t t = 0; t < sizeof(taps)/sizeof(taps[0]); t++)
+    {
+      for(uint32_t b = 0; b < sizeof(blocks)/sizeof(blocks[0]); b++)
+      {
+        checkFir(taps[t], blocks[b], (round + b) & 1);
+      }
+    }
+    for(uint32_t f = 0; f < sizeof(ffts)/sizeof(ffts[0]); f++)
+    {
+      for(uint8_t flags = 0; flags < 4; flags++)checkCfft(ffts[f], flags & 1, flags >> 1);
+    }
+    for(uint32_t stages = 1; stages <= MAX_STAGES; stages++)
+    {
+      for(uint32_t b = 0; b < sizeof(blocks)/sizeof(blocks[0]); b++)
+      {
+        checkBiquad(stages, (int8_t)(rnd() % 4), blocks[b], (b & 1) == 0);
+      }
+    }
+    for(uint32_t f = 0; f < sizeof(filters)/sizeof(filters[0]); f++)
+    {
+      uint32_t b = rnd() % (sizeof(blocks)/sizeof(blocks[0]));
+
+      checkFirBank(filters[f], taps[rnd() % (sizeof(taps)/sizeof(taps[0]))], blocks[b]);
+      checkBiquadBank(filters[f], 1 + rnd() % MAX_STAGES, (int8_t)(rnd() % 4), blocks[b]);
+    }
+    for(uint32_t length = 0; length < 40; length++)checkDot(length);
+    checkDot(1000 + rnd() % (MAX_DOT - 1000));
+  }
+}
+
+int main(int argc, char* argv[])
+{
+  uint32_t rounds = 20;
+  arm_host_simd_t cpu = arm_host_simd_detect();
+
+  if((argc > 2)&&(strcmp(argv[1], "-n") == 0))rounds = strtoul(argv[2], NULL, 0);
+  printf("cpu %s\n", arm_host_simd_name(cpu));
+  for(int level = ARM_HOST_SIMD_SSE41; level <= (int)cpu; level++)
+  {
+    unsigned before = failed;
+
+    cases = 0;
+    arm_host_simd_set((arm_host_simd_t)level);
+    checkLevel(rounds);
+    printf("%s: %u cases, %u failed\n", arm_host_simd_name((arm_host_simd_t)level),
+           cases, failed - before);
+  }
+  printf("%u checks failed\n", failed);
+  return (int)failed;
+}
@@ -0,0 +1,326 @@
+/**
+  ******************************************************************************
+  * @file    telemdec.c
+  * @author  AKabanov
+  * @brief   host reference decoder of the telemetry frame in the ping
+  *          (common/telem.h), synthetic captures for the test
+  ******************************************************************************
+  * build:  D=../common/Drivers/CMSIS/DSP_Lib/Source
+  *         gcc -O2 -DARM_MATH_HOST -fno-strict-aliasing -fwrapv -I../common
+  *             -I../common/Drivers/CMSIS/Include
+  *             -o telemdec telemdec.c
+  *             $D/FilteringFunctions/arm_biquad_cascade_df1_f32.c
+  *             $D/FilteringFunctions/arm_biquad_cascade_df1_init_f32.c
+  *             $D/FilteringFunctions/arm_fir_decimate_f32.c
+  *             $D/FilteringFunctions/arm_fir_decimate_init_f32.c
+  *             $D/BasicMathFunctions/arm_mult_f32.c
+  *             $D/StatisticsFunctions/arm_max_f32.c -lm
+  * usage:  telemdec [-p ARR] [-m ms] [-s snr] [-n frames] id battery sensor
+  *                                      send random frames (or the given one
+  *                                      if -n is 1) through the channel model
+  *                                      and the decoder, print frame errors
+  *         telemdec -g [-p ARR] [-m ms] [-s snr] id battery sensor > capture
+  *                                      write synthetic capture, one sample
+  *                                      per line at FS
+  *         telemdec -d [-p ARR] < capture   decode a capture
+  *
+  * Channel model: bridge output (CH1 - CH1N, +-1, +1 in the gap slot and
+  * before and after the burst) through the transducer, a resonator with
+  * quality TRANSDUCER_Q, random delay and phase, white noise at snr dB
+  * below the tone. ARR is the channel period of tim1.c PWMPeriods.
+  * Decoder: band-pass biquad cascade at the channel frequency, square,
+  * low-pass FIR decimator to the envelope, preamble edge by half of the
+  * peak, then slot timing search and the weakest slot of every symbol.
+  ******************************************************************************
+  */
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "arm_math.h"
+#include "telem.c"
+
+/* Private define ------------------------------------------------------------*/
+#define TIM_CLK         120000000.0   // TIM1CLK with PLL profile
+#define FS              192000.0      // capture sample rate
+#define OVERSAMPLE      8             // bridge output samples per capture sample
+#define TRANSDUCER_Q    8.0
+#define BAND_Q          6.0           // band-pass of the decoder, per section
+#define BAND_STAGES     2
+#define DECIM           8             // envelope rate FS/DECIM
+#define DECIM_TAPS      96
+#define ENV_CUTOFF      3000.0        // envelope low-pass, Hz
+#define MAX_SAMPLES     (1 << 16)     // multiple of DECIM
+#define LEAD_MS         6.0           // capture before the burst, at most
+#define TRAIL_MS        4.0           // capture after the burst
+#define SEARCH          8.0           // slot timing search, +- envelope samples
+
+/* Private variables ---------------------------------------------------------*/
+static float32_t capture[MAX_SAMPLES];
+static float32_t band[MAX_SAMPLES];
+static float32_t envelope[MAX_SAMPLES/DECIM];
+static uint32_t samples;
+
+/* Private functions ---------------------------------------------------------*/
+static double gauss(void)
+{
+  double u1 = (rand() + 1.0)/(RAND_MAX + 2.0);
+  double u2 = (rand() + 1.0)/(RAND_MAX + 2.0);
+  return sqrt(-2.0*log(u1))*cos(2.0*PI*u2);
+}
+
+/* band-pass biquad, 0 dB at f, CMSIS order b0 b1 b2 -a1 -a2 */
+static void bandPass(float32_t* coef, double f, double q)
+{
+  double w = 2.0*PI*f/FS;
+  double alpha = sin(w)/(2.0*q);
+  double a0 = 1.0 + alpha;
+
+  coef[0] = alpha/a0;
+  coef[1] = 0;
+  coef[2] = -alpha/a0;
+  coef[3] = 2.0*cos(w)/a0;
+  coef[4] = -(1.0 - alpha)/a0;
+}
+
+/* Hamming windowed sinc low-pass, unity gain at DC */
+static void lowPass(float32_t* coef, uint32_t taps, double fc, double fs)
+{
+  double sum = 0;
+
+  for(uint32_t i = 0; i < taps; i++)
+  {
+    double x = i - (taps - 1)/2.0;
+    double h = (x == 0) ? 2.0*fc/fs : sin(2.0*PI*fc/fs*x)/(PI*x);
+    h *= 0.54 - 0.46*cos(2.0*PI*i/(taps - 1));
+    coef[i] = h;
+    sum += h;
+  }
+  for(uint32_t i = 0; i < taps; i++)coef[i] /= sum;
+}
+
+/* tone is on in the period of the burst, same as tim1Telem() */
+static int toneOn(uint32_t data, uint32_t period)
+{
+  if(period < TELEM_PREAMBLE_PERIODS)return 1;
+  period -= TELEM_PREAMBLE_PERIODS;
+  if(period >= TELEM_SYMBOLS*TELEM_SYMBOL_PERIODS)return 1;
+  return (period % TELEM_SYMBOL_PERIODS)/TELEM_SLOT_PERIODS
+         != TELEM_GAP(data, period/TELEM_SYMBOL_PERIODS);
+}
+
+/* synthetic capture of one burst */
+static void synth(uint32_t data, uint32_t arr, double ms, double snr)
+{
+  double f = TIM_CLK/(arr + 1);
+  uint32_t periods = (uint32_t)(ms*TIM_CLK/1000.0)/(arr + 1);
+  double lead = LEAD_MS/1000.0*rand()/RAND_MAX;
+  double phase = (double)rand()/RAND_MAX;
+  double noise = pow(10.0, -snr/20.0)/sqrt(2.0);   // tone rms is 1/sqrt(2)
+  float32_t coef[5], state[4];
+  arm_biquad_casd_df1_inst_f32 transducer;
+
+  if(periods < TELEM_FRAME_PERIODS)periods = TELEM_FRAME_PERIODS;
+  samples = (uint32_t)((LEAD_MS + TRAIL_MS)/1000.0*FS + periods/f*FS);
+  samples = (samples + DECIM - 1)/DECIM*DECIM;
+  if(samples > MAX_SAMPLES)
+  {
+    fprintf(stderr, "burst is too long\n");
+    exit(1);
+  }
+  for(uint32_t i = 0; i < samples; i++)
+  {
+    double sum = 0;
+    for(int k = 0; k < OVERSAMPLE; k++)
+    {
+      double t = (i + (double)k/OVERSAMPLE)/FS - lead;
+      double p = t*f + phase;
+      double out = 1.0;                              // idle and gap state
+      if((t >= 0)&&(p - phase < periods)&&toneOn(data, (uint32_t)(p - phase)))
+      {
+        out = (p - floor(p) < 0.5) ? 1.0 : -1.0;
+      }
+      sum += out;
+    }
+    capture[i] = sum/OVERSAMPLE;
+  }
+  /* the resonator takes the fundamental out of the square wave, 4/pi */
+  bandPass(coef, f, TRANSDUCER_Q);
+  for(int i = 0; i < 3; i++)coef[i] *= PI/4.0;
+  memset(state, 0, sizeof(state));
+  arm_biquad_cascade_df1_init_f32(&transducer, 1, coef, state);
+  arm_biquad_cascade_df1_f32(&transducer, capture, capture, samples);
+  for(uint32_t i = 0; i < samples; i++)capture[i] += noise*gauss();
+}
+
+/* mean envelope of the middle half of a slot */
+static double slotLevel(double start, double len)
+{
+  int32_t from = (int32_t)floor(start + 0.25*len + 0.5);
+  int32_t to = (int32_t)floor(start + 0.75*len + 0.5);
+  double sum = 0;
+
+  if(from < 0)from = 0;
+  if(to > (int32_t)(samples/DECIM))to = samples/DECIM;
+  if(to <= from)return 0;
+  for(int32_t i = from; i < to; i++)sum += envelope[i];
+  return sum/(to - from);
+}
+
+/* weakest slot of every symbol, contrast is a margin of the decision */
+static uint32_t slotsDecide(double edge, double slotLen, double* contrast)
+{
+  uint32_t data = 0;
+
+  *contrast = 0;
+  for(uint32_t symbol = 0; symbol < TELEM_SYMBOLS; symbol++)
+  {
+    double start = edge + (TELEM_PREAMBLE_PERIODS/(double)TELEM_SLOT_PERIODS
+                           + symbol*TELEM_SLOTS)*slotLen;
+    double level[TELEM_SLOTS], sum = 0;
+    uint32_t gap = 0;
+    for(uint32_t slot = 0; slot < TELEM_SLOTS; slot++)
+    {
+      level[slot] = slotLevel(start + slot*slotLen, slotLen);
+      sum += level[slot];
+      if(level[slot] < level[gap])gap = slot;
+    }
+    *contrast += (sum - level[gap])/(TELEM_SLOTS - 1) - level[gap];
+    data = (data << 2) | gap;
+  }
+  return data;
+}
+
+/* decode the capture, -1 if there is no burst */
+static int decode(uint32_t arr, uint32_t* data)
+{
+  double f = TIM_CLK/(arr + 1);
+  double fsEnv = FS/DECIM;
+  double slotLen = TELEM_SLOT_PERIODS/f*fsEnv;
+  float32_t bandCoef[5*BAND_STAGES], bandState[4*BAND_STAGES];
+  float32_t lpCoef[DECIM_TAPS], lpState[DECIM_TAPS + MAX_SAMPLES - 1];
+  arm_biquad_casd_df1_inst_f32 bp;
+  arm_fir_decimate_instance_f32 lp;
+  float32_t peak;
+  uint32_t peakIndex, envLen = samples/DECIM, edge;
+  double best = -1, bestEdge = 0;
+
+  for(int i = 0; i < BAND_STAGES; i++)bandPass(&bandCoef[5*i], f, BAND_Q);
+  memset(bandState, 0, sizeof(bandState));
+  arm_biquad_cascade_df1_init_f32(&bp, BAND_STAGES, bandCoef, bandState);
+  arm_biquad_cascade_df1_f32(&bp, capture, band, samples);
+  arm_mult_f32(band, band, band, samples);
+  lowPass(lpCoef, DECIM_TAPS, ENV_CUTOFF, FS);
+  if(arm_fir_decimate_init_f32(&lp, DECIM_TAPS, DECIM, lpCoef, lpState, samples) != ARM_MATH_SUCCESS)
+  {
+    fprintf(stderr, "decimator init error\n");
+    exit(1);
+  }
+  arm_fir_decimate_f32(&lp, band, envelope, samples);
+
+  arm_max_f32(envelope, envLen, &peak, &peakIndex);
+  for(edge = 0; edge < envLen; edge++)if(envelope[edge] >= peak/2)break;
+  if(edge + TELEM_FRAME_PERIODS/f*fsEnv > envLen)return -1;
+
+  for(double shift = -SEARCH; shift <= SEARCH; shift += 0.25)
+  {
+    double contrast;
+    slotsDecide(edge + shift, slotLen, &contrast);
+    if(contrast > best)
+    {
+      best = contrast;
+      bestEdge = edge + shift;
+    }
+  }
+  *data = slotsDecide(bestEdge, slotLen, &best);
+  return 0;
+}
+
+static void printFrame(const char* name, uint32_t data)
+{
+  uint32_t id, battery, sensState;
+
+  if(telemUnpack(data, &id, &battery, &sensState) != 0)
+  {
+    printf("%s %06X CRC error\n", name, (unsigned)data);
+  }
+  else
+  {
+    printf("%s %06X id %u battery %u sensor %s\n", name, (unsigned)data,
+           (unsigned)id, (unsigned)battery, sensState ? "full" : "empty");
+  }
+}
+
+static void usage(void)
+{
+  fprintf(stderr, "usage: telemdec [-p ARR] [-m ms] [-s snr] [-n frames] id battery sensor\n"
+                  "       telemdec -g [-p ARR] [-m ms] [-s snr] id battery sensor > capture\n"
+                  "       telemdec -d [-p ARR] < capture\n");
+  exit(1);
+}
+
+int main(int argc, char* argv[])
+{
+  uint32_t arr = 2751, frames = 1, data, errors = 0, crcErrors = 0;
+  double ms = 29, snr = 10;
+  int gen = 0, dec = 0, i;
+
+  for(i = 1; (i < argc)&&(argv[i][0] == '-'); i++)
+  {
+    if(strcmp(argv[i], "-g") == 0)gen = 1;
+    else if(strcmp(argv[i], "-d") == 0)dec = 1;
+    else if(i + 1 >= argc)usage();
+    else if(strcmp(argv[i], "-p") == 0)arr = atoi(argv[++i]);
+    else if(strcmp(argv[i], "-m") == 0)ms = atof(argv[++i]);
+    else if(strcmp(argv[i], "-s") == 0)snr = atof(argv[++i]);
+    else if(strcmp(argv[i], "-n") == 0)frames = atoi(argv[++i]);
+    else usage();
+  }
+  if(dec)
+  {
+    char line[64];
+    for(samples = 0; (samples < MAX_SAMPLES)&&(fgets(line, sizeof(line), stdin) != NULL); )
+    {
+      capture[samples++] = atof(line);
+    }
+    samples = samples/DECIM*DECIM;
+    if(decode(arr, &data) != 0)
+    {
+      printf("no burst\n");
+      return 1;
+    }
+    printFrame("decoded", data);
+    return 0;
+  }
+  if((argc - i != 3)||(frames == 0))usage();
+  data = telemPack(atoi(argv[i]), atoi(argv[i + 1]), atoi(argv[i + 2]));
+  srand(1);
+  if(gen)
+  {
+    synth(data, arr, ms, snr);
+    for(uint32_t k = 0; k < samples; k++)printf("%.5f\n", capture[k]);
+    return 0;
+  }
+  for(uint32_t n = 0; n < frames; n++)
+  {
+    uint32_t got;
+    if(frames > 1)data = telemPack(rand() % 10000, rand() % 9, rand() % 2);
+    synth(data, arr, ms, snr);
+    if(decode(arr, &got) != 0)got = ~data;
+    if(frames == 1)
+    {
+      printFrame("sent   ", data);
+      printFrame("decoded", got);
+    }
+    if(got != data)
+    {
+      uint32_t id, battery, sensState;
+      errors++;
+      if(telemUnpack(got, &id, &battery, &sensState) != 0)crcErrors++;
+    }
+  }
+  printf("%.1f kHz, snr %.1f dB, %u frames, %u errors, %u found by CRC\n",
+         TIM_CLK/(arr + 1)/1000.0, snr, (unsigned)frames, (unsigned)errors, (unsigned)crcErrors);
+  return errors ? 1 : 0;
+}
@@ -0,0 +1,316 @@
+/**
+  ******************************************************************************
+  * @file    tonedetect.c
+  * @author  AKabanov
+  * @brief   host detector of the channel of a ping in a capture, Goertzel
+  *          bins of the frequency plan (common/freqplan.h)
+  ******************************************************************************
+  * build:  D=../common/Drivers/CMSIS/DSP_Lib/Source
+  *         gcc -O2 -DARM_MATH_HOST -fno-strict-aliasing -fwrapv -I../common
+  *             -I../common/Drivers/CMSIS/Include -o tonedetect tonedetect.c
+  *             $D/TransformFunctions/arm_goertzel_*.c
+  *             $D/ControllerFunctions/arm_sin_cos_q31.c
+  *             $D/SupportFunctions/arm_q15_to_q31.c
+  *             $D/SupportFunctions/arm_q15_to_float.c
+  *             $D/SupportFunctions/arm_q31_to_float.c
+  *             $D/CommonTables/arm_common_tables.c -lm
+  * usage:  tonedetect [-r rate] [-n block] [-t q15|q31|f32] [-m dB] file
+  *         tonedetect -s [-r rate] [-n block]        self test
+  *
+  * file is the capture, 16 bit little endian mono samples at rate Hz
+  * (200000 default, "-" is stdin). Every block of n samples (2048 default,
+  * about 100 Hz bins at 200 kHz, the Marport channels are 100 Hz apart)
+  * goes through arm_goertzel_multi_<t> with a bin on every channel of
+  * FREQ_PLAN, the coefficients come from the same Hz as PWMPeriods[] of
+  * the firmware. A block is a hit when its strongest channel is m dB
+  * (10 default) above the median of the channels; the line shows time,
+  * channel, level in dBFS (0 dBFS is a full scale sine) and the margin.
+  * The channel with the most hits is the result, exit code 0 if there is
+  * one, 1 if not.
+  *
+  * The self test puts every channel at -20 dBFS with white noise and the
+  * neighbour channel at -40 dBFS into a block and checks the three types:
+  * the detected channel and its level (blocks with bins up to 200 Hz), the
+  * bins against a double DFT (phase referred to the last sample) and
+  * arm_goertzel_multi_* against arm_goertzel_*. Exit code is the number of
+  * failed checks.
+  ******************************************************************************
+  */
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "arm_math.h"
+#include "freqplan.h"
+
+/* Private define ------------------------------------------------------------*/
+#define MAX_BLOCK       16384
+
+/* Private typedef -----------------------------------------------------------*/
+typedef enum
+{
+  TYPE_Q15,
+  TYPE_Q31,
+  TYPE_F32
+} Type;
+
+/* Private variables ---------------------------------------------------------*/
+static const uint32_t planHz[FREQ_CHANNELS] =
+{
+#define PLAN_HZ(ch, hz)  [ch - 1] = hz,
+  FREQ_PLAN(PLAN_HZ)
+};
+static const char* const typeName[] = {"q15", "q31", "f32"};
+
+static uint32_t sampleRate = 200000, blockSize = 2048;
+static arm_goertzel_instance_q15 inst15;
+static arm_goertzel_instance_q31 inst31;
+static arm_goertzel_instance_f32 instF;
+static q31_t coeffs15[2*FREQ_CHANNELS], coeffs31[2*FREQ_CHANNELS];
+static float32_t coeffsF[2*FREQ_CHANNELS];
+static q15_t block15[MAX_BLOCK];
+static q31_t block31[MAX_BLOCK];
+static float32_t blockF[MAX_BLOCK];
+static uint32_t seed = 1;
+static unsigned failed = 0;
+
+/* Private functions ---------------------------------------------------------*/
+static uint32_t rnd(void)
+{
+  seed ^= seed << 13;
+  seed ^= seed >> 17;
+  seed ^= seed << 5;
+  return seed;
+}
+
+static void check(const char* name, int ch, int ok)
+{
+  if(!ok)
+  {
+    printf("FAIL %s channel %d\n", name, ch);
+    failed++;
+  }
+}
+
+static void init(void)
+{
+  if((blockSize == 0)||(blockSize > MAX_BLOCK)||
+     (arm_goertzel_init_q15(&inst15, FREQ_CHANNELS, coeffs15, planHz, sampleRate, blockSize) != ARM_MATH_SUCCESS)||
+     (arm_goertzel_init_q31(&inst31, FREQ_CHANNELS, coeffs31, planHz, sampleRate, blockSize) != ARM_MATH_SUCCESS)||
+     (arm_goertzel_init_f32(&instF, FREQ_CHANNELS, coeffsF, planHz, sampleRate, blockSize) != ARM_MATH_SUCCESS))
+  {
+    fprintf(stderr, "block %u not supported at %u Hz\n", (unsigned)blockSize, (unsigned)sampleRate);
+    exit(1);
+  }
+}
+
+/* block15[] to the other types, then the bins of the type as float */
+static void bins(Type type, float32_t* out)
+{
+  static q31_t out31[2*FREQ_CHANNELS];
+
+  arm_q15_to_q31(block15, block31, blockSize);
+  arm_q15_to_float(block15, blockF, blockSize);
+  switch(type)
+  {
+  case TYPE_Q15:
+    arm_goertzel_multi_q15(&inst15, block15, out31);
+    arm_q31_to_float(out31, out, 2*FREQ_CHANNELS);
+    break;
+  case TYPE_Q31:
+    arm_goertzel_multi_q31(&inst31, block31, out31);
+    arm_q31_to_float(out31, out, 2*FREQ_CHANNELS);
+    break;
+  default:
+    arm_goertzel_multi_f32(&instF, blockF, out);
+    break;
+  }
+}
+
+/* level of the bins in dBFS, a full scale sine on a bin is |y| = 1/2 */
+static void levels(const float32_t* out, double* dB)
+{
+  for(int i = 0; i < FREQ_CHANNELS; i++)
+  {
+    double p = 4.0*((double)out[2*i]*out[2*i] + (double)out[2*i + 1]*out[2*i + 1]);
+    dB[i] = 10.0*log10(p + 1e-20);
+  }
+}
+
+static int cmpDouble(const void* a, const void* b)
+{
+  double x = *(const double*)a, y = *(const double*)b;
+  return (x > y) - (x < y);
+}
+
+/* strongest channel (0 based) and its margin to the median */
+static int strongest(const double* dB, double* margin)
+{
+  double sorted[FREQ_CHANNELS];
+  int best = 0;
+
+  for(int i = 0; i < FREQ_CHANNELS; i++)if(dB[i] > dB[best])best = i;
+  memcpy(sorted, dB, sizeof(sorted));
+  qsort(sorted, FREQ_CHANNELS, sizeof(double), cmpDouble);
+  *margin = dB[best] - sorted[FREQ_CHANNELS/2];
+  return best;
+}
+
+/* tone at dBFS on a channel, phase random */
+static void addTone(double* x, uint32_t hz, double dBFS)
+{
+  double a = pow(10.0, dBFS/20.0), phase = rnd()*(2.0*PI/4294967296.0);
+
+  for(uint32_t n = 0; n < blockSize; n++)x[n] += a*sin(2.0*PI*hz*n/sampleRate + phase);
+}
+
+static void selfTest(void)
+{
+  static double x[MAX_BLOCK];
+
+  for(int ch = 0; ch < FREQ_CHANNELS; ch++)
+  {
+    /* -20 dBFS tone, -40 dBFS neighbour, noise about -50 dBFS per bin */
+    for(uint32_t n = 0; n < blockSize; n++)x[n] = ((int32_t)rnd() >> 8)*(0.02/8388608.0);
+    addTone(x, planHz[ch], -20.0);
+    addTone(x, planHz[(ch + 1) % FREQ_CHANNELS], -40.0);
+    for(uint32_t n = 0; n < blockSize; n++)block15[n] = (q15_t)lrint(x[n]*32768.0);
+
+    for(int type = TYPE_Q15; type <= TYPE_F32; type++)
+    {
+      float32_t out[2*FREQ_CHANNELS], one[2];
+      double dB[FREQ_CHANNELS], margin, worst = 0;
+      int ok = 1;
+
+      bins((Type)type, out);
+      levels(out, dB);
+      /* blocks with bins up to 200 Hz, the neighbour may be inside the main
+         lobe, +-1 dB; the level is lower by N/2^shift for other than 2^n */
+      if(sampleRate <= 200*blockSize)
+      {
+        check(typeName[type], ch + 1, (strongest(dB, &margin) == ch)&&
+              (fabs(dB[ch] + 20.0 - 20.0*log10(blockSize*(double)instF.scale)) < 1.0));
+      }
+
+      /* against the DFT of the quantized block, relative to the tone */
+      for(int i = 0; i < FREQ_CHANNELS; i++)
+      {
+        double w = 2.0*PI*planHz[i]/sampleRate, re = 0, im = 0, scale = 1;
+
+        for(uint32_t n = 0; n < blockSize; n++)
+        {
+          re += block15[n]/32768.0*cos(w*(n + 1.0 - blockSize));
+          im -= block15[n]/32768.0*sin(w*(n + 1.0 - blockSize));
+        }
+        while(scale < blockSize)scale *= 2;
+        re /= scale;
+        im /= scale;
+        if(fabs(re - out[2*i]) > worst)worst = fabs(re - out[2*i]);
+        if(fabs(im - out[2*i + 1]) > worst)worst = fabs(im - out[2*i + 1]);
+
+        /* the single bin version gives the same bits */
+        if(type == TYPE_Q15)
+        {
+          q31_t o[2];
+          arm_goertzel_q15(&inst15, (uint16_t)i, block15, o);
+          arm_q31_to_float(o, one, 2);
+        }
+        else if(type == TYPE_Q31)
+        {
+          q31_t o[2];
+          arm_goertzel_q31(&inst31, (uint16_t)i, block31, o);
+          arm_q31_to_float(o, one, 2);
+        }
+        else arm_goertzel_f32(&instF, (uint16_t)i, blockF, one);
+        if((one[0] != out[2*i])||(one[1] != out[2*i + 1]))ok = 0;
+      }
+      /* -60 dB of the -20 dBFS tone, |y| = 0.05 */
+      check("DFT", ch + 1, worst < 0.05e-3);
+      check("multi", ch + 1, ok);
+      if(ch == 0)printf("%s: error to DFT %.2e, %.1f dB below the tone\n", typeName[type], worst,
+                        20.0*log10(0.05/worst));
+    }
+  }
+  printf("%d channels, %u checks failed\n", FREQ_CHANNELS, failed);
+}
+
+static void usage(void)
+{
+  fprintf(stderr, "usage: tonedetect [-r rate] [-n block] [-t q15|q31|f32] [-m dB] file\n"
+                  "       tonedetect -s [-r rate] [-n block]\n");
+  exit(1);
+}
+
+int main(int argc, char* argv[])
+{
+  Type type = TYPE_Q15;
+  double minMargin = 10;
+  unsigned hits[FREQ_CHANNELS] = {0};
+  const char* name = NULL;
+  int test = 0, best = -1;
+  FILE* f;
+
+  for(int i = 1; i < argc; i++)
+  {
+    if(strcmp(argv[i], "-s") == 0)test = 1;
+    else if((strcmp(argv[i], "-r") == 0)&&(i + 1 < argc))sampleRate = strtoul(argv[++i], NULL, 0);
+    else if((strcmp(argv[i], "-n") == 0)&&(i + 1 < argc))blockSize = strtoul(argv[++i], NULL, 0);
+    else if((strcmp(argv[i], "-m") == 0)&&(i + 1 < argc))minMargin = atof(argv[++i]);
+    else if((strcmp(argv[i], "-t") == 0)&&(i + 1 < argc))
+    {
+      i++;
+      for(type = TYPE_Q15; (type <= TYPE_F32)&&(strcmp(argv[i], typeName[type]) != 0); type++);
+      if(type > TYPE_F32)usage();
+    }
+    else if(name == NULL)name = argv[i];
+    else usage();
+  }
+  init();
+  if(test)
+  {
+    selfTest();
+    return (int)failed;
+  }
+  if(name == NULL)usage();
+  f = (strcmp(name, "-") == 0) ? stdin : fopen(name, "rb");
+  if(f == NULL)
+  {
+    perror(name);
+    return 1;
+  }
+
+  printf("%d channels, %u Hz, block %u (%.2f ms, %.1f Hz), %s\n", FREQ_CHANNELS,
+         (unsigned)sampleRate, (unsigned)blockSize, 1e3*blockSize/sampleRate,
+         (double)sampleRate/blockSize, typeName[type]);
+  for(uint32_t blocks = 0; ; blocks++)
+  {
+    uint8_t raw[2*MAX_BLOCK];
+    float32_t out[2*FREQ_CHANNELS];
+    double dB[FREQ_CHANNELS], margin;
+    int ch;
+
+    if(fread(raw, 2, blockSize, f) != blockSize)break;
+    for(uint32_t n = 0; n < blockSize; n++)block15[n] = (q15_t)(raw[2*n] | (raw[2*n + 1] << 8));
+    bins(type, out);
+    levels(out, dB);
+    ch = strongest(dB, &margin);
+    if(margin < minMargin)continue;
+    hits[ch]++;
+    printf("%9.2f ms  ch %2d %6u Hz  %6.1f dBFS  +%.1f dB\n", 1e3*blocks*blockSize/sampleRate,
+           ch + 1, (unsigned)planHz[ch], dB[ch], margin);
+  }
+  if(f != stdin)fclose(f);
+
+  for(int i = 0; i < FREQ_CHANNELS; i++)
+  {
+    if((hits[i] > 0)&&((best < 0)||(hits[i] > hits[best])))best = i;
+  }
+  if(best < 0)
+  {
+    printf("no channel\n");
+    return 1;
+  }
+  printf("channel %d, %u Hz, %u blocks\n", best + 1, (unsigned)planHz[best], hits[best]);
+  return 0;
+}
@@ -0,0 +1,131 @@
+/**
+  ******************************************************************************
+  * @file    tracedecode.c
+  * @author  AKabanov
+  * @brief   host decoder of the trace printed by bootloader 'p' command
+  ******************************************************************************
+  * build:  gcc -O2 -o tracedecode tracedecode.c
+  * usage:  tracedecode < terminal_log.txt
+  *
+  * Every " T id MHz cycles" line is one checkpoint (see common/trace.h).
+  * A record starts with TRACE_BOOT (reset, standby wake) or TRACE_APP_WAKE
+  * (Stop mode wake). The time of a stage is the cycle difference divided by
+  * the clock of the checkpoint that opens the stage.
+  * Active time of every record is also split by clock (16 MHz HSI profile,
+  * 120 MHz PLL profile) to compare wake-to-sleep cost of the profiles.
+  ******************************************************************************
+  */
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+
+/* Private define ------------------------------------------------------------*/
+#define MAX_ID          32
+#define TRACE_BOOT      0
+#define TRACE_APP_WAKE  26
+#define MAX_MHZ         256
+
+/* Private variables ---------------------------------------------------------*/
+/* names of traceId_t from common/trace.h, keep in sync */
+static const char* traceName[MAX_ID] =
+{
+  [0]  = "boot",
+  [1]  = "HAL_Init",
+  [2]  = "SystemClock_Config",
+  [3]  = "gpioInit",
+  [4]  = "CRC check",
+  [5]  = "goToApp",
+  [16] = "app main",
+  [17] = "app HAL_Init",
+  [18] = "app HSI profile",
+  [19] = "app RTCInit",
+  [20] = "app gpio/tim1Init",
+  [21] = "app sensor",
+  [22] = "burst start",
+  [23] = "burst end",
+  [24] = "standby",
+  [25] = "app PLL on",
+  [26] = "stop wake",
+};
+
+/* summary of stage "from -> to" */
+static double stageSum[MAX_ID][MAX_ID];
+static unsigned stageNum[MAX_ID][MAX_ID];
+/* active time of the current record per clock */
+static double mhzTime[MAX_MHZ];
+
+
+/* Private functions ---------------------------------------------------------*/
+static const char* name(unsigned id)
+{
+  static char buf[16];
+  if((id < MAX_ID)&&(traceName[id] != NULL))return traceName[id];
+  snprintf(buf, sizeof(buf), "id %u", id);
+  return buf;
+}
+
+static void printRecordEnd(double total)
+{
+  printf("  total %10.1f us\n", total);
+  for(unsigned mhz = 0; mhz < MAX_MHZ; mhz++)
+  {
+    if(mhzTime[mhz] == 0)continue;
+    printf("    at %3u MHz %10.1f us\n", mhz, mhzTime[mhz]);
+    mhzTime[mhz] = 0;
+  }
+}
+
+int main(void)
+{
+  char line[256];
+  unsigned id, mhz, prevId = 0, prevMhz = 0, records = 0;
+  uint32_t cycles, prevCycles = 0;
+  double total = 0;
+  int havePrev = 0;
+
+  while(fgets(line, sizeof(line), stdin) != NULL)
+  {
+    if(sscanf(line, " T %u %u %u", &id, &mhz, &cycles) != 3)continue;
+    if((id == TRACE_BOOT)||(id == TRACE_APP_WAKE))
+    {
+      if(havePrev)printRecordEnd(total);
+      printf("record %u\n", ++records);
+      total = 0;
+      havePrev = 0;
+    }
+    if(havePrev)
+    {
+      double us = (double)(uint32_t)(cycles - prevCycles)/(prevMhz ? prevMhz : 1);
+      printf("  %-24s -> %-24s %10.1f us\n", name(prevId), name(id), us);
+      total += us;
+      if(prevMhz < MAX_MHZ)mhzTime[prevMhz] += us;
+      if((prevId < MAX_ID)&&(id < MAX_ID))
+      {
+        stageSum[prevId][id] += us;
+        stageNum[prevId][id]++;
+      }
+    }
+    prevId = id;
+    prevMhz = mhz;
+    prevCycles = cycles;
+    havePrev = 1;
+  }
+  if(havePrev)printRecordEnd(total);
+  if(records == 0)
+  {
+    fprintf(stderr, "no trace lines found\n");
+    return 1;
+  }
+  printf("\naverage per stage over %u records\n", records);
+  for(unsigned from = 0; from < MAX_ID; from++)
+  {
+    for(unsigned to = 0; to < MAX_ID; to++)
+    {
+      if(stageNum[from][to] == 0)continue;
+      printf("  %-24s -> %-24s %10.1f us (%u)\n", name(from), name(to),
+             stageSum[from][to]/stageNum[from][to], stageNum[from][to]);
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,267 @@
+/**
+  ******************************************************************************
+  * @file    wavegen.c
+  * @author  AKabanov
+  * @brief   host generator of TIM1 waveform tables for tim1Wave()
+  ******************************************************************************
+  * build:  D=../common/Drivers/CMSIS/DSP_Lib/Source
+  *         gcc -O2 -DARM_MATH_HOST -fno-strict-aliasing -fwrapv
+  *             -I../common/Drivers/CMSIS/Include -o wavegen wavegen.c
+  *             $D/TransformFunctions/arm_rfft_fast_f32.c
+  *             $D/TransformFunctions/arm_rfft_fast_init_f32.c
+  *             $D/TransformFunctions/arm_cfft_f32.c
+  *             $D/TransformFunctions/arm_cfft_radix8_f32.c
+  *             $D/TransformFunctions/arm_bitreversal2.c
+  *             $D/CommonTables/arm_common_tables.c
+  *             $D/CommonTables/arm_const_structs.c
+  *             $D/ComplexMathFunctions/arm_cmplx_mag_squared_f32.c -lm
+  * usage:  wavegen tone f ms [f ms ...]      tones one after another
+  *         wavegen chirp f0 f1 ms            linear FM, period by period
+  *         wavegen fsk f0 f1 baud bits       bits is a string like 1011
+  *
+  * The table of tim1Step_t goes to stdout, the check to stderr. The output
+  * (CH1 - CH1N, +-1) is rebuilt at timer clock resolution, averaged to
+  * FS_DIV clocks per sample, and every frame of FFT_LEN samples goes through
+  * arm_rfft_fast_f32. Peak frequency of the frame and share of energy near
+  * the wanted band show the sweep and the spurs of period rounding.
+  ******************************************************************************
+  */
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "arm_math.h"
+
+/* Private define ------------------------------------------------------------*/
+#define TIM_CLK         120000000.0   // TIM1CLK with PLL profile
+#define MAX_STEPS       4096
+#define MAX_RCR         255
+#define FS_DIV          96            // 1.25 MHz sample rate
+#define FFT_LEN         4096
+#define BAND_HZ         2000.0        // band around wanted frequencies
+
+/* Private typedef -----------------------------------------------------------*/
+/* same as tim1Step_t in application/Inc/tim1.h */
+typedef struct
+{
+  uint16_t ARR;
+  uint16_t RCR;
+  uint16_t CCR1;
+} tim1Step_t;
+
+/* Private variables ---------------------------------------------------------*/
+static tim1Step_t step[MAX_STEPS];
+static uint32_t steps = 0;
+static double fMin = 1e9, fMax = 0;
+static float32_t* sample;
+static uint32_t samples = 0;
+
+/* Private functions ---------------------------------------------------------*/
+static uint32_t periodOf(double f)
+{
+  return (uint32_t)floor(TIM_CLK/f + 0.5);
+}
+
+static void wanted(double f)
+{
+  if(f < fMin)fMin = f;
+  if(f > fMax)fMax = f;
+}
+
+/* n periods of arr + 1 clocks, merged with the last step when possible */
+static void addPeriods(uint32_t period, uint32_t n)
+{
+  if((period < 2)||(period > 65536))
+  {
+    fprintf(stderr, "period %u out of 16 bit timer\n", period);
+    exit(1);
+  }
+  while(n > 0)
+  {
+    tim1Step_t* last = (steps > 0) ? &step[steps - 1] : NULL;
+    uint32_t add;
+
+    if((last != NULL)&&(last->ARR == period - 1)&&(last->RCR < MAX_RCR))
+    {
+      add = MAX_RCR - last->RCR;
+      if(add > n)add = n;
+      last->RCR += add;
+    }
+    else
+    {
+      if(steps == MAX_STEPS)
+      {
+        fprintf(stderr, "more than %d steps\n", MAX_STEPS);
+        exit(1);
+      }
+      add = (n > MAX_RCR + 1) ? MAX_RCR + 1 : n;
+      step[steps].ARR = (uint16_t)(period - 1);
+      step[steps].RCR = (uint16_t)(add - 1);
+      step[steps].CCR1 = (uint16_t)(period/2);
+      steps++;
+    }
+    n -= add;
+  }
+}
+
+static void addTone(double f, double ms)
+{
+  uint32_t period = periodOf(f);
+  uint32_t n = (uint32_t)floor(ms*1e-3*TIM_CLK/period + 0.5);
+
+  wanted(f);
+  addPeriods(period, n);
+}
+
+static void addChirp(double f0, double f1, double ms)
+{
+  double t = 0, T = ms*1e-3;
+
+  wanted(f0);
+  wanted(f1);
+  while(t < T)
+  {
+    uint32_t period = periodOf(f0 + (f1 - f0)*t/T);
+    addPeriods(period, 1);
+    t += period/TIM_CLK;
+  }
+}
+
+static void addFsk(double f0, double f1, double baud, const char* bits)
+{
+  wanted(f0);
+  wanted(f1);
+  for(; *bits != 0; bits++)
+  {
+    double f = (*bits == '1') ? f1 : f0;
+    uint32_t period = periodOf(f);
+    uint32_t n = (uint32_t)floor(TIM_CLK/baud/period + 0.5);
+    addPeriods(period, n);
+  }
+}
+
+/* output level +1 while CNT < CCR1, -1 after, averaged over FS_DIV clocks */
+static void addLevel(double level, uint32_t clocks, double* acc, uint32_t* fill)
+{
+  while(clocks > 0)
+  {
+    uint32_t part = FS_DIV - *fill;
+    if(part > clocks)part = clocks;
+    *acc += level*part;
+    *fill += part;
+    clocks -= part;
+    if(*fill == FS_DIV)
+    {
+      sample[samples++] = (float32_t)(*acc/FS_DIV);
+      *acc = 0;
+      *fill = 0;
+    }
+  }
+}
+
+static void render(void)
+{
+  uint64_t clocks = 0;
+  double acc = 0;
+  uint32_t fill = 0;
+
+  for(uint32_t i = 0; i < steps; i++)clocks += (uint64_t)(step[i].ARR + 1)*(step[i].RCR + 1);
+  sample = calloc(clocks/FS_DIV + FFT_LEN + 1, sizeof(float32_t));
+  for(uint32_t i = 0; i < steps; i++)
+  {
+    for(uint32_t n = 0; n <= step[i].RCR; n++)
+    {
+      addLevel(1.0, step[i].CCR1, &acc, &fill);
+      addLevel(-1.0, step[i].ARR + 1 - step[i].CCR1, &acc, &fill);
+    }
+  }
+  fprintf(stderr, "%u steps, %u bytes, %.3f ms\n", steps,
+          (unsigned)(steps*sizeof(tim1Step_t)), clocks/TIM_CLK*1e3);
+}
+
+static void spectrum(void)
+{
+  static float32_t frame[FFT_LEN], out[FFT_LEN], mag[FFT_LEN/2];
+  arm_rfft_fast_instance_f32 fft;
+  double fs = TIM_CLK/FS_DIV, bin = fs/FFT_LEN, bandSum = 0;
+  uint32_t frames = 0;
+
+  if(arm_rfft_fast_init_f32(&fft, FFT_LEN) != ARM_MATH_SUCCESS)exit(1);
+  fprintf(stderr, "frame_ms,peak_hz,in_band\n");
+  for(uint32_t start = 0; start + FFT_LEN <= samples + FFT_LEN/2; start += FFT_LEN/2)
+  {
+    double total = 0, band = 0;
+    uint32_t peak = 1;
+
+    for(uint32_t i = 0; i < FFT_LEN; i++)
+    {
+      float32_t x = (start + i < samples) ? sample[start + i] : 0.0f;
+      frame[i] = x*(0.5f - 0.5f*cosf(2.0f*PI*i/FFT_LEN));
+    }
+    arm_rfft_fast_f32(&fft, frame, out, 0);
+    arm_cmplx_mag_squared_f32(out + 2, mag + 1, FFT_LEN/2 - 1);
+    for(uint32_t k = 1; k < FFT_LEN/2; k++)
+    {
+      double f = k*bin;
+      total += mag[k];
+      if((f > fMin - BAND_HZ)&&(f < fMax + BAND_HZ))band += mag[k];
+      if(mag[k] > mag[peak])peak = k;
+    }
+    /* parabolic interpolation of the peak */
+    double delta = 0;
+    if((peak > 1)&&(peak < FFT_LEN/2 - 1))
+    {
+      double a = mag[peak - 1], b = mag[peak], c = mag[peak + 1];
+      if(a - 2*b + c != 0)delta = 0.5*(a - c)/(a - 2*b + c);
+    }
+    fprintf(stderr, "%.3f,%.1f,%.4f\n", start/fs*1e3, (peak + delta)*bin,
+            (total > 0) ? band/total : 0);
+    bandSum += (total > 0) ? band/total : 0;
+    frames++;
+  }
+  fprintf(stderr, "average in band %.4f over %u frames\n", frames ? bandSum/frames : 0, frames);
+}
+
+static void printTable(void)
+{
+  printf("/* made by tools/wavegen, %.0f - %.0f Hz */\n", fMin, fMax);
+  printf("#define WAVE_STEPS %u\n", steps);
+  printf("const tim1Step_t wave[WAVE_STEPS] =\n{\n");
+  for(uint32_t i = 0; i < steps; i++)
+  {
+    printf("  {%u, %u, %u},\n", step[i].ARR, step[i].RCR, step[i].CCR1);
+  }
+  printf("};\n");
+}
+
+static void usage(void)
+{
+  fprintf(stderr, "usage: wavegen tone f ms [f ms ...]\n"
+                  "       wavegen chirp f0 f1 ms\n"
+                  "       wavegen fsk f0 f1 baud bits\n");
+  exit(1);
+}
+
+int main(int argc, char* argv[])
+{
+  if(argc < 2)usage();
+  if((strcmp(argv[1], "tone") == 0)&&(argc >= 4)&&(argc % 2 == 0))
+  {
+    for(int i = 2; i < argc; i += 2)addTone(atof(argv[i]), atof(argv[i + 1]));
+  }
+  else if((strcmp(argv[1], "chirp") == 0)&&(argc == 5))
+  {
+    addChirp(atof(argv[2]), atof(argv[3]), atof(argv[4]));
+  }
+  else if((strcmp(argv[1], "fsk") == 0)&&(argc == 6))
+  {
+    addFsk(atof(argv[2]), atof(argv[3]), atof(argv[4]), argv[5]);
+  }
+  else usage();
+  if(steps == 0)usage();
+  render();
+  spectrum();
+  printTable();
+  return 0;
+}